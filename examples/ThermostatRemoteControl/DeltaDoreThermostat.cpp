@@ -205,7 +205,7 @@ void DeltaDoreThermostat :: regulateTemperature	()
 bool DeltaDoreThermostat :: emmitHeatingCommand (bool on)
 {
 	const uint8_t nbPackets = 3;
-	CCPACKET packetsToSend [nbPackets];
+	ccPacketView packetsToSend [nbPackets];							// Views on the command tables in flash, no copy
 
 	Logln(F("Emmiting command to switch ") << (on ? F("ON") : F("OFF")) << F(" heating"));
 
@@ -214,7 +214,7 @@ bool DeltaDoreThermostat :: emmitHeatingCommand (bool on)
 		notifyHeatingStateChanged (_heatingOn);
 	}
 
-	for (int i=0; i<nbPackets; i++) { packetsToSend [i] = (on ? HEATING_ON_CMD [i] : HEATING_OFF_CMD [i]); }
+	for (int i=0; i<nbPackets; i++) { packetsToSend [i] = ccPacketView::fromProgmem (on ? HEATING_ON_CMD [i] : HEATING_OFF_CMD [i]); }
 
 	return _x2dEmmiter->sendPackets (packetsToSend, nbPackets);
 }
@@ -13,6 +13,13 @@
 #include <cc1101X2dTransceiver.h>
 #include <cc1101X2dEmitter.h>
 #include <ccReplayer.h>
+#include <ccPacketParser.h>
+#include <ccPacketEngine.h>
+#include <ccSpectrumScanner.h>
+#include <ccFskDetector.h>
+#include <ccFlexRegistry.h>
+#include <ccDecoderRegistry.h>
+#include <ccX2dDecoder.h>
 
 #include "Settings.h"
 
@@ -57,8 +64,21 @@ static const char PROGMEM PRINT_HELP[] = R"rawliteral(
  parse [radio signal in POST] .... Parse radio signal in the request body (POST: No restriction on data len)
  store : {"id": $1} .............. Store the memorized radio signal in a file with an Id between 1 to 255
  load : {"id": $1} ............... Load in memory the stored radio signal from the corresponding file
+ replay : {"id": $1} ............. Emmit the stored radio signal (the memorized one is kept)
  delete : {"id": $1} ............. Delete the corresponding file (containing a radio signal)
  idlist .......................... List of all files containing stored radio signals
+ export .......................... Binary batch of all the stored radio signals (ccPacketCodec format)
+ batch [signals in POST] ......... Store many radio signals at once, one "$id $signal" line each (all or nothing)
+ printall ........................ All the stored radio signals, one "$id $signal" line each (batch format)
+ scan : {"first": $1, "count": $2} Start a RSSI sweep of the channels, previous sweep: one "channel dBm" line per channel
+ flex : {"spec": "$1"} ........... Add a rtl_433 flex decoder, ex: "n=x2d,m=OOK_MC_ZEROBIT,s=844,l=0,r=1656"
+ flex : {"remove": "$1"} ......... Remove the named flex decoder
+ flex ............................ List the flex decoders and the last decoded message
+ fsk : {"listenMs": $1} .......... Start the detection of an unknown FSK transmitter (data rate, deviation, sync word)
+ fsk ............................. Detection in progress, one "baud deviationHz bytes preambles syncword matches" line per candidate
+ decoders ........................ Protocol decoders CPU time, one "name calls decoded totalUs maxUs" line per decoder
+ pool ............................ Packet pool and RX / TX queues usage, one "name value" line per counter
+ bench ........................... CRC-16 / PN9 whitening speed, one "name bytes cycles" line per implementation
 
 ===========================================================================================================
 )rawliteral";
@@ -74,10 +94,115 @@ namespace wifix {
 CC1101X2dTransceiver		cc1101Transceiver (CC1101_IRQ_PIN);
 //CC1101X2dEmitter			cc1101Transceiver;					// Emitter only
 
+ccSpectrumScanner			spectrumScanner (cc1101Transceiver);
+ccFskDetector				fskDetector (cc1101Transceiver);
 
+//CC1101OokCapture			ookCapture (CC1101_IRQ_PIN);		// Raw OOK capture radio => flexDecoders.attach (&ookCapture) for live decoding
+ccFlexRegistry				flexDecoders;
+
+ccX2dDecoder				x2dDecoder;
+ccDecoderRegistry			decoderRegistry;
+
+
+SINGLETON_IMPL (RadioTaskRunner)
 SINGLETON_IMPL (HttpRadioCommandRequestHandler)
 
 
+/**
+ * State of a batch upload, kept between the body chunks
+ */
+struct BATCH_UPLOAD
+{
+	ccPacketBatchParser			parser;
+	ccPacketStorageTransaction	transaction;						// Rolled back if deleted before commit
+	StreamString				status;								// One "$line $id OK|$error" line per item
+	CCPACKET_META				meta;								// Upload time, frequency and profile of the radio replaying them
+};
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool RadioTaskRunner :: requestScan (uint8_t first, uint8_t count)
+{
+	if ((count == 0) || (CCSCANNER_MAX_CHANNELS < count) || (first + count > 256)) return false;
+
+	_scanFirst		= first;
+	_scanCount		= count;
+	_isScanPending	= true;
+	return true;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void RadioTaskRunner :: setup ()
+{
+}
+
+//========================================================================================================================
+// The channels are calibrated again only when the range changes
+//========================================================================================================================
+void RadioTaskRunner :: requestFskDetection (uint32_t listenMs)
+{
+	_fskListenMs	= listenMs;
+	_isFskPending	= true;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool RadioTaskRunner :: isFskPending () const
+{
+	return _isFskPending || fskDetector.isRunning ();
+}
+
+//========================================================================================================================
+// One operation at a time: the FSK detection owns the radio until it is over
+//========================================================================================================================
+void RadioTaskRunner :: loop ()
+{
+	if (fskDetector.isRunning ()) {
+		fskDetector.loop ();
+		return;
+	}
+	if (_isFskPending) {
+		if (!fskDetector.start (_fskListenMs)) Logln (F("FSK detection not started"));
+		_isFskPending = false;
+		return;
+	}
+	if (_isScanPending) {
+		_isScanPending = false;
+		if ((spectrumScanner.getFirstChannel () != _scanFirst) || (spectrumScanner.size () != _scanCount)) {
+			if (!spectrumScanner.setRange (_scanFirst, _scanCount)) return;
+		}
+		spectrumScanner.sweep ();
+	}
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+static void storeBatchItem (BATCH_UPLOAD & batch)
+{
+	const ccPacketBatchParser & parser = batch.parser;
+
+	batch.status << parser.getLine () << F(" ") << parser.getId () << F(" ");
+
+	if (parser.getError () != CCPARSE_ERR_NONE) {
+		batch.status << ccPacketParser::getErrorMessage (parser.getError ()) << F(" at column ") << parser.getColumn () << LN;
+	}
+	else if ((parser.getNbErrors () > 0) || batch.transaction.isFailed ()) {
+		batch.status << F("OK (not stored)") << LN;					// Will be rolled back anyway
+	}
+	else if (batch.transaction.write (parser.getId (), parser.getPacket (), &batch.meta)) {
+		batch.status << F("OK") << LN;
+	}
+	else {
+		batch.status << F("Storage error") << LN;
+	}
+}
+
+
 //========================================================================================================================
 //
 //========================================================================================================================
@@ -156,9 +281,17 @@ void HttpRadioCommandRequestHandler :: handlePrint (AsyncWebServerRequest * requ
 	request->send (response);
 */
 
-	// This way of sending Json is great for when the result is below 4KB
-	AsyncResponseStream *response = request->beginResponseStream(F("text/plain"));
-	*response << I(ccReplayer).currentSignal();
+	char text [CCPACKET_TEXT_MAX_LEN];
+	size_t len = 0;
+
+	const ccPacketHandle & signal = I(ccReplayer).currentSignal ();
+	if (signal) {
+		len = ccPacketPrinter (*signal).format (text, sizeof (text));
+	}
+
+	// Response buffer sized to the exact text length
+	AsyncResponseStream *response = request->beginResponseStream(F("text/plain"), (len > 0) ? len : 1);
+	response->write ((const uint8_t *) text, len);
 	request->send(response);
 }
 
@@ -170,33 +303,94 @@ void HttpRadioCommandRequestHandler :: handleParseBody (AsyncWebServerRequest *
 	Logln(F("=> parse radio signal"));
 
 	// A revoir dans le cas de plusieurs connections en même temps..
-	static MemStream * memStream = NULL;
+	// The body chunks are parsed as they come, nothing is buffered. The memorized signal is replaced only by a complete
+	// packet: a malformatted or interrupted body leaves it untouched
+	static CCPACKET parsed;
+	static ccPacketParser parser (parsed);
+
+	if (index == 0) {																		// Body start
+		parser.reset ();
+	}
+
+	parser.feed (data, len);																// Stops at the packet end or on error
+
+	if (index + len == total) {																// Body end
+
+		// This way of sending Json is great for when the result is below 4KB
+		AsyncResponseStream *response = request->beginResponseStream(F("application/json"));
+		DynamicJsonBuffer jsonBuffer;
+		JsonObject& jsonRsp = jsonBuffer.createObject();
+
+		bool status = (parser.flush () == CCPARSE_DONE);
+		if (status) {
+			status = I(ccReplayer).setSignal (parsed);										// Not received: no meta
+		}
+
+		StreamString sstr;
+		sstr << parser;
+		jsonRsp["command"] = "parse";
+		jsonRsp["status"] = status;
+		jsonRsp["message"] = sstr.c_str();
+
+		jsonRsp.prettyPrintTo(*response);
+		request->send(response);
+	}
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void HttpRadioCommandRequestHandler :: handleBatchBody (AsyncWebServerRequest * request, uint8_t *data, size_t len, size_t index, size_t total)
+{
+	Logln(F("=> batch radio signals"));
+
+	// A revoir dans le cas de plusieurs connections en même temps..
+	static BATCH_UPLOAD * batch = NULL;
+	static uint32_t batchCount = 0;														// Identifies the upload of a connection
 
 	if (index == 0) {																		// Body start
-		memStream = new MemStream();
+		delete batch;																		// Previous upload interrupted
+		batch = new BATCH_UPLOAD ();
+		batchCount++;
+		batch->meta.timestampMs	= millis ();
+		batch->meta.frequencyHz	= cc1101Transceiver.getFrequencyHz ();
+		batch->meta.profile		= cc1101Transceiver.getProfile ();
+
+		// Client gone before the body end => the upload is rolled back and freed (unless another one replaced it)
+		uint32_t upload = batchCount;
+		request->onDisconnect ([upload] () {
+			if ((batch != NULL) && (batchCount == upload)) {
+				delete batch;
+				batch = NULL;
+			}
+		});
 	}
 
-	if (memStream != NULL) {
+	if (batch != NULL) {
 
-		memStream->write (data, len);
+		size_t pos = 0;
+		while (pos < len) {
+			pos += batch->parser.feed (data + pos, len - pos);								// Stops after each item
+			if (batch->parser.hasItem ()) storeBatchItem (*batch);
+		}
 
 		if (index + len == total) {															// Body end
 
-			// This way of sending Json is great for when the result is below 4KB
-			AsyncResponseStream *response = request->beginResponseStream(F("application/json"));
-			DynamicJsonBuffer jsonBuffer;
-			JsonObject& jsonRsp = jsonBuffer.createObject();
+			batch->parser.flush ();
+			if (batch->parser.hasItem ()) storeBatchItem (*batch);
 
-			StreamString sstr;
-			jsonRsp["command"] = "parse";
-			jsonRsp["status"] = I(ccReplayer).currentSignal().parse (*memStream, sstr);
-			jsonRsp["message"] = sstr.c_str();
+			bool isCommitted = (batch->parser.getNbErrors () == 0) && batch->transaction.commit ();
+			if (isCommitted)
+				batch->status << F("COMMIT ") << batch->parser.getNbItems () << LN;
+			else
+				batch->status << F("ROLLBACK") << LN;
 
-			jsonRsp.prettyPrintTo(*response);
+			AsyncResponseStream *response = request->beginResponseStream(F("text/plain"), batch->status.length () + 1);
+			response->print (batch->status);
 			request->send(response);
 
-			delete memStream;
-			memStream = NULL;
+			delete batch;
+			batch = NULL;
 		}
 	}
 }
@@ -288,6 +482,43 @@ void HttpRadioCommandRequestHandler :: handleLoad (AsyncWebServerRequest * reque
 	request->send(response);
 }
 
+//========================================================================================================================
+//
+//========================================================================================================================
+void HttpRadioCommandRequestHandler :: handleReplay (AsyncWebServerRequest * request)
+{
+	Logln(F("=> replay radio signal"));
+
+	if (!request->hasArg("json")) {
+		request->send(400, F("text/plain"), F("400: json argument not found"));				// The request is invalid, so send HTTP status 400
+		return;
+	}
+
+	StaticJsonBuffer<256> jsonBuffer;														// No heap allocation
+	JsonObject& jsonArg = jsonBuffer.parse(request->arg("json"));
+
+	// Test if parsing succeeds.
+	if (!jsonArg.success()) {
+		request->send(400, F("text/plain"), F("400: Invalid json argument"));
+		return;
+	}
+
+	if (!jsonArg ["id"].success()) {
+		request->send(400, F("text/plain"), F("400: Invalid json field"));
+		return;
+	}
+
+	int fileId = jsonArg ["id"];
+	if ((fileId <= 0) || (255 < fileId)) {
+		request->send(400, F("text/plain"), F("400: Invalid id argument"));
+		return;
+	}
+
+	AsyncResponseStream * response = request->beginResponseStream(F("text/plain"));
+	I(ccReplayer).replaySignal (&cc1101Transceiver, *response, fileId);
+	request->send(response);
+}
+
 //========================================================================================================================
 //
 //========================================================================================================================
@@ -350,11 +581,249 @@ void HttpRadioCommandRequestHandler :: handlePrintIdList (AsyncWebServerRequest
 	request->send(response);
 }
 
+//========================================================================================================================
+//
+//========================================================================================================================
+void HttpRadioCommandRequestHandler :: handleExport (AsyncWebServerRequest * request)
+{
+	Logln(F("=> export"));
+
+	// One stored packet read per chunk: the response never buffers the whole batch
+	std::shared_ptr <ccPacketStorageExporter> exporter = std::make_shared <ccPacketStorageExporter> ();
+
+	AsyncWebServerResponse *response = request->beginChunkedResponse(F("application/octet-stream"),
+		[exporter] (uint8_t * buffer, size_t maxLen, size_t index) -> size_t {
+			return exporter->read (buffer, maxLen);
+		});
+	request->send(response);
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void HttpRadioCommandRequestHandler :: handlePrintAll (AsyncWebServerRequest * request)
+{
+	Logln(F("=> print all radio signals"));
+
+	AsyncResponseStream *response = request->beginResponseStream(F("text/plain"));
+	I(ccPacketStorage).printAll (*response);
+	request->send(response);
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void HttpRadioCommandRequestHandler :: handleScan (AsyncWebServerRequest * request)
+{
+	Logln(F("=> scan"));
+
+	uint8_t first = spectrumScanner.getFirstChannel ();
+	uint8_t count = (spectrumScanner.size () > 0) ? spectrumScanner.size () : CCSCANNER_MAX_CHANNELS;
+
+	if (request->hasArg("json")) {
+
+		DynamicJsonBuffer jsonBuffer;
+		JsonObject& jsonArg = jsonBuffer.parse(request->arg("json"));
+
+		// Test if parsing succeeds.
+		if (!jsonArg.success()) {
+			request->send(400, F("text/plain"), F("400: Invalid json argument"));
+			return;
+		}
+
+		if (!jsonArg ["first"].success() || !jsonArg ["count"].success()) {
+			request->send(400, F("text/plain"), F("400: Invalid json field"));
+			return;
+		}
+
+		first = jsonArg ["first"];
+		count = jsonArg ["count"];
+	}
+
+	// The sweep runs in the loop: the result of the previous sweep is sent
+	if (!I(RadioTaskRunner).requestScan (first, count)) {
+		request->send(400, F("text/plain"), F("400: Invalid channels range"));
+		return;
+	}
+
+	// This way of sending Json is great for when the result is below 4KB
+	AsyncResponseStream *response = request->beginResponseStream(F("text/plain"));
+	*response << F("sweepPending ") << I(RadioTaskRunner).isScanPending () << LN;
+	*response << spectrumScanner;
+	request->send(response);
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void HttpRadioCommandRequestHandler :: handleFlex (AsyncWebServerRequest * request)
+{
+	Logln(F("=> flex"));
+
+	if (request->hasArg("json")) {
+
+		DynamicJsonBuffer jsonBuffer;
+		JsonObject& jsonArg = jsonBuffer.parse(request->arg("json"));
+
+		// Test if parsing succeeds.
+		if (!jsonArg.success()) {
+			request->send(400, F("text/plain"), F("400: Invalid json argument"));
+			return;
+		}
+
+		// This way of sending Json is great for when the result is below 4KB
+		AsyncResponseStream * response = request->beginResponseStream(F("application/json"));
+		JsonObject& jsonRsp = jsonBuffer.createObject();
+
+		StreamString sstr;
+		jsonRsp["command"] = "flex";
+
+		if (jsonArg ["spec"].success()) {
+			jsonRsp["status"] = flexDecoders.add (jsonArg ["spec"].as<const char *>(), sstr);
+		}
+		else if (jsonArg ["remove"].success()) {
+			jsonRsp["status"] = flexDecoders.remove (jsonArg ["remove"].as<const char *>());
+		}
+		else {
+			jsonRsp["status"] = false;
+		}
+		jsonRsp["message"] = sstr.c_str();
+
+		jsonRsp.prettyPrintTo(*response);
+		request->send(response);
+		return;
+	}
+
+	// This way of sending Json is great for when the result is below 4KB
+	AsyncResponseStream *response = request->beginResponseStream(F("text/plain"));
+	*response << flexDecoders;
+	request->send(response);
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void HttpRadioCommandRequestHandler :: handleFsk (AsyncWebServerRequest * request)
+{
+	Logln(F("=> fsk"));
+
+	if (request->hasArg("json")) {
+
+		DynamicJsonBuffer jsonBuffer;
+		JsonObject& jsonArg = jsonBuffer.parse(request->arg("json"));
+
+		// Test if parsing succeeds.
+		if (!jsonArg.success()) {
+			request->send(400, F("text/plain"), F("400: Invalid json argument"));
+			return;
+		}
+
+		uint32_t listenMs = jsonArg ["listenMs"].success() ? jsonArg ["listenMs"].as<uint32_t>() : CCDETECT_DEFAULT_LISTEN_MS;
+
+		if (I(RadioTaskRunner).isFskPending ()) {
+			request->send(409, F("text/plain"), F("409: Detection in progress"));
+			return;
+		}
+		I(RadioTaskRunner).requestFskDetection (listenMs);
+	}
+
+	// This way of sending Json is great for when the result is below 4KB
+	AsyncResponseStream *response = request->beginResponseStream(F("text/plain"));
+	*response << F("detectionPending ") << I(RadioTaskRunner).isFskPending () << LN;
+	*response << F("detected ") << fskDetector.isDetected () << LN;
+	*response << fskDetector;
+	request->send(response);
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void HttpRadioCommandRequestHandler :: handleDecoders (AsyncWebServerRequest * request)
+{
+	Logln(F("=> decoders"));
+
+	// This way of sending Json is great for when the result is below 4KB
+	AsyncResponseStream *response = request->beginResponseStream(F("text/plain"));
+	*response << decoderRegistry;
+	request->send(response);
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void HttpRadioCommandRequestHandler :: handlePool (AsyncWebServerRequest * request)
+{
+	Logln(F("=> pool"));
+
+	AsyncResponseStream *response = request->beginResponseStream(F("text/plain"));
+	*response << I(ccPacketPool);
+	*response << F("rxQueued ")		<< cc1101Transceiver.getRxQueue ().size ()			<< LN;
+	*response << F("rxHighWater ")	<< cc1101Transceiver.getRxQueue ().getHighWater ()	<< LN;
+	*response << F("rxDropped ")	<< cc1101Transceiver.getRxQueue ().getNbDropped ()	<< LN;
+	*response << F("txQueued ")		<< cc1101Transceiver.getTxQueue ().size ()			<< LN;
+	*response << F("txHighWater ")	<< cc1101Transceiver.getTxQueue ().getHighWater ()	<< LN;
+	*response << F("txDropped ")	<< cc1101Transceiver.getTxQueue ().getNbDropped ()	<< LN;
+	request->send(response);
+}
+
+//========================================================================================================================
+// Cycles of the software packet engine over a 1 KB buffer (CPU cycle counter, interrupts enabled)
+//========================================================================================================================
+void HttpRadioCommandRequestHandler :: handleBench (AsyncWebServerRequest * request)
+{
+	Logln(F("=> bench"));
+
+	static uint8_t buffer [1024];
+	for (size_t i = 0; i < sizeof (buffer); i++) buffer [i] = i * 167 + 13;
+
+	uint32_t cycles [4];
+	volatile uint16_t sink;
+
+	uint32_t start = ESP.getCycleCount ();
+	uint16_t crc = CCCRC16_INIT;
+	for (uint8_t c : buffer) crc = ccCrc16::updateBitwise (crc, c);
+	sink = crc;
+	cycles [0] = ESP.getCycleCount () - start;
+
+	start = ESP.getCycleCount ();
+	ccCrc16 crcTable;
+	for (uint8_t c : buffer) crcTable.update (c);
+	sink = crcTable.get ();
+	cycles [1] = ESP.getCycleCount () - start;
+
+	start = ESP.getCycleCount ();
+	sink = ccCrc16::compute (buffer, sizeof (buffer));
+	cycles [2] = ESP.getCycleCount () - start;
+
+	start = ESP.getCycleCount ();
+	ccPn9Whitening whitening;
+	whitening.apply (buffer, sizeof (buffer));
+	cycles [3] = ESP.getCycleCount () - start;
+	(void) sink;
+
+	AsyncResponseStream *response = request->beginResponseStream(F("text/plain"));
+	*response << F("crcBitwise ")	<< sizeof (buffer) << F(" ") << cycles [0] << LN;
+	*response << F("crcTable ")		<< sizeof (buffer) << F(" ") << cycles [1] << LN;
+	*response << F("crcSlice4 ")	<< sizeof (buffer) << F(" ") << cycles [2] << LN;
+	*response << F("pn9 ")			<< sizeof (buffer) << F(" ") << cycles [3] << LN;
+	request->send(response);
+}
+
 //========================================================================================================================
 //
 //========================================================================================================================
 void HttpRadioCommandRequestHandler :: setup (AsyncWebServer & asyncWebServer)
 {
+	I(ccPacketStorage).recover ();													// Batch upload interrupted by a reset
+	cc1101Transceiver.setDuplicateFilterWindow (CCPACKET_DEDUP_WINDOW_MS);		// The Tybox remotes repeat each command
+
+	decoderRegistry.add		(&x2dDecoder);
+	decoderRegistry.attach	(cc1101Transceiver);
+	decoderRegistry.attach	(flexDecoders);
+	decoderRegistry.subscribe <X2D_EVENT> ([] (const X2D_EVENT & event) {
+		Logln (event);
+	});
+
 	asyncWebServer.on("/radio/help",		std::bind(&HttpRadioCommandRequestHandler::handleHelp,			this, _1));
 	asyncWebServer.on("/radio/record",		std::bind(&HttpRadioCommandRequestHandler::handleRecord,		this, _1));
 	asyncWebServer.on("/radio/emmit",		std::bind(&HttpRadioCommandRequestHandler::handleEmmit,			this, _1));
@@ -362,8 +831,18 @@ void HttpRadioCommandRequestHandler :: setup (AsyncWebServer & asyncWebServer)
 	asyncWebServer.on("/radio/parse",		HTTP_ANY, [](AsyncWebServerRequest *request) {/* nothing and dont remove it */}, NULL, std::bind(&HttpRadioCommandRequestHandler::handleParseBody, this, _1, _2, _3, _4, _5));
 	asyncWebServer.on("/radio/store",		std::bind(&HttpRadioCommandRequestHandler::handleStore,			this, _1));
 	asyncWebServer.on("/radio/load",		std::bind(&HttpRadioCommandRequestHandler::handleLoad,			this, _1));
+	asyncWebServer.on("/radio/replay",		std::bind(&HttpRadioCommandRequestHandler::handleReplay,		this, _1));
 	asyncWebServer.on("/radio/delete",		std::bind(&HttpRadioCommandRequestHandler::handleDelete,		this, _1));
 	asyncWebServer.on("/radio/idlist",		std::bind(&HttpRadioCommandRequestHandler::handlePrintIdList,	this, _1));
+	asyncWebServer.on("/radio/export",		std::bind(&HttpRadioCommandRequestHandler::handleExport,		this, _1));
+	asyncWebServer.on("/radio/batch",		HTTP_ANY, [](AsyncWebServerRequest *request) {/* nothing and dont remove it */}, NULL, std::bind(&HttpRadioCommandRequestHandler::handleBatchBody, this, _1, _2, _3, _4, _5));
+	asyncWebServer.on("/radio/printall",	std::bind(&HttpRadioCommandRequestHandler::handlePrintAll,		this, _1));
+	asyncWebServer.on("/radio/scan",		std::bind(&HttpRadioCommandRequestHandler::handleScan,			this, _1));
+	asyncWebServer.on("/radio/flex",		std::bind(&HttpRadioCommandRequestHandler::handleFlex,			this, _1));
+	asyncWebServer.on("/radio/fsk",			std::bind(&HttpRadioCommandRequestHandler::handleFsk,			this, _1));
+	asyncWebServer.on("/radio/decoders",	std::bind(&HttpRadioCommandRequestHandler::handleDecoders,		this, _1));
+	asyncWebServer.on("/radio/pool",		std::bind(&HttpRadioCommandRequestHandler::handlePool,			this, _1));
+	asyncWebServer.on("/radio/bench",		std::bind(&HttpRadioCommandRequestHandler::handleBench,			this, _1));
 }
 
 
@@ -14,6 +14,34 @@
 
 namespace wifix {
 
+//------------------------------------------------------------------------------
+// Long radio operations (sweeps) requested by HTTP and run from the loop: the AsyncWebServer callbacks run in the
+// TCP task and must not block
+class RadioTaskRunner : public Module <>
+{
+	SINGLETON_CLASS (RadioTaskRunner)
+
+private:
+
+	bool		_isScanPending		= false;
+	uint8_t		_scanFirst			= 0;
+	uint8_t		_scanCount			= 0;
+
+	bool		_isFskPending		= false;
+	uint32_t	_fskListenMs		= 0;
+
+public:
+
+	bool requestScan				(uint8_t first, uint8_t count);		// False if the range is invalid
+	bool isScanPending				() const					{ return _isScanPending; }
+
+	void requestFskDetection		(uint32_t listenMs);				// Candidate by candidate, one step per loop
+	bool isFskPending				() const;
+
+	void setup						() override;
+	void loop						() override;
+};
+
 //------------------------------------------------------------------------------
 //
 class HttpRadioCommandRequestHandler : public HttpRequestHandler
@@ -27,10 +55,20 @@ private:
 	void handleEmmit								(AsyncWebServerRequest * request);
 	void handlePrint								(AsyncWebServerRequest * request);
 	void handleParseBody							(AsyncWebServerRequest * request, uint8_t *data, size_t len, size_t index, size_t total);
+	void handleBatchBody							(AsyncWebServerRequest * request, uint8_t *data, size_t len, size_t index, size_t total);
 	void handleStore								(AsyncWebServerRequest * request);
 	void handleLoad									(AsyncWebServerRequest * request);
+	void handleReplay								(AsyncWebServerRequest * request);
 	void handleDelete								(AsyncWebServerRequest * request);
 	void handlePrintIdList							(AsyncWebServerRequest * request);
+	void handleExport								(AsyncWebServerRequest * request);
+	void handlePrintAll								(AsyncWebServerRequest * request);
+	void handleScan									(AsyncWebServerRequest * request);
+	void handleFlex									(AsyncWebServerRequest * request);
+	void handleFsk									(AsyncWebServerRequest * request);
+	void handleDecoders								(AsyncWebServerRequest * request);
+	void handlePool									(AsyncWebServerRequest * request);
+	void handleBench								(AsyncWebServerRequest * request);
 
 public:
 
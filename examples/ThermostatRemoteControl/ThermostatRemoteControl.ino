@@ -133,6 +133,7 @@ void setup() {
 		&I(OledDisplayThermostat),
 #ifdef USING_WIFI
 		&I(WiFiConnectionManager),
+		&I(RadioTaskRunner),
 #	ifdef USING_JSON_SMS_MESSAGE_SENDER
 		&I(SmsSenderRequestHandler),
 #	endif
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <ccX2dEncoder.h>
+
 
 	/*
 		================================================================
@@ -117,14 +119,23 @@
 
 
 
-	const uint8_t HEATING_ON_CMD [][16]		= { {0x55, 0x55, 0x7f, 0x36, 0x39, 0xaa, 0xa9, 0x55, 0x55, 0x15, 0xb7, 0x3f, 0x04, 0xff, 0xd5, 0x00},
+	constexpr uint8_t HEATING_ON_CMD [][16] PROGMEM	= { {0x55, 0x55, 0x7f, 0x36, 0x39, 0xaa, 0xa9, 0x55, 0x55, 0x15, 0xb7, 0x3f, 0x04, 0xff, 0xd5, 0x00},
 												{0x55, 0x55, 0x7f, 0x36, 0x39, 0xaa, 0xa9, 0x55, 0x2a, 0xea, 0x48, 0xc0, 0xc4, 0xff, 0xd5, 0x00},
 												{0x55, 0x55, 0x7f, 0x36, 0x39, 0xaa, 0xa9, 0x55, 0x6a, 0xea, 0xb7, 0x7e, 0x1b, 0x7f, 0xd5, 0x00} };
 
 
-	const uint8_t HEATING_OFF_CMD [][16]	= { {0x55, 0x55, 0x7f, 0x36, 0x39, 0xaa, 0xa9, 0x55, 0x55, 0x55, 0xb7, 0x3f, 0x33, 0x00, 0x2a, 0x80},
+	constexpr uint8_t HEATING_OFF_CMD [][16] PROGMEM	= { {0x55, 0x55, 0x7f, 0x36, 0x39, 0xaa, 0xa9, 0x55, 0x55, 0x55, 0xb7, 0x3f, 0x33, 0x00, 0x2a, 0x80},
 												{0x55, 0x55, 0x7f, 0x36, 0x39, 0xaa, 0xa9, 0x55, 0x2a, 0xaa, 0x48, 0xc0, 0xec, 0xff, 0xd5, 0x00},
 												{0x55, 0x55, 0x7f, 0x36, 0x39, 0xaa, 0xa9, 0x55, 0x6a, 0xaa, 0xb7, 0x7e, 0x2c, 0x80, 0x2a, 0x80} };
 
 
+	// Same frames generated from the X2D fields (payload "a5 ad 00 20 00 $seq $cmd 64"): another house code only needs
+	// another TYBOX_X2D_FIELDS
+	constexpr cc1101::X2D_FIELDS TYBOX_X2D_FIELDS = { 0xA5AD };
 
+	static_assert (cc1101::ccX2dEncoder::encode (TYBOX_X2D_FIELDS, X2D_CMD_HEATING_ON, 0)	== HEATING_ON_CMD [0],	"X2D encoder mismatch");
+	static_assert (cc1101::ccX2dEncoder::encode (TYBOX_X2D_FIELDS, X2D_CMD_HEATING_ON, 1)	== HEATING_ON_CMD [1],	"X2D encoder mismatch");
+	static_assert (cc1101::ccX2dEncoder::encode (TYBOX_X2D_FIELDS, X2D_CMD_HEATING_ON, 2)	== HEATING_ON_CMD [2],	"X2D encoder mismatch");
+	static_assert (cc1101::ccX2dEncoder::encode (TYBOX_X2D_FIELDS, X2D_CMD_HEATING_OFF, 0)	== HEATING_OFF_CMD [0],	"X2D encoder mismatch");
+	static_assert (cc1101::ccX2dEncoder::encode (TYBOX_X2D_FIELDS, X2D_CMD_HEATING_OFF, 1)	== HEATING_OFF_CMD [1],	"X2D encoder mismatch");
+	static_assert (cc1101::ccX2dEncoder::encode (TYBOX_X2D_FIELDS, X2D_CMD_HEATING_OFF, 2)	== HEATING_OFF_CMD [2],	"X2D encoder mismatch");
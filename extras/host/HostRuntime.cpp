@@ -0,0 +1,113 @@
+//************************************************************************************************************************
+// HostRuntime.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+// Host (Linux) definitions of the Arduino / ESP8266 / corex functions used by the library: no radio, a settable clock
+// and an in-memory file system
+
+#include <Common.h>
+#include <SPI.h>
+
+#include <cc1101.h>
+
+#include "HostRuntime.h"
+
+unsigned long	hostMillis		= 0;
+uint8_t			(*hostSpiTransfer) (uint8_t)	= nullptr;
+void			(*hostYield) ()					= nullptr;
+timercallback	hostTimer1Isr					= nullptr;
+unsigned long	hostMicros		= 0;
+
+volatile uint32_t	hostGpos	= 0;
+volatile uint32_t	hostGpoc	= 0;
+
+MemFs			memFs;
+FS				LittleFS;
+EspClass		ESP;
+SPIClass		SPI;
+
+unsigned long millis ()								{ return hostMillis; }
+unsigned long micros ()								{ return hostMicros; }
+void delay (unsigned long ms)						{ hostMillis += ms; hostMicros += ms * 1000; }
+void delayMicroseconds (unsigned int us)			{ hostMicros += us; }
+void yield ()										{ if (hostYield) hostYield (); }
+
+static int16_t	hostSpiHeader	= -1;				// Header byte of the current access, -1 if none
+
+void digitalWrite (uint8_t pin, uint8_t value)		{ if ((pin == SS) && (value == HIGH)) hostSpiHeader = -1; }
+int digitalRead (uint8_t)							{ return LOW; }
+void pinMode (uint8_t, uint8_t)						{}
+void attachInterrupt (uint8_t, void (*) (), int)	{}
+void detachInterrupt (uint8_t)						{}
+void noInterrupts ()								{}
+void interrupts ()									{}
+long random (long min, long max)					{ return min + rand () % (max - min); }
+long random (long max)								{ return rand () % max; }
+uint32_t ESP_getCycleCount ()						{ return 0; }
+
+void timer1_isr_init ()								{}
+void timer1_enable (uint8_t, uint8_t, uint8_t)		{}
+void timer1_disable ()								{}
+void timer1_attachInterrupt (timercallback isr)		{ hostTimer1Isr = isr; }
+void timer1_detachInterrupt ()						{ hostTimer1Isr = nullptr; }
+void timer1_write (uint32_t)						{}
+
+void SPIClass :: begin ()							{}
+void SPIClass :: end ()								{}
+void SPIClass :: endTransaction ()					{}
+uint8_t SPIClass :: transfer (uint8_t c)			{ return hostSpiTransfer ? hostSpiTransfer (c) : 0; }
+
+uint8_t					hostRegisters [0x40];
+std::vector <uint8_t>	hostStrobes;
+
+uint8_t hostRegisterFile (uint8_t mosi)
+{
+	static uint8_t address = 0;
+
+	if (hostSpiHeader < 0) {
+		address = mosi & 0x3F;
+		if (!(mosi & WRITE_BURST) && (address >= CC1101_SRES) && (address <= CC1101_SNOP)) {
+			hostStrobes.push_back (address);
+			switch (address) {
+				case CC1101_SIDLE:
+				case CC1101_SCAL:	hostRegisters [CC1101_MARCSTATE] = cc1101::CC_MARCSTATE_IDLE;	break;
+				case CC1101_SRX:	hostRegisters [CC1101_MARCSTATE] = cc1101::CC_MARCSTATE_RX;		break;
+				case CC1101_STX:	hostRegisters [CC1101_MARCSTATE] = cc1101::CC_MARCSTATE_TX;		break;
+			}
+			return 0;
+		}
+		hostSpiHeader = mosi;
+		return 0;
+	}
+
+	uint8_t miso = 0;
+	if (hostSpiHeader & READ_SINGLE_BYTE)	miso = hostRegisters [address];
+	else									hostRegisters [address] = mosi;
+
+	if (!(hostSpiHeader & WRITE_BURST))	hostSpiHeader = -1;
+	else if (address < CC1101_PATABLE)	address++;				// PATABLE and FIFO accesses stay on their address
+	return miso;
+}
+
+namespace corex {
+
+String n2hexstr (uint8_t v)							{ char b [3]; snprintf (b, 3, "%02X", v); return String (b); }
+
+namespace StreamParser {
+bool checkNextStrInStream (Stream &, const char *)	{ return false; }
+uint8_t hexstr2Int (Stream &)						{ return 0; }
+}
+
+namespace EspBoard {
+void asyncDelayMillis (unsigned long ms)			{ delay (ms); }
+void blinks (int)									{}
+}
+
+namespace FileStorage {
+bool spiffsCheckRemainingBytes ()					{ return true; }
+void spiffsInfos ()									{}
+void spiffsListFiles ()								{}
+}
+
+}
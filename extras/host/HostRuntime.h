@@ -0,0 +1,99 @@
+//************************************************************************************************************************
+// HostRuntime.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include <stdio.h>
+#include <chrono>
+#include <string>
+
+#include <Common.h>
+
+#if defined (__x86_64__) || defined (__i386__)
+#	include <x86intrin.h>
+#endif
+
+extern unsigned long	hostMillis;							// millis () value, set by the tests
+extern unsigned long	hostMicros;
+extern uint8_t			(*hostSpiTransfer) (uint8_t);		// MISO byte of each SPI transfer (0 if nullptr)
+extern void				(*hostYield) ();					// Called by yield () (nothing if nullptr)
+extern timercallback	hostTimer1Isr;						// Attached timer1 interrupt, called by the tests
+
+extern int				hostNbFailures;
+
+/**
+ * CC1101 model behind the SPI (hostSpiTransfer = hostRegisterFile): the config registers written are read back, the
+ * status registers return hostRegisters [address], the strobes are recorded and SIDLE / SCAL / SRX / STX update
+ * MARCSTATE. Deselecting the chip (SS high) ends a burst access
+ */
+extern uint8_t				hostRegisters [0x40];
+extern std::vector <uint8_t>	hostStrobes;
+
+uint8_t hostRegisterFile	(uint8_t mosi);
+
+#define CHECK(cond)		do { if (!(cond)) { printf ("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); hostNbFailures++; } } while (0)
+
+/**
+ * Print capturing the output in a string
+ */
+struct HostPrint : public Print
+{
+	std::string	str;
+
+	virtual size_t write (uint8_t c) override { str += (char) c; return 1; }
+	using Print::write;
+};
+
+/**
+ * Host clock for the benchmarks: TSC cycles on x86 (0 elsewhere) and nanoseconds
+ */
+struct HOST_TIME
+{
+	uint64_t	cycles;
+	uint64_t	ns;
+
+	static HOST_TIME now ()
+	{
+		HOST_TIME t;
+#if defined (__x86_64__) || defined (__i386__)
+		t.cycles = __rdtsc ();
+#else
+		t.cycles = 0;
+#endif
+		t.ns = std::chrono::duration_cast <std::chrono::nanoseconds> (std::chrono::steady_clock::now ().time_since_epoch ()).count ();
+		return t;
+	}
+};
+
+/**
+ * Runs fn nbRuns times and prints one "name nsPerRun bytesPerCycle" line (bytes = bytes processed per run, 0 if none)
+ */
+template <typename F>
+void hostBench (const char * name, uint32_t nbRuns, size_t bytes, F fn)
+{
+	HOST_TIME start = HOST_TIME::now ();
+	for (uint32_t i = 0; i < nbRuns; i++) fn ();
+	HOST_TIME end = HOST_TIME::now ();
+
+	double ns		= (double) (end.ns - start.ns) / nbRuns;
+	double cycles	= (double) (end.cycles - start.cycles) / nbRuns;
+	if (bytes > 0 && cycles > 0)	printf ("bench %-28s %10.1f ns %8.3f bytes/cycle\n", name, ns, bytes / cycles);
+	else							printf ("bench %-28s %10.1f ns\n", name, ns);
+}
+
+/**
+ * Test main: returns the number of failed checks
+ */
+#define HOST_TEST_MAIN(...)  												\
+	int hostNbFailures = 0;													\
+	int main (int argc, char ** argv)										\
+	{																		\
+		bool isBench = (argc > 1) && (strcmp (argv [1], "bench") == 0);	\
+		(void) isBench;														\
+		__VA_ARGS__														\
+		printf ("%s: %d failure(s)\n", argv [0], hostNbFailures);			\
+		return hostNbFailures != 0;											\
+	}
@@ -0,0 +1,218 @@
+//************************************************************************************************************************
+// Arduino.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+// Host stub of the Arduino / ESP8266 core API used by the library
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <algorithm>
+#include <functional>
+#include <string>
+
+
+typedef uint8_t byte;
+
+#define PROGMEM
+#define IRAM_ATTR
+#define ICACHE_RAM_ATTR
+
+#define HIGH						1
+#define LOW							0
+#define INPUT						0
+#define OUTPUT						1
+#define RISING						1
+#define FALLING						2
+#define CHANGE						3
+
+#define SS							15
+#define SCK							14
+#define MOSI						13
+#define MISO						12
+
+#define DEC							10
+#define HEX							16
+
+#define bitRead(value, bit)			(((value) >> (bit)) & 0x01)
+
+#define pgm_read_byte(a)			(*(const uint8_t *) (a))
+#define pgm_read_word(a)			(*(const uint16_t *) (a))
+#define pgm_read_dword(a)			(*(const uint32_t *) (a))
+#define memcpy_P					memcpy
+#define strlen_P					strlen
+#define PSTR(s)						(s)
+#define PGM_P						const char *
+
+#define digitalPinToInterrupt(p)	(p)
+
+class __FlashStringHelper;
+#define F(s)						(reinterpret_cast <const __FlashStringHelper *> (s))
+#define FPSTR(s)					(reinterpret_cast <const __FlashStringHelper *> (s))
+
+
+/**
+ * Arduino String on a std::string
+ */
+class String
+{
+public:
+
+	std::string s;
+
+	String							() {}
+	String							(const char * c)						: s (c ? c : "") {}
+	String							(const __FlashStringHelper * f)			: s ((const char *) f) {}
+	String							(int v, int base = 10)					{ char t [24]; snprintf (t, sizeof (t), (base == 16) ? "%x" : "%d", v); s = t; }
+	String							(unsigned v, int base = 10)				{ char t [24]; snprintf (t, sizeof (t), (base == 16) ? "%x" : "%u", v); s = t; }
+	String							(long v, int base = 10)					: String ((int) v, base) {}
+	String							(unsigned long v, int base = 10)		: String ((unsigned) v, base) {}
+
+	String & operator +=			(const String & o)						{ s += o.s; return *this; }
+	String & operator +=			(const char * c)						{ s += c; return *this; }
+	String & operator +=			(char c)								{ s += c; return *this; }
+	String & operator +=			(int v)									{ return *this += String (v); }
+	String & operator +=			(unsigned v)							{ return *this += String (v); }
+	String & operator +=			(const __FlashStringHelper * f)			{ s += (const char *) f; return *this; }
+
+	String operator +				(const String & o) const				{ String r = *this; r += o; return r; }
+	friend String operator +		(const char * c, const String & o)		{ String r (c); r += o; return r; }
+	bool operator ==				(const String & o) const				{ return s == o.s; }
+	char operator []				(unsigned i) const						{ return (i < s.size ()) ? s [i] : 0; }
+
+	int indexOf						(const String & o) const				{ size_t i = s.find (o.s); return (i == std::string::npos) ? -1 : (int) i; }
+	String substring				(int from, int to = -1) const			{ String r; r.s = s.substr (from, (to < 0) ? std::string::npos : to - from); return r; }
+	unsigned length					() const								{ return s.size (); }
+	const char * c_str				() const								{ return s.c_str (); }
+	int toInt						() const								{ return atoi (s.c_str ()); }
+	void trim						()										{}
+	void toUpperCase				()										{ for (char & c : s) c = toupper (c); }
+	bool reserve					(unsigned n)							{ s.reserve (n); return true; }
+};
+
+
+class Printable;
+
+/**
+ * Print: every print goes through write ()
+ */
+class Print
+{
+public:
+
+	virtual ~Print					() {}
+
+	virtual size_t write			(uint8_t) = 0;
+	virtual size_t write			(const uint8_t * buffer, size_t size)	{ size_t n = 0; while (size--) n += write (*buffer++); return n; }
+	size_t write					(const char * str)						{ return write ((const uint8_t *) str, strlen (str)); }
+
+	virtual int availableForWrite	()										{ return 0; }
+	virtual void flush				()										{}
+
+	size_t print					(const Printable & x);
+	size_t print					(const char * str)						{ return write (str); }
+	size_t print					(const __FlashStringHelper * f)			{ return write ((const char *) f); }
+	size_t print					(const String & str)					{ return write (str.c_str ()); }
+	size_t print					(char c)								{ return write ((uint8_t) c); }
+	size_t print					(int v)									{ char b [16]; snprintf (b, sizeof (b), "%d", v); return write (b); }
+	size_t print					(unsigned v)							{ char b [16]; snprintf (b, sizeof (b), "%u", v); return write (b); }
+	size_t print					(long v)								{ char b [24]; snprintf (b, sizeof (b), "%ld", v); return write (b); }
+	size_t print					(unsigned long v)						{ char b [24]; snprintf (b, sizeof (b), "%lu", v); return write (b); }
+	size_t print					(double)								{ return 0; }
+	size_t print					(unsigned v, int base)					{ char b [16]; snprintf (b, sizeof (b), (base == 16) ? "%X" : "%u", v); return write (b); }
+	size_t print					(int v, int base)						{ return print ((unsigned) v, base); }
+	size_t println					()										{ return 0; }
+};
+
+class Printable
+{
+public:
+
+	virtual ~Printable				() {}
+
+	virtual size_t printTo			(Print &) const = 0;
+};
+
+inline size_t Print :: print (const Printable & x)							{ return x.printTo (*this); }
+
+class Stream : public Print
+{
+public:
+
+	virtual int available			() = 0;
+	virtual int read				() = 0;
+	virtual int peek				() = 0;
+
+	long parseInt					()										{ return 0; }
+	size_t readBytes				(char *, size_t n)						{ return n; }
+	size_t readBytes				(uint8_t *, size_t n)					{ return n; }
+	void setTimeout					(unsigned long)							{}
+};
+
+
+// Time, GPIO and interrupts (HostRuntime.cpp)
+unsigned long millis				();
+unsigned long micros				();
+void delay							(unsigned long ms);
+void delayMicroseconds				(unsigned int us);
+void yield							();
+
+void digitalWrite					(uint8_t pin, uint8_t value);
+int digitalRead						(uint8_t pin);
+void pinMode						(uint8_t pin, uint8_t mode);
+void attachInterrupt				(uint8_t pin, void (*isr) (), int mode);
+void detachInterrupt				(uint8_t pin);
+void noInterrupts					();
+void interrupts						();
+
+long random							(long min, long max);
+long random							(long max);
+
+uint32_t ESP_getCycleCount			();
+#define ESP_getCycleCount			ESP_getCycleCount
+
+namespace esp8266 {}
+
+class EspClass
+{
+public:
+
+	uint32_t getCycleCount			()										{ return 0; }
+	uint32_t getFreeHeap			()										{ return 0; }
+	uint32_t getFreeContStack		()										{ return 0; }
+	uint8_t getHeapFragmentation	()										{ return 0; }
+};
+
+extern EspClass ESP;
+
+
+// Timer1
+#define TIM_DIV1					0
+#define TIM_DIV16					1
+#define TIM_DIV256					3
+#define TIM_EDGE					0
+#define TIM_LOOP					1
+#define TIM_SINGLE					0
+
+typedef void (*timercallback) (void);
+
+void timer1_isr_init				(void);
+void timer1_enable					(uint8_t divider, uint8_t interruptType, uint8_t reload);
+void timer1_disable					(void);
+void timer1_attachInterrupt			(timercallback userFunc);
+void timer1_detachInterrupt			(void);
+void timer1_write					(uint32_t ticks);
+
+
+// GPIO output set / clear registers: the last value written stays readable by the tests
+extern volatile uint32_t			hostGpos;
+extern volatile uint32_t			hostGpoc;
+
+#define GPOS						hostGpos
+#define GPOC						hostGpoc
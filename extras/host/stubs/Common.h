@@ -0,0 +1,221 @@
+//************************************************************************************************************************
+// Common.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+// Host stub of the corex library and of LittleFS (in-memory file system)
+
+#pragma once
+
+#include <list>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <Arduino.h>
+
+
+#define LN							"\n"
+#define MSG_SEPARATOR_PARAM			String (",")
+
+
+/**
+ * In-memory files, with failures injected by the tests
+ */
+struct MemFs
+{
+	std::map <std::string, std::string>	files;
+
+	int		failRename				= 0;							// Number of next renames failing
+	int		failRenameAfter			= -1;							// The rename after n successful ones fails once (-1 = never)
+	int		failWriteAfter			= -1;							// The writes fail after n successful ones (-1 = never)
+};
+
+extern MemFs memFs;
+
+/**
+ * Opened file: a copy of the content, stored back on close when written
+ */
+class File : public Stream
+{
+public:
+
+	std::shared_ptr <std::string>	buf;
+	std::string						name;
+	bool							wr		= false;
+	size_t							pos		= 0;
+
+	operator bool					() const								{ return (bool) buf; }
+
+	virtual size_t write			(uint8_t c) override					{ buf->push_back (c); return 1; }
+	virtual size_t write			(const uint8_t * b, size_t n) override
+	{
+		if (memFs.failWriteAfter == 0) return 0;
+		if (memFs.failWriteAfter > 0) memFs.failWriteAfter--;
+		buf->append ((const char *) b, n);
+		return n;
+	}
+
+	virtual int available			() override								{ return buf->size () - pos; }
+	virtual int read				() override								{ return (pos < buf->size ()) ? (uint8_t) (*buf) [pos++] : -1; }
+	virtual int peek				() override								{ return (pos < buf->size ()) ? (uint8_t) (*buf) [pos] : -1; }
+
+	size_t readBytes				(char * d, size_t n)
+	{
+		size_t k = std::min (n, buf->size () - pos);
+		memcpy (d, buf->data () + pos, k);
+		pos += k;
+		return k;
+	}
+
+	void close						()										{ if (wr) memFs.files [name] = *buf; }
+	size_t size						() const								{ return buf->size (); }
+	bool seek						(uint32_t p)							{ pos = p; return true; }
+	size_t position					() const								{ return pos; }
+};
+
+/**
+ * Directory listing: the file names when opened
+ */
+class Dir
+{
+public:
+
+	std::vector <std::string>		names;
+	size_t							i		= 0;
+	std::string						cur;
+
+	bool next						()										{ if (i >= names.size ()) return false; cur = names [i++]; return true; }
+	String fileName					()										{ return String (cur.c_str ()); }
+};
+
+class FS
+{
+public:
+
+	File open						(const String & n, const char * mode)
+	{
+		File f;
+		f.name = n.s;
+		if (mode [0] == 'w') {
+			f.wr	= true;
+			f.buf	= std::make_shared <std::string> ();
+		}
+		else {
+			auto it = memFs.files.find (n.s);
+			if (it != memFs.files.end ()) f.buf = std::make_shared <std::string> (it->second);
+		}
+		return f;
+	}
+
+	bool remove						(const String & n)						{ return memFs.files.erase (n.s) > 0; }
+	bool exists						(const String & n)						{ return memFs.files.count (n.s) > 0; }
+
+	Dir openDir						(const char *)
+	{
+		Dir d;
+		for (auto & file : memFs.files) d.names.push_back (file.first);
+		return d;
+	}
+
+	bool rename						(const String & from, const String & to)
+	{
+		if (memFs.failRename > 0) {
+			memFs.failRename--;
+			return false;
+		}
+		if (memFs.failRenameAfter == 0) {
+			memFs.failRenameAfter = -1;
+			return false;
+		}
+		if (memFs.failRenameAfter > 0) memFs.failRenameAfter--;
+
+		auto it = memFs.files.find (from.s);
+		if (it == memFs.files.end ()) return false;
+		memFs.files [to.s] = it->second;
+		memFs.files.erase (from.s);
+		return true;
+	}
+};
+
+extern FS LittleFS;
+
+
+namespace corex {
+
+template <typename T>
+Print & operator << (Print & p, const T & v)
+{
+	p.print (v);
+	return p;
+}
+
+template <typename... Args>
+class Signal
+{
+private:
+
+	std::vector <std::function <void (Args...)>>	_functions;
+
+public:
+
+	void operator ()				(Args... args)							{ for (auto & f : _functions) f (args...); }
+
+	template <class F>
+	Signal & operator +=			(F f)									{ _functions.push_back (f); return *this; }
+};
+
+template <typename... Args>
+class Module
+{
+public:
+
+	virtual void setup				(Args...) = 0;
+	virtual void loop				() = 0;
+};
+
+String n2hexstr						(uint8_t value);
+
+namespace StreamParser {
+bool checkNextStrInStream			(Stream & stream, const char * str);
+uint8_t hexstr2Int					(Stream & stream);
+}
+
+namespace EspBoard {
+void asyncDelayMillis				(unsigned long ms);
+void blinks							(int nbBlinks);
+}
+
+namespace FileStorage {
+bool spiffsCheckRemainingBytes		();
+void spiffsInfos					();
+void spiffsListFiles				();
+}
+
+class MemStream : public Stream
+{
+public:
+
+	virtual size_t write			(uint8_t) override						{ return 1; }
+	using Print::write;
+
+	virtual int available			() override								{ return 0; }
+	virtual int read				() override								{ return 0; }
+	virtual int peek				() override								{ return 0; }
+};
+
+class Logger : public Print
+{
+public:
+
+	virtual size_t write			(uint8_t) override						{ return 1; }
+};
+
+}
+
+#define Logln(x)					do { corex::Logger __logger; __logger << x; } while (0)
+#define Log(x)						do { corex::Logger __logger; __logger << x; } while (0)
+
+#define SINGLETON_CLASS(C)			public: static C & getInstance (); private: C () {}
+#define SINGLETON_IMPL(C)			C & C::getInstance () { static C c; return c; }
+#define I(C)						C::getInstance ()
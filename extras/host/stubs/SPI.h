@@ -0,0 +1,23 @@
+//************************************************************************************************************************
+// SPI.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+// Host stub of the SPI bus: the transfers go to hostSpiTransfer (HostRuntime.h)
+
+#pragma once
+
+#include <Arduino.h>
+
+
+class SPIClass
+{
+public:
+
+	void begin						();
+	void end						();
+	void endTransaction				();
+	uint8_t transfer				(uint8_t data);
+};
+
+extern SPIClass SPI;
@@ -0,0 +1,9 @@
+//************************************************************************************************************************
+// Stream.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include <Arduino.h>
@@ -0,0 +1,21 @@
+//************************************************************************************************************************
+// StreamString.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include <Arduino.h>
+
+
+class StreamString : public Stream, public String
+{
+public:
+
+	virtual size_t write			(uint8_t) override						{ return 1; }
+
+	virtual int available			() override								{ return 0; }
+	virtual int read				() override								{ return 0; }
+	virtual int peek				() override								{ return 0; }
+};
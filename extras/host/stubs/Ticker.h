@@ -0,0 +1,23 @@
+//************************************************************************************************************************
+// Ticker.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+// Host stub of the ESP8266 Ticker: the callbacks are never called
+
+#pragma once
+
+#include <Arduino.h>
+
+
+class Ticker
+{
+public:
+
+	void once						(float, std::function <void ()>)		{}
+	void once_ms					(uint32_t, std::function <void ()>)		{}
+	void attach						(float, std::function <void ()>)		{}
+	void attach_ms					(uint32_t, std::function <void ()>)		{}
+	void detach						()										{}
+	bool active						() const								{ return false; }
+};
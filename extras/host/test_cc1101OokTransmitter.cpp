@@ -0,0 +1,154 @@
+//************************************************************************************************************************
+// test_cc1101OokTransmitter.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <stdlib.h>
+
+#include <cc1101OokTransmitter.h>
+
+#include "HostRuntime.h"
+
+using namespace cc1101;
+
+
+#define CYCLES_PER_TICK		(CCOOKTX_CPU_CYCLES_PER_US / CCOOKTX_TIMER_TICKS_PER_US)
+#define NB_PULSES			400
+
+/**
+ * Jitter model of the timer interrupt: the timer fires ticks after it is written, the interrupt enters latency cycles
+ * later (random), the pin is written at the entry and the timer is reloaded bodyCycles after the entry
+ */
+struct JITTER_MODEL
+{
+	uint32_t	minLatency;
+	uint32_t	maxLatency;
+	uint32_t	bodyCycles;
+
+	uint32_t latency () const { return minLatency + (uint32_t) (rand () % (maxLatency - minLatency + 1)); }
+};
+
+static uint16_t widths [NB_PULSES];
+
+static void makeFrame ()
+{
+	srand (42);
+	for (uint16_t i = 0; i < NB_PULSES; i++) widths [i] = 300 + (rand () % 900);		// OOK pulses 300..1200µs
+}
+
+//========================================================================================================================
+// Returns the maximum absolute error (cycles) of the edges against the ideal schedule, the timer is reloaded with the
+// scheduled delay (scheduleEdge) or with the raw pulse width (previous implementation)
+//========================================================================================================================
+static uint32_t simulate (const JITTER_MODEL & model, bool isScheduled, int32_t * lastError = nullptr)
+{
+	uint32_t now		= 1000;
+	uint32_t edgeCycles	= now;
+	uint32_t ticks		= CC1101OokTransmitter::scheduleEdge (edgeCycles, 10, now);
+	uint32_t ideal		= edgeCycles;
+	uint32_t maxError	= 0;
+	int32_t error		= 0;
+
+	for (uint16_t i = 0; i < NB_PULSES; i++) {
+		uint32_t edge = now + ticks * CYCLES_PER_TICK + model.latency ();		// Pin written at the interrupt entry
+
+		error = (int32_t) (edge - ideal);
+		if ((uint32_t) abs (error) > maxError) maxError = abs (error);
+
+		now = edge + model.bodyCycles;
+		ticks = isScheduled ? CC1101OokTransmitter::scheduleEdge (edgeCycles, widths [i], now)
+							: (uint32_t) widths [i] * CCOOKTX_TIMER_TICKS_PER_US;
+		ideal += (uint32_t) widths [i] * CCOOKTX_CPU_CYCLES_PER_US;
+	}
+	if (lastError) *lastError = error;
+	return maxError;
+}
+
+//========================================================================================================================
+// Each edge is only late by its own latency, the error doesn't grow over the frame
+//========================================================================================================================
+static void testNoAccumulatedDrift (bool isBench)
+{
+	JITTER_MODEL model = { 2 * CCOOKTX_CPU_CYCLES_PER_US, 6 * CCOOKTX_CPU_CYCLES_PER_US, 1 * CCOOKTX_CPU_CYCLES_PER_US };
+
+	uint32_t maxError = simulate (model, true);
+	CHECK (maxError <= model.maxLatency + CYCLES_PER_TICK);
+
+	int32_t lastError = 0;
+	uint32_t previousMaxError = simulate (model, false, &lastError);					// Previous implementation
+	CHECK (lastError >= (int32_t) (NB_PULSES * (model.minLatency + model.bodyCycles)));
+	CHECK (previousMaxError > 100 * maxError);
+
+	if (isBench) printf ("jitter max error: scheduled %u cycles, reloaded from the interrupt %u cycles\n", maxError, previousMaxError);
+}
+
+//========================================================================================================================
+// An edge already late is started as soon as possible, the following edges catch up with the schedule
+//========================================================================================================================
+static void testLateEdge ()
+{
+	uint32_t edgeCycles = 0;
+
+	CHECK (CC1101OokTransmitter::scheduleEdge (edgeCycles, 100, 200 * CCOOKTX_CPU_CYCLES_PER_US) == CCOOKTX_MIN_TIMER_TICKS);
+	CHECK (edgeCycles == 100 * CCOOKTX_CPU_CYCLES_PER_US);
+
+	CHECK (CC1101OokTransmitter::scheduleEdge (edgeCycles, 500, 200 * CCOOKTX_CPU_CYCLES_PER_US) == 400 * CCOOKTX_TIMER_TICKS_PER_US);
+}
+
+//========================================================================================================================
+// Whole transmission with the timer interrupt fired from yield (): GDO0 is set / cleared through GPOS / GPOC with the
+// level of each pulse, then left low
+//========================================================================================================================
+#define GDO0_PIN			5
+
+static std::vector <bool> hostLevels;
+
+static void fireTimer ()
+{
+	if (!hostTimer1Isr) return;
+
+	hostGpos = 0;
+	hostGpoc = 0;
+	hostTimer1Isr ();
+	if (hostGpos == (1 << GDO0_PIN))		hostLevels.push_back (true);
+	else if (hostGpoc == (1 << GDO0_PIN))	hostLevels.push_back (false);
+}
+
+static void testGdo0Levels ()
+{
+	uint16_t pulses [NB_PULSES];
+	for (uint16_t i = 0; i < NB_PULSES; i++) pulses [i] = makePulse (i % 2 == 0, widths [i]);
+
+	CC1101OokTransmitter transmitter (GDO0_PIN);
+	hostLevels.clear ();
+	hostYield = fireTimer;
+	CHECK (transmitter.sendPulses (pulses, NB_PULSES, 2));
+	hostYield = nullptr;
+
+	CHECK (hostLevels.size () == 2 * NB_PULSES + 1);
+	bool isSame = true;
+	for (size_t i = 0; i + 1 < hostLevels.size (); i++) isSame &= (hostLevels [i] == (i % 2 == 0));
+	CHECK (isSame);
+	CHECK (!hostLevels.back ());
+	CHECK (hostTimer1Isr == nullptr);
+}
+
+//========================================================================================================================
+// Cycle counter wrap around
+//========================================================================================================================
+static void testWrap ()
+{
+	uint32_t edgeCycles = 0xFFFFFF00;
+
+	CHECK (CC1101OokTransmitter::scheduleEdge (edgeCycles, 100, 0xFFFFFF00) == 100 * CCOOKTX_TIMER_TICKS_PER_US);
+	CHECK (edgeCycles == 0xFFFFFF00 + 100 * CCOOKTX_CPU_CYCLES_PER_US);
+}
+
+HOST_TEST_MAIN (
+	makeFrame ();
+	testNoAccumulatedDrift (isBench);
+	testLateEdge ();
+	testWrap ();
+	testGdo0Levels ();
+)
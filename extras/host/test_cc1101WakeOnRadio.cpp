@@ -0,0 +1,81 @@
+//************************************************************************************************************************
+// test_cc1101WakeOnRadio.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <cc1101.h>
+
+#include "HostRuntime.h"
+
+using namespace cc1101;
+
+
+class HostCC1101 : public CC1101
+{
+public:
+	virtual bool sendPacket				(const ccPacketView &) override	{ return false; }
+	virtual void startReceivePacket		(uint8_t) override				{}
+	virtual void stopReceivePacket		(void) override					{}
+};
+
+//========================================================================================================================
+// The RX window must follow the datasheet C (RX_TIME, WOR_RES) table: about dutyCyclePct of EVENT0 (never above it,
+// at least half of it when reachable) whatever the resolution chosen for the latency
+//========================================================================================================================
+static void testRxTimeout ()
+{
+	HostCC1101 radio;
+
+	const uint32_t latenciesMs [] = { 100, 1000, 1800, 5000, 10000, 60000 };
+	const float dutyCycles [] = { 12.5f, 5.f, 1.f, 0.5f };
+
+	for (uint32_t latencyMs : latenciesMs) {
+		for (float duty : dutyCycles) {
+			WOR_SETTINGS settings;
+			radio.computeWakeOnRadio (duty, latencyMs, settings);
+
+			float actual = 100.f * settings.rxTimeoutUs / settings.event0Us;
+			CHECK (actual <= duty * 1.001f);
+			if ((settings.rxTime > 0) && (settings.rxTime < CC1101_RX_TIME_MAX)) CHECK (actual >= duty / 2 * 0.999f);
+			CHECK (settings.event0Us >= latencyMs * 990 && settings.event0Us <= latencyMs * 1000);
+		}
+	}
+
+	// 1 s => WOR_RES 0, RX_TIME 4 (0.78%)
+	WOR_SETTINGS settings;
+	radio.computeWakeOnRadio (1.f, 1000, settings);
+	CHECK (settings.worRes == 0);
+	CHECK (settings.rxTime == 4);
+	CHECK (settings.rxTimeoutUs == 7813);
+
+	// 10 s => WOR_RES 1, RX_TIME 1 (0.98%), not EVENT0 / 16
+	radio.computeWakeOnRadio (1.f, 10000, settings);
+	CHECK (settings.worRes == 1);
+	CHECK (settings.rxTime == 1);
+	CHECK (settings.rxTimeoutUs == 97652);
+}
+
+//========================================================================================================================
+// GDO2 wakes up the MCU on the sync word (IOCFG2 = 0x06), the RX window is extended when it is found
+//========================================================================================================================
+static void testRegisters ()
+{
+	HostCC1101 radio;
+	WOR_SETTINGS settings;
+	radio.computeWakeOnRadio (1.f, 1000, settings);
+
+	memset (hostRegisters, 0, sizeof (hostRegisters));
+	hostSpiTransfer = hostRegisterFile;
+	radio.setWakeOnRadio (settings);
+	hostSpiTransfer = nullptr;
+
+	CHECK (hostRegisters [CC1101_IOCFG2] == 0x06);
+	CHECK (hostRegisters [CC1101_MCSM2] == (CC1101_MCSM2_RX_TIME_QUAL | settings.rxTime));
+	CHECK ((hostRegisters [CC1101_WOREVT1] << 8 | hostRegisters [CC1101_WOREVT0]) == settings.event0);
+}
+
+HOST_TEST_MAIN (
+	testRxTimeout ();
+	testRegisters ();
+)
@@ -0,0 +1,232 @@
+//************************************************************************************************************************
+// test_ccBitPacket.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <stdlib.h>
+#include <vector>
+
+#include <ccBitPacket.h>
+
+#include "HostRuntime.h"
+
+using namespace cc1101;
+
+
+typedef std::vector <bool> BITS;
+
+// Same bits and unused bits of the last byte at 0
+static bool isSame (const ccBitPacket & packet, const BITS & bits)
+{
+	if (packet.getNbBits () != bits.size ()) return false;
+	for (size_t i = 0; i < bits.size (); i++) if (packet.getBit (i) != bits [i]) return false;
+	if (bits.size () & 7) return (packet.getData () [bits.size () >> 3] & (0xFF >> (bits.size () & 7))) == 0;
+	return true;
+}
+
+static BITS randomBits (uint16_t nbBits)
+{
+	BITS bits;
+	for (uint16_t i = 0; i < nbBits; i++) bits.push_back (rand () & 1);
+	return bits;
+}
+
+static void fromBits (ccBitPacket & packet, const BITS & bits)
+{
+	packet.clear ();
+	for (bool bit : bits) packet.appendBit (bit);
+}
+
+//========================================================================================================================
+// Appends, extracts and shifts on odd bit counts against a vector of bits
+//========================================================================================================================
+static void testOddBitCounts ()
+{
+	srand (35);
+	for (uint16_t t = 0; t < 2000; t++) {
+
+		BITS bits = randomBits (rand () % 200);
+		ccBitPacket packet;
+		for (size_t pos = 0; pos < bits.size (); ) {
+			uint8_t n = std::min ((size_t) rand () % 33, bits.size () - pos);
+			uint32_t value = 0;
+			for (uint8_t i = 0; i < n; i++) value = (value << 1) | bits [pos + i];
+			CHECK (packet.appendBits (value, n));
+			pos += n;
+		}
+		CHECK (isSame (packet, bits));
+
+		// Byte array append on an unaligned packet
+		BITS tail = randomBits (rand () % 100);
+		ccBitPacket other;
+		fromBits (other, tail);
+		CHECK (packet.append (other));
+		BITS both = bits;
+		both.insert (both.end (), tail.begin (), tail.end ());
+		CHECK (isSame (packet, both));
+
+		uint16_t start = rand () % (both.size () + 10);
+		uint8_t n = rand () % 33;
+		uint32_t expected = 0;
+		for (uint8_t i = 0; i < n; i++) expected = (expected << 1) | ((start + i < both.size ()) ? both [start + i] : 0);
+		CHECK (packet.extractBits (start, n) == expected);
+
+		uint16_t shift = rand () % 20;
+		ccBitPacket shifted = packet;
+		CHECK (shifted.shiftRight (shift));
+		BITS right (shift, false);
+		right.insert (right.end (), both.begin (), both.end ());
+		CHECK (isSame (shifted, right));
+		shifted.shiftLeft (shift);
+		CHECK (shifted == packet);
+
+		shift = rand () % 20;
+		packet.shiftLeft (shift);
+		BITS left (both.begin () + std::min ((size_t) shift, both.size ()), both.end ());
+		CHECK (isSame (packet, left));
+
+		uint16_t length = rand () % 40;
+		packet.truncate (length);
+		if (length < left.size ()) left.resize (length);
+		CHECK (isSame (packet, left));
+	}
+
+	// Full packet
+	ccBitPacket packet;
+	CHECK (packet.appendBits ((uint32_t) 0, 31) && packet.appendBits ((const uint8_t *) "", 0));
+	while (packet.appendBit (true));
+	CHECK (packet.getNbBits () == CCBITPACKET_MAX_BITS);
+	CHECK (!packet.appendBits (1, 1) && !packet.shiftRight (1));
+}
+
+//========================================================================================================================
+// Invert and xor keep the unused bits at 0
+//========================================================================================================================
+static void testInvertXor ()
+{
+	srand (122);
+	for (uint16_t t = 0; t < 500; t++) {
+
+		BITS a = randomBits (rand () % 200), b = randomBits (rand () % 200);
+		ccBitPacket pa, pb;
+		fromBits (pa, a);
+		fromBits (pb, b);
+
+		pa.invert ();
+		for (size_t i = 0; i < a.size (); i++) a [i] = !a [i];
+		CHECK (isSame (pa, a));
+
+		pa.xorWith (pb);
+		for (size_t i = 0; i < std::min (a.size (), b.size ()); i++) a [i] = a [i] ^ b [i];
+		CHECK (isSame (pa, a));
+	}
+}
+
+//========================================================================================================================
+// LUT Manchester encoding / decoding against the symbols (1 => 10, 0 => 01), decoding stops at the first invalid symbol
+//========================================================================================================================
+static void testManchester ()
+{
+	srand (1);
+	for (uint16_t t = 0; t < 2000; t++) {
+
+		BITS bits = randomBits (rand () % (CCBITPACKET_MAX_BITS / 2 + 1));
+		ccBitPacket packet, encoded, decoded;
+		fromBits (packet, bits);
+
+		CHECK (packet.manchesterEncode (encoded));
+		BITS symbols;
+		for (bool bit : bits) {
+			symbols.push_back (bit);
+			symbols.push_back (!bit);
+		}
+		CHECK (isSame (encoded, symbols));
+
+		CHECK (encoded.manchesterDecode (decoded) == bits.size ());
+		CHECK (decoded == packet);
+
+		// Invalid symbol (00 or 11) somewhere: the bits before it only
+		if (bits.empty ()) continue;
+		size_t invalid = rand () % bits.size ();
+		symbols [2 * invalid + 1] = symbols [2 * invalid];
+		fromBits (encoded, symbols);
+		CHECK (encoded.manchesterDecode (decoded) == invalid);
+		CHECK (isSame (decoded, BITS (bits.begin (), bits.begin () + invalid)));
+	}
+
+	// Every encoded byte, an odd number of symbol bits is ignored
+	for (uint16_t byte = 0; byte < 256; byte++) {
+		ccBitPacket encoded, decoded;
+		encoded.appendBits (byte, 8);
+		encoded.appendBit (true);
+
+		BITS expected;
+		for (uint8_t s = 0; s < 4; s++) {
+			uint8_t symbol = (byte >> (6 - 2 * s)) & 0x03;
+			if ((symbol == 0) || (symbol == 3)) break;
+			expected.push_back (symbol == 2);
+		}
+		CHECK (encoded.manchesterDecode (decoded) == expected.size ());
+		CHECK (isSame (decoded, expected));
+	}
+
+	ccBitPacket tooLong, out;
+	tooLong.appendBit (false);
+	while (tooLong.getNbBits () <= CCBITPACKET_MAX_BITS / 2) tooLong.appendBit (true);
+	CHECK (!tooLong.manchesterEncode (out));
+}
+
+//========================================================================================================================
+// rtl_433 "{N} hex" notation: print / parse round trip, bad input rejected and the packet left unchanged
+//========================================================================================================================
+static void testPrintParse ()
+{
+	HostPrint out;
+	ccBitPacket packet;
+
+	CHECK (packet.parse ("{12} ab c", out));
+	CHECK ((packet.getNbBits () == 12) && (packet.extractBits (0, 12) == 0xABC));
+	HostPrint printed;
+	packet.printTo (printed);
+	CHECK (printed.str == "{12} ab c0");
+
+	CHECK (packet.parse (" {5}f8ff", out));										// The digits beyond N bits are ignored
+	CHECK ((packet.getNbBits () == 5) && (packet.getData () [0] == 0xF8));
+	CHECK (packet.parse ("{0}", out) && (packet.getNbBits () == 0));
+
+	srand (433);
+	for (uint16_t t = 0; t < 500; t++) {
+		BITS bits = randomBits (rand () % (CCBITPACKET_MAX_BITS + 1));
+		ccBitPacket original, parsed;
+		fromBits (original, bits);
+		HostPrint text;
+		original.printTo (text);
+		CHECK (parsed.parse (text.str.c_str (), out));
+		CHECK (parsed == original);
+	}
+
+	const char * const invalids [] = {
+		"",
+		"12} abc",						// No {
+		"{12 abc",						// No }
+		"{x} abc",
+		"{801} 00",						// More than CCBITPACKET_MAX_BITS
+		"{99999999999} 00",
+		"{12} ag0",						// Bad hex digit
+		"{12} ab",						// Missing digits
+		"{8}",
+	};
+	CHECK (packet.parse ("{7} 5a", out));
+	for (const char * invalid : invalids) {
+		CHECK (!packet.parse (invalid, out));
+		CHECK ((packet.getNbBits () == 7) && (packet.getData () [0] == 0x5A));
+	}
+}
+
+HOST_TEST_MAIN (
+	testOddBitCounts ();
+	testInvertXor ();
+	testManchester ();
+	testPrintParse ();
+)
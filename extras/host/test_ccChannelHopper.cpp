@@ -0,0 +1,134 @@
+//************************************************************************************************************************
+// test_ccChannelHopper.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <algorithm>
+
+#include <cc1101Transceiver.h>
+#include <ccChannelHopper.h>
+
+#include "HostRuntime.h"
+
+using namespace cc1101;
+
+
+class HostTransceiver : public CC1101Transceiver
+{
+public:
+	HostTransceiver						() : CC1101Transceiver (4, 0, 0) {}
+	virtual void initRegisters			() override						{}
+};
+
+// The transmission lasts 200 SPI transfers, 1 ms each, then the radio goes back to IDLE (TXOFF_MODE = IDLE)
+static uint16_t nbTxTransfers = 0;
+
+static uint8_t sendingRadio (uint8_t mosi)
+{
+	uint8_t miso = hostRegisterFile (mosi);
+	if (hostRegisters [CC1101_MARCSTATE] != CC_MARCSTATE_TX) {
+		nbTxTransfers = 0;
+		return miso;
+	}
+	hostMillis++;
+	if (++nbTxTransfers >= 200) hostRegisters [CC1101_MARCSTATE] = CC_MARCSTATE_IDLE;
+	return miso;
+}
+
+static bool isStrobed (uint8_t strobe)
+{
+	return std::find (hostStrobes.begin (), hostStrobes.end (), strobe) != hostStrobes.end ();
+}
+
+//========================================================================================================================
+// The hops are made by loop () once the dwell is over, and extended while a carrier is sensed
+//========================================================================================================================
+static void testHops ()
+{
+	HostTransceiver radio;
+	ccChannelHopper hopper (radio);
+
+	memset (hostRegisters, 0, sizeof (hostRegisters));
+	hostSpiTransfer	= hostRegisterFile;
+	hostMillis		= 1000;
+
+	CHECK (hopper.addChannel (1, 10) && hopper.addChannel (2, 10));
+	hopper.start ();
+	CHECK (hopper.isHopping () && (hostRegisters [CC1101_CHANNR] == 1));
+
+	hostStrobes.clear ();
+	hostMillis += 9;
+	hopper.loop ();
+	CHECK (hostStrobes.empty () && (hostRegisters [CC1101_CHANNR] == 1));
+
+	hostMillis += 1;
+	hopper.loop ();
+	CHECK ((hostStrobes == std::vector <uint8_t> { CC1101_SIDLE, CC1101_SRX }) && (hostRegisters [CC1101_CHANNR] == 2));
+	CHECK ((hopper [0].nbDwells == 1) && (hopper [1].nbDwells == 1));
+
+	// Carrier sensed: the dwell is extended
+	hostRegisters [CC1101_PKTSTATUS] = 0x40;
+	hostMillis += 10;
+	hopper.loop ();
+	CHECK ((hostRegisters [CC1101_CHANNR] == 2) && (hopper [1].nbExtends == 1));
+	hostRegisters [CC1101_PKTSTATUS] = 0;
+
+	hopper.stop ();
+	CHECK (!hopper.isHopping ());
+	hostStrobes.clear ();
+	hostMillis += 100;
+	hopper.loop ();
+	CHECK (hostStrobes.empty ());
+
+	hostSpiTransfer = nullptr;
+}
+
+//========================================================================================================================
+// No hop strobe during a send lasting several dwells, nor until the receiver is restarted after it
+//========================================================================================================================
+static void testNoHopDuringSend ()
+{
+	HostTransceiver radio;
+	ccChannelHopper hopper (radio);
+
+	memset (hostRegisters, 0, sizeof (hostRegisters));
+	hostSpiTransfer	= hostRegisterFile;
+	hostMillis		= 1000;
+
+	CHECK (hopper.addChannel (1, 10) && hopper.addChannel (2, 10));
+	hopper.start ();
+
+	hostStrobes.clear ();
+	hostSpiTransfer = sendingRadio;
+	uint32_t sendStartMs = hostMillis;
+	const uint8_t data [] = { 1, 2, 3 };
+	CHECK (radio.sendPacket (data, sizeof (data)));
+	CHECK (hostMillis - sendStartMs >= 200);
+	CHECK (isStrobed (CC1101_STX) && !isStrobed (CC1101_SRX));
+	CHECK (hostRegisters [CC1101_CHANNR] == 1);
+
+	// Radio back in IDLE, RX restart pending (receive ticker): the hopper stays away
+	hostStrobes.clear ();
+	hostSpiTransfer = hostRegisterFile;
+	hopper.loop ();
+	CHECK (hostStrobes.empty () && (hostRegisters [CC1101_CHANNR] == 1));
+	CHECK (hopper [1].nbDwells == 0);
+
+	// Receiver restarted: hopping again after a whole dwell
+	hostRegisters [CC1101_MARCSTATE] = CC_MARCSTATE_RX;
+	hostMillis += 9;
+	hopper.loop ();
+	CHECK (hostRegisters [CC1101_CHANNR] == 1);
+	hostMillis += 1;
+	hopper.loop ();
+	CHECK ((hostRegisters [CC1101_CHANNR] == 2) && (hopper [1].nbDwells == 1));
+
+	hopper.stop ();
+	hostSpiTransfer = nullptr;
+}
+
+HOST_TEST_MAIN (
+	testHops ();
+	testNoHopDuringSend ();
+)
@@ -0,0 +1,248 @@
+//************************************************************************************************************************
+// test_ccDecoderRegistry.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <ccDecoderRegistry.h>
+#include <ccX2dDecoder.h>
+#include <ccOokRowDecoder.h>
+#include <ccFrameDecoder.h>
+
+#include "../../examples/ThermostatRemoteControl/X2dRadioTyboxCommands.h"
+
+#include "HostRuntime.h"
+
+using namespace cc1101;
+
+
+/**
+ * Decoder counting its calls, accepts one first byte
+ */
+class CountingDecoder : public ccProtocolDecoder
+{
+public:
+	uint8_t		firstByte;
+	uint32_t	nbCalls		= 0;
+
+	CountingDecoder (uint8_t b) : firstByte (b) {}
+
+	virtual const char * getName () const override							{ return "counting";		}
+	virtual bool acceptsFirstByte (uint8_t b) const override				{ return b == firstByte;	}
+	virtual const ccDecodedEvent * decode (const CCPACKET &) override			{ nbCalls++; return nullptr; }
+};
+
+/**
+ * Decoder taking 100µs to match a packet and 10µs to decode it
+ */
+class SlowDecoder : public ccProtocolDecoder
+{
+public:
+	virtual const char * getName () const override							{ return "slow";			}
+	virtual bool matches (const CCPACKET & packet) const override			{ hostMicros += 100; return packet.length > 1; }
+	virtual const ccDecodedEvent * decode (const CCPACKET &) override			{ hostMicros += 10; return nullptr; }
+};
+
+static void addRow (ccBitBuffer & bits, uint32_t value, uint8_t nbBits)
+{
+	if (bits.getTotalBits () > 0) bits.addRow ();
+	for (int8_t i = nbBits - 1; i >= 0; i--) bits.addBit ((value >> i) & 1);
+}
+
+static CCPACKET makeFrame (const CCFRAME_FORMAT & format, uint8_t length, uint8_t seed)
+{
+	BasicPacket <32> payload;
+	payload.length	= length;
+	payload.address	= 0x42;
+	for (uint8_t i = 0; i < length; i++) payload.data [i] = seed + i;
+
+	CCPACKET frame;
+	frame.length = ccPacketEngine::encode (payload, format, frame.data, sizeof (frame.data));
+	return frame;
+}
+
+//========================================================================================================================
+// Only the decoders of the first byte / length index are called
+//========================================================================================================================
+static void testIndex ()
+{
+	ccDecoderRegistry registry;
+	CountingDecoder a (0x55), b (0xAA);
+	ccX2dDecoder x2d;
+
+	CHECK (registry.add (&a));
+	CHECK (registry.add (&b));
+	CHECK (registry.add (&x2d));
+
+	CCPACKET packet;
+	packet = HEATING_ON_CMD [0];									// First byte 0x55, 16 bytes
+
+	CHECK (registry.dispatch (packet) == 1);
+	CHECK (a.nbCalls == 1 && b.nbCalls == 0);
+	CHECK (registry.getStats (2).nbCalls == 1 && registry.getStats (2).nbDecoded == 1);
+
+	packet.length = X2D_MIN_LEN - 1;								// Too short for X2D
+	CHECK (registry.dispatch (packet) == 0);
+	CHECK (a.nbCalls == 2 && registry.getStats (2).nbCalls == 1);
+}
+
+//========================================================================================================================
+// clear resets the index and the stats: a new decoder at the same slot starts from zero
+//========================================================================================================================
+static void testClear ()
+{
+	ccDecoderRegistry registry;
+	CountingDecoder a (0x55), b (0xAA);
+
+	registry.add (&a);
+	CCPACKET packet;
+	packet = HEATING_ON_CMD [0];
+	registry.dispatch (packet);
+	CHECK (registry.getStats (0).nbCalls == 1);
+
+	registry.clear ();
+	CHECK (registry.size () == 0);
+	CHECK (registry.dispatch (packet) == 0);
+	CHECK (a.nbCalls == 1);
+
+	registry.add (&b);
+	CHECK (registry.getStats (0).nbCalls == 0);
+	registry.dispatch (packet);										// 0x55 no longer indexed
+	CHECK (a.nbCalls == 1 && b.nbCalls == 0);
+	CHECK (registry.getStats (0).nbCalls == 0);
+}
+
+//========================================================================================================================
+// The decoder time includes its match
+//========================================================================================================================
+static void testStatsTime ()
+{
+	ccDecoderRegistry registry;
+	SlowDecoder slow;
+
+	registry.add (&slow);
+	CCPACKET packet;
+	packet = HEATING_ON_CMD [0];
+	registry.dispatch (packet);
+	CHECK ((registry.getStats (0).nbCalls == 1) && (registry.getStats (0).totalUs == 110) && (registry.getStats (0).maxUs == 110));
+
+	packet.length = 1;												// Not matched: not counted
+	registry.dispatch (packet);
+	CHECK ((registry.getStats (0).nbCalls == 1) && (registry.getStats (0).totalUs == 110));
+}
+
+//========================================================================================================================
+// Generic OOK sensor: bit count, prefix and repeats filters over the flex rows
+//========================================================================================================================
+static void testOokRows ()
+{
+	CCOOKROW_PARAMS params;
+	params.minBits		= 24;
+	params.maxBits		= 24;
+	params.minRepeats	= 2;
+	params.prefix [0]	= 0xA0;
+	params.prefixBits	= 4;
+
+	ccOokRowDecoder decoder ("sensor", params);
+	ccDecoderRegistry registry;
+	registry.add (&decoder);
+
+	const OOK_ROW_EVENT * received = nullptr;
+	registry.subscribe <OOK_ROW_EVENT> ([&] (const OOK_ROW_EVENT & event) { received = &event; });
+
+	ccBitBuffer bits;
+	addRow (bits, 0x123456, 24);									// Wrong prefix
+	addRow (bits, 0xA1B2C3, 24);
+	addRow (bits, 0xA1B2C3, 24);
+	addRow (bits, 0xA1B2C3, 20);									// Too short
+	CHECK (registry.dispatch (bits) == 1);
+	CHECK (received != nullptr);
+	CHECK (received->nbBits == 24 && received->nbRepeats == 2);
+	CHECK (received->row [0] == 0xA1 && received->row [1] == 0xB2 && received->row [2] == 0xC3);
+
+	HostPrint text;
+	received->printTo (text);
+	CHECK (text.str == "sensor {24} a1 b2 c3 x2");
+
+	bits.clear ();
+	addRow (bits, 0xA1B2C3, 24);									// Not repeated
+	received = nullptr;
+	CHECK (registry.dispatch (bits) == 0);
+	CHECK (received == nullptr);
+
+	CCPACKET packet;
+	packet = HEATING_ON_CMD [0];
+	CHECK (registry.dispatch (packet) == 0);						// Never a packet candidate
+	CHECK (registry.getStats (0).nbCalls == 2);
+}
+
+//========================================================================================================================
+// GFSK framing: variable length (clear length byte indexed) and whitened fixed length frames
+//========================================================================================================================
+static void testFrames ()
+{
+	CCFRAME_FORMAT variable;
+	variable.isAddressCheck	= true;
+
+	CCFRAME_FORMAT fixed;
+	fixed.isVariableLength	= false;
+	fixed.isAddressCheck	= true;
+	fixed.isWhitening		= true;
+	fixed.length			= 20;
+
+	ccFrameDecoder variableDecoder ("gfskvar", variable);
+	ccFrameDecoder fixedDecoder ("gfskfix", fixed);
+	ccDecoderRegistry registry;
+	registry.add (&variableDecoder);
+	registry.add (&fixedDecoder);
+
+	uint8_t nbReceived = 0;
+	registry.subscribe <FRAME_EVENT> ([&] (const FRAME_EVENT & event) {
+		nbReceived++;
+		CHECK (event.packet.crc_ok && event.packet.address == 0x42);
+	});
+
+	CCPACKET frame = makeFrame (variable, 10, 1);
+	CHECK (registry.dispatch (frame) == 1);
+	CHECK (registry.getStats (1).nbCalls == 0);						// Fixed length: not a candidate
+
+	frame = makeFrame (fixed, 20, 3);
+	CHECK (registry.dispatch (frame) == 1);
+	CHECK (nbReceived == 2);
+
+	frame.data [5] ^= 0x10;											// CRC error
+	CHECK (registry.dispatch (frame) == 0);
+	CHECK (fixedDecoder.getNbCrcErrors () == 1);
+
+	frame = makeFrame (variable, 10, 1);
+	frame.length -= 3;												// Truncated: the length byte doesn't match
+	CHECK (registry.dispatch (frame) == 0);
+	CHECK (registry.getStats (0).nbCalls == 1);
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+static void bench ()
+{
+	ccDecoderRegistry registry;
+	CountingDecoder decoders [6] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06 };
+	ccX2dDecoder x2d;
+	for (CountingDecoder & decoder : decoders) registry.add (&decoder);
+	registry.add (&x2d);
+
+	CCPACKET packet;
+	packet = HEATING_ON_CMD [0];
+	hostBench ("registry dispatch x2d", 1000000, packet.length, [&] () {
+		registry.dispatch (packet);
+	});
+}
+
+HOST_TEST_MAIN (
+	testIndex ();
+	testClear ();
+	testStatsTime ();
+	testOokRows ();
+	testFrames ();
+	if (isBench) bench ();
+)
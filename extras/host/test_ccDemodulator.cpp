@@ -0,0 +1,248 @@
+//************************************************************************************************************************
+// test_ccDemodulator.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <stdlib.h>
+#include <vector>
+
+#include <ccDemodulator.h>
+
+#include "HostRuntime.h"
+
+using namespace cc1101;
+
+
+/**
+ * Pulse trace builder: merges the consecutive periods of the same level, adds a random jitter (percent of the width)
+ */
+struct TRACE
+{
+	std::vector <uint16_t>	pulses;
+	uint8_t					jitterPct = 0;
+
+	void add (bool level, uint32_t us)
+	{
+		if (jitterPct > 0) us += (int32_t) us * ((rand () % (2 * jitterPct + 1)) - jitterPct) / 100;
+		if (!pulses.empty () && (pulseLevel (pulses.back ()) == level)) {
+			pulses.back () = makePulse (level, pulseWidth (pulses.back ()) + us);
+		}
+		else {
+			pulses.push_back (makePulse (level, us));
+		}
+	}
+};
+
+// X2D Tybox like frame (m=OOK_MC_ZEROBIT,s=844): preamble 0101... then the data, starts with the implied zero
+static const uint8_t x2dBits [] = { 0,1,0,1,0,1,0,1,0,1,1,1,1,1,1,0, 0,1,1,0,1,0,0,1, 1,1,0,0,0,1,0,1, 0,0,1,1,1,0,1,0 };
+
+static TRACE makeManchesterTrace (const uint8_t * bits, uint16_t nbBits, uint16_t halfUs, uint8_t jitterPct)
+{
+	TRACE trace;
+	trace.jitterPct = jitterPct;
+	trace.add (0, 5000);
+	for (uint16_t i = 0; i < nbBits; i++) {
+		trace.add (bits [i], halfUs);
+		trace.add (!bits [i], halfUs);
+	}
+	trace.add (0, 5000);
+	return trace;
+}
+
+static bool rowEquals (const ccBitBuffer & bits, uint8_t row, const uint8_t * expected, uint16_t nbBits)
+{
+	if (bits.getNbBits (row) != nbBits) return false;
+	for (uint16_t i = 0; i < nbBits; i++) {
+		if (bits.getBit (row, i) != expected [i]) return false;
+	}
+	return true;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+static void testManchesterZeroBit ()
+{
+	CCDEMOD_PARAMS params;
+	params.modulation	= OOK_MC_ZEROBIT;
+	params.shortUs		= 844;
+	params.resetUs		= 3000;								// Above the longest gap: 2 half bits + jitter
+
+	for (uint8_t jitterPct : { 0, 10, 20 }) {
+		srand (jitterPct);
+		TRACE trace = makeManchesterTrace (x2dBits, sizeof (x2dBits), 844, jitterPct);
+
+		ccDemodulator demod (params);
+		uint8_t nbMessages = 0;
+		for (uint16_t pulse : trace.pulses) {
+			if (demod.feed (pulse)) {
+				nbMessages++;
+				CHECK (demod.getBits ().getNbRows () == 1);
+				CHECK (rowEquals (demod.getBits (), 0, x2dBits, sizeof (x2dBits)));
+			}
+		}
+		CHECK (nbMessages == 1);
+	}
+}
+
+//========================================================================================================================
+// Two messages separated by a reset gap, the second one ended by flush
+//========================================================================================================================
+static void testResetAndFlush ()
+{
+	CCDEMOD_PARAMS params;
+	params.modulation	= OOK_MC_ZEROBIT;
+	params.shortUs		= 844;
+	params.resetUs		= 3000;								// Above the longest gap: 2 half bits + jitter
+
+	TRACE trace = makeManchesterTrace (x2dBits, sizeof (x2dBits), 844, 0);
+	TRACE second = makeManchesterTrace (x2dBits, 16, 844, 0);
+	trace.pulses.insert (trace.pulses.end (), second.pulses.begin () + 1, second.pulses.end () - 1);
+
+	ccDemodulator demod (params);
+	uint8_t nbMessages = 0;
+	for (uint16_t pulse : trace.pulses) {
+		if (demod.feed (pulse)) nbMessages++;
+	}
+	CHECK (nbMessages == 1);
+	CHECK (demod.flush ());
+	CHECK (rowEquals (demod.getBits (), 0, x2dBits, 16));
+
+	// Noise only (no data edge): no message
+	demod.reset ();
+	CHECK (!demod.feed (makePulse (1, 100)));
+	CHECK (!demod.feed (makePulse (0, 5000)));
+}
+
+//========================================================================================================================
+// m=OOK_PWM,s=848,l=1684,r=1656,y=232 : sync pulse then short = 1, long = 0, two rows separated by a sync
+//========================================================================================================================
+static void testPwmSync ()
+{
+	CCDEMOD_PARAMS params;
+	params.modulation	= OOK_PWM;
+	params.shortUs		= 848;
+	params.longUs		= 1684;
+	params.resetUs		= 3312;
+	params.syncUs		= 232;
+
+	static const uint8_t bits [] = { 1,0,1,1,0,0,0,1,1,0,1,0 };
+
+	srand (7);
+	TRACE trace;
+	trace.jitterPct = 10;
+	for (uint8_t row = 0; row < 2; row++) {
+		trace.add (1, 232);
+		trace.add (0, 800);
+		for (uint8_t bit : bits) {
+			trace.add (1, bit ? 848 : 1684);
+			trace.add (0, 800);
+		}
+	}
+	trace.add (0, 9000);
+
+	ccDemodulator demod (params);
+	uint8_t nbMessages = 0;
+	for (uint16_t pulse : trace.pulses) {
+		if (demod.feed (pulse)) {
+			nbMessages++;
+			const ccBitBuffer & out = demod.getBits ();
+			CHECK (out.getNbRows () == 2);
+			CHECK (out.getSyncsBeforeRow (0) == 1);
+			CHECK (out.getSyncsBeforeRow (1) == 1);
+			CHECK (rowEquals (out, 0, bits, sizeof (bits)));
+			CHECK (rowEquals (out, 1, bits, sizeof (bits)));
+		}
+	}
+	CHECK (nbMessages == 1);
+}
+
+//========================================================================================================================
+// PPM: short gap = 0, long gap = 1, a gap longer than g= starts a new row
+//========================================================================================================================
+static void testPpmRows ()
+{
+	CCDEMOD_PARAMS params;
+	params.modulation	= OOK_PPM;
+	params.shortUs		= 1000;
+	params.longUs		= 2000;
+	params.gapUs		= 3000;
+	params.resetUs		= 8000;
+
+	static const uint8_t bits [] = { 0,1,1,0,1,0,0,0,1 };
+
+	TRACE trace;
+	for (uint8_t row = 0; row < 3; row++) {
+		for (uint8_t bit : bits) {
+			trace.add (1, 500);
+			trace.add (0, bit ? 2000 : 1000);
+		}
+		trace.add (1, 500);
+		trace.add (0, (row < 2) ? 4000 : 10000);
+	}
+
+	ccDemodulator demod (params);
+	uint8_t nbMessages = 0;
+	for (uint16_t pulse : trace.pulses) {
+		if (demod.feed (pulse)) {
+			nbMessages++;
+			const ccBitBuffer & out = demod.getBits ();
+			CHECK (out.getNbRows () == 3);
+			for (uint8_t row = 0; row < out.getNbRows (); row++) {
+				CHECK (rowEquals (out, row, bits, sizeof (bits)));
+			}
+		}
+	}
+	CHECK (nbMessages == 1);
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+static void bench ()
+{
+	CCDEMOD_PARAMS params;
+	params.modulation	= OOK_MC_ZEROBIT;
+	params.shortUs		= 844;
+	params.resetUs		= 3000;								// Above the longest gap: 2 half bits + jitter
+
+	srand (1);
+	TRACE trace = makeManchesterTrace (x2dBits, sizeof (x2dBits), 844, 10);
+	ccDemodulator demod (params);
+
+	size_t index = 0;
+	hostBench ("demod manchester pulse", 10000000, 0, [&] () {
+		demod.feed (trace.pulses [index]);
+		if (++index == trace.pulses.size ()) index = 0;
+	});
+
+	params.modulation	= OOK_PWM;
+	params.shortUs		= 848;
+	params.longUs		= 1684;
+	params.resetUs		= 3312;
+	params.syncUs		= 232;
+	demod.setParams (params);
+
+	TRACE pwm;
+	pwm.add (1, 232);
+	for (uint8_t i = 0; i < 40; i++) {
+		pwm.add (0, 800);
+		pwm.add (1, (i & 1) ? 848 : 1684);
+	}
+	pwm.add (0, 9000);
+
+	index = 0;
+	hostBench ("demod pwm pulse", 10000000, 0, [&] () {
+		demod.feed (pwm.pulses [index]);
+		if (++index == pwm.pulses.size ()) index = 0;
+	});
+}
+
+HOST_TEST_MAIN (
+	testManchesterZeroBit ();
+	testResetAndFlush ();
+	testPwmSync ();
+	testPpmRows ();
+	if (isBench) bench ();
+)
@@ -0,0 +1,192 @@
+//************************************************************************************************************************
+// test_ccFlexDecoder.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <vector>
+
+#include <ccFlexRegistry.h>
+
+#include "HostRuntime.h"
+
+using namespace cc1101;
+
+
+static bool parse (const char * spec, CCDEMOD_PARAMS & params, char (&name) [CCFLEX_NAME_LEN])
+{
+	HostPrint out;
+	return ccFlexDecoder::parseSpec (spec, name, params, out);
+}
+
+//========================================================================================================================
+// Specs of the X2dRadioTyboxCommands.h notes, the rtl_433 keys not used by the demodulation are ignored
+//========================================================================================================================
+static void testParseSpec ()
+{
+	char name [CCFLEX_NAME_LEN];
+	CCDEMOD_PARAMS params;
+
+	CHECK (parse ("n=name,m=OOK_MC_ZEROBIT,s=844,l=0,r=1656", params, name));
+	CHECK (strcmp (name, "name") == 0);
+	CHECK (params.modulation == OOK_MC_ZEROBIT);
+	CHECK (params.shortUs == 844 && params.longUs == 0 && params.resetUs == 1656);
+
+	CHECK (parse ("n=pwm,m=OOK_PWM,s=848,l=1684,r=1656,g=0,t=0,y=232,bits>=80", params, name));
+	CHECK (params.modulation == OOK_PWM);
+	CHECK (params.longUs == 1684 && params.syncUs == 232 && params.gapUs == 0);
+
+	CHECK (parse ("modulation=OOK_PPM,short=1000.75,long=2000,reset=8000", params, name));
+	CHECK (strcmp (name, "flex") == 0);
+	CHECK (params.shortUs == 1000);									// Decimals truncated
+
+	CHECK (parse ("n=averyveryverylongname,m=OOK_MC_ZEROBIT,s=844,r=1656", params, name));
+	CHECK (strlen (name) == CCFLEX_NAME_LEN - 1);
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+static void testParseErrors ()
+{
+	char name [CCFLEX_NAME_LEN];
+	CCDEMOD_PARAMS params;
+
+	CHECK (!parse ("n=x,m=OOK_MC_ZEROBIT,s=12.3abc,r=1656", params, name));		// Trailing garbage
+	CHECK (!parse ("n=x,m=OOK_MC_ZEROBIT,s=8x,r=1656", params, name));
+	CHECK (!parse ("n=x,m=OOK_MC_ZEROBIT,s=.5,r=1656", params, name));
+	CHECK (!parse ("n=x,m=OOK_MC_ZEROBIT,s=70000,r=1656", params, name));		// Overflow
+	CHECK (!parse ("n=x,m=FSK_PCM,s=844,r=1656", params, name));				// Unsupported modulation
+	CHECK (!parse ("n=x,m=OOK_MC_ZEROBIT,s=844", params, name));				// Missing r
+	CHECK (!parse ("n=x,m=OOK_PWM,s=844,r=1656", params, name));				// Missing l
+	CHECK (!parse ("n=x,OOK_PWM", params, name));								// Malformatted
+	CHECK (!parse ("", params, name));
+}
+
+//========================================================================================================================
+// An invalid spec leaves the decoder name and parameters unchanged
+//========================================================================================================================
+static void testParseKeepsDecoder ()
+{
+	ccFlexDecoder decoder;
+	HostPrint out;
+
+	CHECK (decoder.parse ("n=pwm,m=OOK_PWM,s=848,l=1684,r=1656,y=232", out));
+	CCDEMOD_PARAMS params = decoder.getParams ();
+
+	CHECK (!decoder.parse ("n=other,m=OOK_MC_ZEROBIT,s=844", out));				// Missing r
+	CHECK (!decoder.parse ("n=other,m=OOK_PWM,s=8x,l=1684,r=1656", out));
+	CHECK (strcmp (decoder.getName (), "pwm") == 0);
+	CHECK (memcmp (&decoder.getParams (), &params, sizeof (params)) == 0);
+
+	CHECK (decoder.parse ("n=other,m=OOK_MC_ZEROBIT,s=844,r=1656", out));
+	CHECK ((strcmp (decoder.getName (), "other") == 0) && (decoder.getParams ().modulation == OOK_MC_ZEROBIT));
+}
+
+//========================================================================================================================
+// The normalized spec parses back to the same parameters
+//========================================================================================================================
+static void testPrintSpec ()
+{
+	char name [CCFLEX_NAME_LEN], name2 [CCFLEX_NAME_LEN];
+	CCDEMOD_PARAMS params, params2;
+
+	CHECK (parse ("n=pwm,m=OOK_PWM,s=848,l=1684,r=1656,g=0,t=0,y=232", params, name));
+
+	HostPrint spec;
+	ccFlexDecoder::printSpec (spec, name, params);
+	CHECK (parse (spec.str.c_str (), params2, name2));
+	CHECK (strcmp (name, name2) == 0);
+	CHECK (memcmp (&params, &params2, sizeof (params)) == 0);
+}
+
+//========================================================================================================================
+// PWM frame with a sync pulse: short = 1, long = 0
+//========================================================================================================================
+static std::vector <uint16_t> makePwmFrame (const uint8_t * bits, uint16_t nbBits)
+{
+	std::vector <uint16_t> pulses = { makePulse (1, 232), makePulse (0, 800) };
+	for (uint16_t i = 0; i < nbBits; i++) {
+		pulses.push_back (makePulse (1, bits [i] ? 860 : 1670));
+		pulses.push_back (makePulse (0, 800));
+	}
+	pulses.push_back (makePulse (0, 9000));
+	return pulses;
+}
+
+//========================================================================================================================
+// Several decoders in parallel over one pulse stream, a decoder with the same name is replaced
+//========================================================================================================================
+static void testRegistry ()
+{
+	static const uint8_t bits [] = { 1,0,1,1,0,0,0,1,1 };
+
+	ccFlexRegistry registry;
+	HostPrint out;
+
+	CHECK (registry.add ("n=x2d,m=OOK_MC_ZEROBIT,s=844,l=0,r=2500", out));
+	CHECK (registry.add ("n=pwm,m=OOK_PWM,s=848,l=1684,r=3000,g=0,t=0,y=232", out));
+	CHECK (registry.add ("n=ppm,m=OOK_PPM,s=400,l=600,r=3000", out));
+	CHECK (registry.add ("n=pwm,m=OOK_PWM,s=848,l=1684,r=3000,y=232", out));		// Replaced
+	CHECK (registry.size () == 3);
+	CHECK (registry.add ("n=d4,m=OOK_PPM,s=400,l=600,r=3000", out));
+	CHECK (!registry.add ("n=d5,m=OOK_PPM,s=400,l=600,r=3000", out));				// Too many decoders
+
+	uint8_t nbDecoded = 0;
+	registry.notifyDecoded += [&] (const ccFlexDecoder & decoder, const ccBitBuffer & decoded) {
+		if (strcmp (decoder.getName (), "pwm") != 0) return;		// No bit count filter: the others decode noise
+		nbDecoded++;
+		CHECK (decoded.getNbRows () == 1);
+		CHECK (decoded.getSyncsBeforeRow (0) == 1);
+		CHECK (decoded.getNbBits (0) == sizeof (bits));
+		for (uint8_t i = 0; i < sizeof (bits); i++) CHECK (decoded.getBit (0, i) == bits [i]);
+	};
+
+	for (uint16_t pulse : makePwmFrame (bits, sizeof (bits))) registry.feed (pulse);
+	registry.flush ();
+
+	CHECK (nbDecoded == 1);
+
+	CHECK (registry.remove ("x2d"));
+	CHECK (!registry.remove ("x2d"));
+	CHECK (registry.size () == 3);
+	CHECK (strcmp (registry [0].getName (), "pwm") == 0);
+	CHECK (registry [0].getNbMessages () == 1);
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+static void bench ()
+{
+	static const uint8_t bits [] = { 1,0,1,1,0,0,0,1,1,0,1,0,1,0,0,1, 1,1,0,0,1,0,1,0,0,1,1,0,1,0,0,1 };
+
+	ccFlexRegistry registry;
+	HostPrint out;
+	registry.add ("n=x2d,m=OOK_MC_ZEROBIT,s=844,l=0,r=2500", out);
+	registry.add ("n=pwm,m=OOK_PWM,s=848,l=1684,r=3000,y=232", out);
+	registry.add ("n=ppm,m=OOK_PPM,s=400,l=600,r=3000", out);
+	registry.add ("n=pwm2,m=OOK_PWM,s=500,l=1000,r=3000", out);
+
+	std::vector <uint16_t> pulses = makePwmFrame (bits, sizeof (bits));
+	size_t index = 0;
+	hostBench ("flex 4 decoders pulse", 10000000, 0, [&] () {
+		registry.feed (pulses [index]);
+		if (++index == pulses.size ()) index = 0;
+	});
+
+	char name [CCFLEX_NAME_LEN];
+	CCDEMOD_PARAMS params;
+	hostBench ("flex parseSpec", 1000000, 0, [&] () {
+		parse ("n=pwm,m=OOK_PWM,s=848,l=1684,r=1656,g=0,t=0,y=232", params, name);
+	});
+}
+
+HOST_TEST_MAIN (
+	testParseSpec ();
+	testParseErrors ();
+	testParseKeepsDecoder ();
+	testPrintSpec ();
+	testRegistry ();
+	if (isBench) bench ();
+)
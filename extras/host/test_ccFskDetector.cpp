@@ -0,0 +1,157 @@
+//************************************************************************************************************************
+// test_ccFskDetector.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <stdlib.h>
+
+#include <ccFskDetector.h>
+#include <ccSpectrumScanner.h>
+
+#include "HostRuntime.h"
+
+using namespace cc1101;
+
+
+class HostCC1101 : public CC1101
+{
+public:
+	virtual bool sendPacket				(const ccPacketView &) override	{ return false; }
+	virtual void startReceivePacket		(uint8_t) override				{}
+	virtual void stopReceivePacket		(void) override					{}
+};
+
+// Radio without signal: MARCSTATE is IDLE (end of calibration), all the other registers read 0 (empty RX FIFO)
+static uint8_t idleRadio (uint8_t c)
+{
+	static uint8_t address = 0;
+	uint8_t miso = (address == (CC1101_MARCSTATE | READ_BURST)) ? CC_MARCSTATE_IDLE : 0;
+	address = c;
+	return miso;
+}
+
+// Radio stuck in calibration: MARCSTATE never goes back to IDLE, each SPI byte takes 1µs
+static uint8_t stuckRadio (uint8_t)
+{
+	hostMicros++;
+	return CC_MARCSTATE_MANCAL;
+}
+
+//========================================================================================================================
+// DRATE / DEVIATN / CHANBW values of SmartRF Studio
+//========================================================================================================================
+static void testRegisters ()
+{
+	uint8_t e, m, deviatn, chanBw;
+
+	CHECK (ccFskDetector::computeDataRate (38400, e, m) / 100 == 383 && e == 0x0A && m == 0x83);
+	CHECK (ccFskDetector::computeDataRate (1200, e, m) / 10 == 119 && e == 0x05 && m == 0x83);
+	CHECK (ccFskDetector::computeDataRate (100000, e, m) / 100 == 999 && e == 0x0B && m == 0xF8);
+	CHECK (ccFskDetector::computeDeviation (20600, deviatn) / 100 == 206 && deviatn == 0x35);
+	CHECK (ccFskDetector::computeChannelBw (38400 + 41200, chanBw) >= 79600);
+}
+
+//========================================================================================================================
+// Three packets (0xAA preamble + sync word) in noise, with a sync word starting with a 1 then with a 0
+//========================================================================================================================
+static void testFindSyncWords ()
+{
+	uint8_t buffer [CCDETECT_CAPTURE_LEN];
+	FSK_SYNC_VOTES votes;
+
+	srand (1);
+	for (uint8_t & b : buffer) b = rand ();
+	for (uint8_t k = 0; k < 3; k++) {
+		static const uint8_t packet [] = { 0xAA, 0xAA, 0xAA, 0xAA, 0xD3, 0x91, 0x12, 0x34 };
+		memcpy (buffer + 5 + k * 40, packet, sizeof (packet));
+	}
+	ccFskDetector::findSyncWords (buffer, sizeof (buffer) * 8, votes);
+	CHECK (votes.nbSyncWords > 0);
+	CHECK (votes.syncWords [votes.getBest ()] == 0xD391 && votes.counts [votes.getBest ()] == 3);
+
+	for (uint8_t & b : buffer) b = rand ();
+	for (uint8_t k = 0; k < 3; k++) {
+		static const uint8_t packet [] = { 0xAA, 0xAA, 0xAA, 0x2D, 0xD4, 0x00 };
+		memcpy (buffer + 5 + k * 40, packet, sizeof (packet));
+	}
+	votes.clear ();
+	ccFskDetector::findSyncWords (buffer, sizeof (buffer) * 8, votes);
+	CHECK (votes.syncWords [votes.getBest ()] == 0x2DD4 && votes.counts [votes.getBest ()] == 3);
+}
+
+//========================================================================================================================
+// The sweep runs one step per loop () call and never waits: without any signal each candidate is listened to for
+// listenMs of the application time, then the configuration is restored
+//========================================================================================================================
+static void testNonBlockingSweep ()
+{
+	HostCC1101 radio;
+	ccFskDetector detector (radio);
+
+	hostSpiTransfer	= idleRadio;
+	hostMillis		= 1000;
+	CHECK (detector.start (100));
+	uint32_t startMs = hostMillis;									// The calibration waits
+	CHECK (detector.isRunning ());
+	CHECK (!detector.start (100));									// Already running
+
+	for (uint16_t i = 0; i < 1000; i++) CHECK (detector.loop ());	// No time elapsed: still on the first candidate
+	CHECK (hostMillis == startMs);
+
+	uint32_t nbSteps = 0;
+	while (detector.loop () && (nbSteps < 100000)) {
+		hostMillis += 10;
+		nbSteps++;
+	}
+	CHECK (!detector.isRunning ());
+	CHECK (!detector.isDetected () && (detector.getBest () == nullptr));
+	CHECK (detector.getScanDurationMs () == hostMillis - startMs);
+
+	HostPrint report;
+	detector.printTo (report);
+	uint8_t nbLines = 0;
+	for (char c : report.str) if (c == '\n') nbLines++;
+	CHECK (nbLines > 10);											// Every candidate was scanned
+	CHECK (detector.getScanDurationMs () >= nbLines * 100);
+
+	// Abort
+	CHECK (detector.start (100));
+	hostMillis += 150;
+	detector.loop ();
+	detector.stop ();
+	CHECK (!detector.isRunning ());
+	CHECK (!detector.loop ());
+
+	hostSpiTransfer = nullptr;
+}
+
+//========================================================================================================================
+// The calibration gives up after CC1101_CALIBRATION_TIMEOUT_US, its callers report the failure
+//========================================================================================================================
+static void testCalibrationTimeout ()
+{
+	HostCC1101 radio;
+	ccFskDetector detector (radio);
+	ccSpectrumScanner scanner (radio);
+	uint8_t fscal [CC1101_FSCAL_LEN] = { 1, 2, 3 };
+
+	hostSpiTransfer = idleRadio;
+	CHECK (radio.calibrateChannel (0, fscal));
+
+	hostSpiTransfer = stuckRadio;
+	uint32_t startUs = hostMicros;
+	CHECK (!radio.calibrateChannel (0, fscal));
+	CHECK (hostMicros - startUs <= CC1101_CALIBRATION_TIMEOUT_US + 100);
+	CHECK (!detector.start (100) && !detector.isRunning ());
+	CHECK (!scanner.setRange (0, 4) && (scanner.size () == 0));
+
+	hostSpiTransfer = nullptr;
+}
+
+HOST_TEST_MAIN (
+	testRegisters ();
+	testFindSyncWords ();
+	testNonBlockingSweep ();
+	testCalibrationTimeout ();
+)
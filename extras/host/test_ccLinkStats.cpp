@@ -0,0 +1,139 @@
+//************************************************************************************************************************
+// test_ccLinkStats.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <stdlib.h>
+
+#include <cc1101.h>
+#include <ccLinkStats.h>
+
+#include "HostRuntime.h"
+
+using namespace cc1101;
+
+
+static CCPACKET makePacket (uint8_t address, uint8_t lqi = 10, bool crcOk = true)
+{
+	CCPACKET packet;
+	packet.reset ();
+	packet.address	= address;
+	packet.length	= 1;
+	packet.lqi		= lqi;
+	packet.crc_ok	= crcOk;
+	return packet;
+}
+
+// The fixed point EWMA and the getters round down: at most 7/16 + 15/16 below the exact value
+static bool isRoundedDown (double value, double reference)
+{
+	return (value <= reference + 1e-9) && (value >= reference - 1.375);
+}
+
+//========================================================================================================================
+// Fixed point EWMA against a floating point one (weight 1/8), constant input kept exactly
+//========================================================================================================================
+static void testEwma ()
+{
+	ccLinkStats linkStats;
+
+	srand (28);
+	double rssiRef = -60, lqiRef = 10, intervalRef = 0;
+	uint32_t nowMs = 1000;
+	linkStats.update (makePacket (1, 10), -60, nowMs);
+
+	for (uint16_t i = 1; i < 500; i++) {
+
+		int16_t rssi	= -90 + rand () % 50;
+		uint8_t lqi		= rand () % 64;
+		uint32_t interval = 900 + rand () % 200;
+		nowMs += interval;
+		linkStats.update (makePacket (1, lqi), rssi, nowMs);
+
+		rssiRef	+= (rssi - rssiRef) / 8;
+		lqiRef	+= (lqi - lqiRef) / 8;
+		intervalRef = (i == 1) ? interval : intervalRef + (interval - intervalRef) / 8;
+
+		const LINK_STATS * stats = linkStats.find (1);
+		CHECK (isRoundedDown (stats->getRssiDbm (), rssiRef));
+		CHECK (isRoundedDown (stats->getLqi (), lqiRef));
+		CHECK (isRoundedDown (stats->getIntervalMs (), intervalRef));
+	}
+
+	// Steady sender: exact average, no jitter
+	linkStats.reset ();
+	for (uint16_t i = 0; i < 100; i++) linkStats.update (makePacket (2, 20), -75, 100 * i);
+	const LINK_STATS * stats = linkStats.find (2);
+	CHECK ((stats->nbPackets == 100) && (stats->lastArrivalMs == 9900));
+	CHECK ((stats->getRssiDbm () == -75) && (stats->getLqi () == 20));
+	CHECK ((stats->getIntervalMs () == 100) && (stats->getJitterMs () == 0));
+
+	// Arrivals at 90 / 110 ms: the jitter goes to 10 ms
+	linkStats.reset ();
+	nowMs = 0;
+	for (uint16_t i = 0; i < 200; i++) linkStats.update (makePacket (3), -75, nowMs += (i % 2) ? 90 : 110);
+	stats = linkStats.find (3);
+	CHECK ((stats->getIntervalMs () >= 99) && (stats->getIntervalMs () <= 101));
+	CHECK ((stats->getJitterMs () >= 9) && (stats->getJitterMs () <= 11));
+}
+
+//========================================================================================================================
+// Table full: the least recently heard sender is replaced, also across the millis () wrap around
+//========================================================================================================================
+static void testReplacement ()
+{
+	ccLinkStats linkStats;
+
+	uint32_t nowMs = 0xFFFFFFFF - 3;										// Wraps after the 4th sender
+	for (uint8_t address = 1; address <= CCLINKSTATS_MAX_SENDERS; address++) {
+		linkStats.update (makePacket (address), -70, nowMs++);
+	}
+	CHECK (linkStats.size () == CCLINKSTATS_MAX_SENDERS);
+
+	linkStats.update (makePacket (1), -70, nowMs++);						// Sender 1 heard again: 2 is the oldest
+	linkStats.update (makePacket (100), -50, nowMs++);
+	CHECK (linkStats.size () == CCLINKSTATS_MAX_SENDERS);
+	CHECK ((linkStats.find (2) == nullptr) && (linkStats.find (1) != nullptr));
+	CHECK ((linkStats.find (100)->nbPackets == 1) && (linkStats.find (100)->getRssiDbm () == -50));
+
+	linkStats.update (makePacket (101), -50, nowMs++);
+	CHECK ((linkStats.find (3) == nullptr) && (linkStats.find (100) != nullptr) && (linkStats.find (101) != nullptr));
+}
+
+//========================================================================================================================
+// A frame with a bad CRC is only counted: its address is not trusted
+//========================================================================================================================
+static void testCrcErrors ()
+{
+	ccLinkStats linkStats;
+
+	linkStats.update (makePacket (1), -70, 100);
+	linkStats.update (makePacket (1, 60, false), -100, 200);
+	linkStats.update (makePacket (7, 60, false), -100, 300);
+
+	CHECK ((linkStats.size () == 1) && (linkStats.find (7) == nullptr));
+	CHECK ((linkStats.find (1)->nbPackets == 1) && (linkStats.find (1)->getRssiDbm () == -70) && (linkStats.find (1)->lastArrivalMs == 100));
+	CHECK (linkStats.getNbCrcErrors () == 2);
+
+	linkStats.reset ();
+	CHECK ((linkStats.size () == 0) && (linkStats.getNbCrcErrors () == 0));
+}
+
+//========================================================================================================================
+// RSSI byte to dBm (datasheet section 17.3: 2's complement, 0.5 dB per step, minus the offset)
+//========================================================================================================================
+static void testRssiDbm ()
+{
+	CHECK (CC1101::rssiToDbm (72, RSSI_OFFSET_868MHZ) == -38);
+	CHECK (CC1101::rssiToDbm (0xFA, RSSI_OFFSET_868MHZ) == -77);
+	CHECK (CC1101::rssiToDbm (0x80, RSSI_OFFSET_868MHZ) == -138);
+	CHECK (CC1101::rssiToDbm (0x7F, RSSI_OFFSET_433MHZ_HIGH) == -16);
+}
+
+HOST_TEST_MAIN (
+	testEwma ();
+	testReplacement ();
+	testCrcErrors ();
+	testRssiDbm ();
+)
@@ -0,0 +1,167 @@
+//************************************************************************************************************************
+// test_ccPacketCodec.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <ccBasicPacket.h>
+#include <ccPacketCodec.h>
+#include <ccPacketParser.h>
+#include <ccPacketStorage.h>
+
+#include "HostRuntime.h"
+
+using namespace cc1101;
+
+
+static CCPACKET makePacket (uint8_t address, uint8_t seed, uint8_t length)
+{
+	CCPACKET packet;
+	packet.reset ();
+	packet.address	= address;
+	packet.length	= length;
+	packet.crc_ok	= true;
+	packet.rssi		= 0x80 + seed;
+	packet.lqi		= seed & 0x7F;
+	packet.channel	= seed;
+	for (uint8_t i = 0; i < length; i++) packet.data [i] = seed * 7 + i;
+	return packet;
+}
+
+static CCPACKET_META makeMeta (uint8_t seed)
+{
+	CCPACKET_META meta;
+	meta.timestampMs	= 123456 + seed;
+	meta.frequencyHz	= 433445000;
+	meta.profile		= 3;
+	return meta;
+}
+
+static bool isSamePacket (const CCPACKET & a, const CCPACKET & b)
+{
+	return (a.length == b.length) && (a.address == b.address) && (memcmp (a.data, b.data, a.length) == 0);
+}
+
+//========================================================================================================================
+// Record round trip with and without metadata, the status bytes and the metadata are kept
+//========================================================================================================================
+static void testRoundTrip ()
+{
+	uint8_t record [CCCODEC_MAX_RECORD_LEN];
+
+	for (uint8_t length = 1; length <= CCPACKET_DATA_LEN; length += 17) {
+
+		CCPACKET packet = makePacket (0x5D, length, length);
+		CCPACKET_META meta = makeMeta (length);
+
+		size_t len = ccPacketCodec::encode (packet, &meta, record, sizeof (record));
+		CHECK (len == ccPacketCodec::getEncodedSize (packet, &meta));
+		CHECK (ccPacketCodec::isRecord (record, len));
+
+		CCPACKET decoded;
+		CCPACKET_META decodedMeta;
+		CHECK (ccPacketCodec::decode (record, len, decoded, &decodedMeta) == len);
+		CHECK (isSamePacket (packet, decoded));
+		CHECK ((decoded.rssi == packet.rssi) && (decoded.lqi == packet.lqi) && (decoded.crc_ok == packet.crc_ok));
+		CHECK ((decodedMeta.timestampMs == meta.timestampMs) && (decodedMeta.frequencyHz == meta.frequencyHz) && (decodedMeta.profile == meta.profile));
+
+		size_t noMetaLen = ccPacketCodec::encode (packet, nullptr, record, sizeof (record));
+		CHECK (noMetaLen < len);
+		CHECK (ccPacketCodec::decode (record, noMetaLen, decoded, &decodedMeta) == noMetaLen);
+		CHECK (decodedMeta.timestampMs == 0);
+	}
+}
+
+//========================================================================================================================
+// The meta written with a packet is read back, the exporter gives the same batch as exportAll in chunks of any size
+//========================================================================================================================
+static void testStorageExport ()
+{
+	memFs.files.clear ();
+
+	for (uint8_t id = 1; id <= 5; id++) {
+		CCPACKET_META meta = makeMeta (id);
+		CHECK (I(ccPacketStorage).write (id * 10, makePacket (id, id, 20 + id * 10), &meta));
+	}
+
+	CCPACKET packet;
+	CCPACKET_META meta;
+	CHECK (I(ccPacketStorage).read (30, packet, &meta));
+	CHECK (isSamePacket (packet, makePacket (3, 3, 50)) && (meta.timestampMs == makeMeta (3).timestampMs) && (meta.frequencyHz == 433445000));
+
+	HostPrint all;
+	CHECK (I(ccPacketStorage).exportAll (all) == 5);
+
+	for (size_t chunk : { (size_t) 1, (size_t) 7, (size_t) CCCODEC_MAX_RECORD_LEN, (size_t) 4096 }) {
+
+		ccPacketStorageExporter exporter;
+		std::string batch;
+		uint8_t buffer [4096];
+		size_t len, maxLen = 0;
+		while ((len = exporter.read (buffer, chunk)) > 0) {
+			batch.append ((const char *) buffer, len);
+			maxLen = std::max (maxLen, len);
+		}
+		CHECK (batch == all.str);
+		CHECK (exporter.count () == 5);
+		CHECK (maxLen <= CCCODEC_MAX_RECORD_LEN);						// One record at most per chunk
+	}
+
+	ccPacketBatchReader reader ((const uint8_t *) all.str.data (), all.str.size ());
+	uint8_t nbPackets = 0;
+	while (reader.next (packet, &meta)) {
+		CHECK (meta.id == packet.address * 10);
+		CHECK (isSamePacket (packet, makePacket (packet.address, packet.address, 20 + packet.address * 10)));
+		nbPackets++;
+	}
+	CHECK (reader.isValid () && (nbPackets == 5));
+
+	memFs.files.clear ();
+	ccPacketStorageExporter empty;
+	uint8_t header [8];
+	CHECK (empty.read (header, sizeof (header)) == CCCODEC_BATCH_HEADER_LEN);
+	CHECK (empty.read (header, sizeof (header)) == 0);
+}
+
+//========================================================================================================================
+// Binary record against the text format (ccPacketPrinter / ccPacketParser): time and size
+//========================================================================================================================
+static void benchBinaryVsText ()
+{
+	CCPACKET packet = makePacket (0x5D, 1, 60);
+	CCPACKET_META meta = makeMeta (1);
+
+	uint8_t record [CCCODEC_MAX_RECORD_LEN];
+	size_t recordLen = ccPacketCodec::encode (packet, &meta, record, sizeof (record));
+
+	char text [CCPACKET_TEXT_MAX_LEN];
+	size_t textLen = ccPacketPrinter (packet).format (text, sizeof (text));
+
+	printf ("bench 60 bytes packet: binary record %zu bytes, text %zu bytes\n", recordLen, textLen);
+
+	CCPACKET decoded;
+	CCPACKET_META decodedMeta;
+	ccPacketParser parser (decoded);
+
+	hostBench ("codec encode", 1000000, packet.length, [&] () {
+		ccPacketCodec::encode (packet, &meta, record, sizeof (record));
+	});
+	hostBench ("codec decode", 1000000, packet.length, [&] () {
+		ccPacketCodec::decode (record, recordLen, decoded, &decodedMeta);
+	});
+	hostBench ("text format", 1000000, packet.length, [&] () {
+		ccPacketPrinter (packet).format (text, sizeof (text));
+	});
+	hostBench ("text parse", 200000, packet.length, [&] () {
+		parser.reset ();
+		parser.feed ((const uint8_t *) text, textLen);
+		parser.flush ();
+	});
+	CHECK (isSamePacket (packet, decoded));
+}
+
+HOST_TEST_MAIN (
+	testRoundTrip ();
+	testStorageExport ();
+	if (isBench) benchBinaryVsText ();
+)
@@ -0,0 +1,178 @@
+//************************************************************************************************************************
+// test_ccPacketCompressor.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <stdlib.h>
+
+#include <ccPacketCompressor.h>
+
+#include "HostRuntime.h"
+
+using namespace cc1101;
+
+
+/**
+ * Payloads of the benchmark
+ */
+struct CORPUS
+{
+	const char *	name;
+	uint8_t			data [CCPACKET_DATA_LEN];
+	uint8_t			length;
+};
+
+static std::vector <CORPUS> makeCorpus ()
+{
+	std::vector <CORPUS> corpus;
+	CORPUS item;
+
+	// 8 records of 8 bytes: id, sequence, temperature, humidity, battery (slow changing values)
+	item = CORPUS ();
+	item.name = "telemetry 8x8B records";
+	for (uint8_t r = 0; r < 8; r++) {
+		const uint8_t record [8] = { 0x5D, (uint8_t) r, 0x00, 0xD2, (uint8_t) (0x40 + (r & 1)), 0x37, 0x0B, 0xB8 };
+		memcpy (item.data + 8 * r, record, 8);
+	}
+	item.length = 64;
+	corpus.push_back (item);
+
+	item = CORPUS ();
+	item.name = "json telemetry";
+	const char * json = "{\"id\":93,\"temp\":21.0,\"hum\":55,\"bat\":3000,\"temp2\":21.5,\"hum2\":54,\"bat2\":2990}";
+	item.length = strlen (json);
+	memcpy (item.data, json, item.length);
+	corpus.push_back (item);
+
+	item = CORPUS ();
+	item.name = "sparse 96B";
+	item.length = 96;
+	for (uint8_t i = 0; i < 96; i += 12) item.data [i] = i + 1;
+	corpus.push_back (item);
+
+	item = CORPUS ();
+	item.name = "random 96B";
+	item.length = 96;
+	srand (48);
+	for (uint8_t i = 0; i < 96; i++) item.data [i] = rand ();
+	corpus.push_back (item);
+
+	return corpus;
+}
+
+//========================================================================================================================
+// pack => unpack gives the payload back, raw when the compression doesn't make it shorter
+//========================================================================================================================
+static void testPackUnpack ()
+{
+	for (const CORPUS & item : makeCorpus ()) {
+
+		CCPACKET packed;
+		CHECK (ccPacketCompressor::pack (ccPacketView (item.data, item.length, 0x5D), packed));
+		CHECK (packed.address == 0x5D);
+		CHECK (packed.length <= item.length + CCLZ_HEADER_LEN);
+
+		bool isRandom = (strncmp (item.name, "random", 6) == 0);
+		CHECK (packed.data [0] == (isRandom ? CCLZ_HEADER_RAW : CCLZ_HEADER_COMPRESSED));
+
+		CHECK (ccPacketCompressor::unpack (packed));
+		CHECK ((packed.length == item.length) && (memcmp (packed.data, item.data, item.length) == 0));
+	}
+
+	CCPACKET packet;
+	packet.reset ();
+	packet.length	= 3;
+	packet.data [0]	= 0x7F;												// Unknown header
+	CHECK (!ccPacketCompressor::unpack (packet) && (packet.length == 0));
+}
+
+//========================================================================================================================
+// Random payloads with repeats: compress => decompress (in one call and streamed in random chunks)
+//========================================================================================================================
+static void testRoundTrip ()
+{
+	srand (4848);
+	for (uint32_t i = 0; i < 20000; i++) {
+
+		uint8_t in [CCLZ_MAX_INPUT_LEN], out [CCLZ_MAX_INPUT_LEN + 40], back [CCLZ_MAX_INPUT_LEN];
+		size_t len = 1 + rand () % CCLZ_MAX_INPUT_LEN;
+		uint8_t alphabet = 1 + rand () % 16;
+		for (size_t k = 0; k < len; k++) {
+			in [k] = ((k > 8) && (rand () % 2)) ? in [k - 1 - rand () % 8] : rand () % alphabet;
+		}
+
+		size_t packed = ccPacketCompressor::compress (in, len, out, sizeof (out));
+		if (packed == 0) continue;										// Not shorter
+		CHECK (packed < len);
+
+		CHECK (ccPacketCompressor::decompress (out, packed, back, sizeof (back)) == len);
+		CHECK (memcmp (in, back, len) == 0);
+
+		ccLzDecoder decoder (back, sizeof (back));
+		size_t pos = 0;
+		while (pos < packed) {
+			size_t n = 1 + rand () % (packed - pos);
+			decoder.feed (out + pos, n);
+			pos += n;
+		}
+		CHECK ((decoder.finish () == len) && (memcmp (in, back, len) == 0));
+
+		// Output capacity one byte short: error, never an overflow
+		std::vector <uint8_t> small (len - 1);
+		CHECK (ccPacketCompressor::decompress (out, packed, small.data (), small.size ()) == 0);
+	}
+}
+
+//========================================================================================================================
+// Random streams: the output stays in the buffer (ASan), errors are reported
+//========================================================================================================================
+static void fuzzDecoder (uint32_t nbRuns)
+{
+	srand (484848);
+	uint32_t nbErrors = 0;
+	for (uint32_t i = 0; i < nbRuns; i++) {
+
+		uint8_t in [64];
+		size_t len = 1 + rand () % sizeof (in);
+		for (size_t k = 0; k < len; k++) in [k] = rand ();
+
+		size_t capacity = 1 + rand () % CCPACKET_DATA_LEN;
+		std::vector <uint8_t> out (capacity);
+		if (ccPacketCompressor::decompress (in, len, out.data (), capacity) == 0) nbErrors++;
+	}
+	CHECK (nbErrors > 0);
+}
+
+//========================================================================================================================
+// Wire size (header included) and time per packet of each payload
+//========================================================================================================================
+static void benchCompressor ()
+{
+	for (const CORPUS & item : makeCorpus ()) {
+
+		CCPACKET packed;
+		ccPacketCompressor::pack (ccPacketView (item.data, item.length), packed);
+		printf ("bench %-28s %3u -> %3u bytes (%u%%)\n", item.name, item.length, packed.length, (100 * packed.length) / item.length);
+
+		std::string name = std::string ("pack ") + item.name;
+		hostBench (name.c_str (), 200000, item.length, [&] () {
+			ccPacketCompressor::pack (ccPacketView (item.data, item.length), packed);
+		});
+
+		CCPACKET unpacked;
+		name = std::string ("unpack ") + item.name;
+		hostBench (name.c_str (), 200000, item.length, [&] () {
+			unpacked = packed;
+			ccPacketCompressor::unpack (unpacked);
+		});
+		CHECK ((unpacked.length == item.length) && (memcmp (unpacked.data, item.data, item.length) == 0));
+	}
+}
+
+HOST_TEST_MAIN (
+	testPackUnpack ();
+	testRoundTrip ();
+	fuzzDecoder (isBench ? 1000000 : 100000);
+	if (isBench) benchCompressor ();
+)
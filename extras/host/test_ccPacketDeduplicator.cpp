@@ -0,0 +1,104 @@
+//************************************************************************************************************************
+// test_ccPacketDeduplicator.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <ccPacketDeduplicator.h>
+
+#include "HostRuntime.h"
+
+using namespace cc1101;
+
+
+static CCPACKET makePacket (uint8_t address, uint8_t seed, uint8_t length = 10)
+{
+	CCPACKET packet;
+	packet.address	= address;
+	packet.length	= length;
+	for (uint8_t i = 0; i < length; i++) packet.data [i] = seed + i;
+	return packet;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+static void testDisabledByDefault ()
+{
+	ccPacketDeduplicator dedup;
+	CCPACKET packet = makePacket (1, 1);
+
+	CHECK (dedup.getWindow () == 0);
+	CHECK (dedup.filter (packet, 0) == 1);
+	CHECK (dedup.filter (packet, 1) == 1);
+}
+
+//========================================================================================================================
+// A burst of copies within the window is counted, the window is measured from the first copy
+//========================================================================================================================
+static void testBurst ()
+{
+	ccPacketDeduplicator dedup (CCPACKET_DEDUP_WINDOW_MS);
+	CCPACKET packet = makePacket (1, 1);
+
+	CHECK (dedup.filter (packet, 0) == 1);
+	CHECK (dedup.filter (packet, 100) == 2);
+	CHECK (dedup.filter (packet, 900) == 3);
+	CHECK (dedup.filter (packet, 1001) == 1);						// Window not extended by the copies
+
+	CCPACKET other = makePacket (2, 1);
+	CHECK (dedup.filter (other, 1002) == 1);
+	CHECK (dedup.filter (packet, 1003) == 2);
+}
+
+//========================================================================================================================
+// A sensor repeating the same payload every 600 ms (faster than the window) is reported every other frame, never
+// suppressed forever
+//========================================================================================================================
+static void testPeriodicSensor ()
+{
+	ccPacketDeduplicator dedup (CCPACKET_DEDUP_WINDOW_MS);
+	CCPACKET packet = makePacket (3, 7);
+
+	uint16_t nbReported = 0;
+	for (uint32_t t = 0; t < 60000; t += 600) {
+		if (dedup.filter (packet, t) == 1) nbReported++;
+	}
+	CHECK (nbReported == 50);
+}
+
+//========================================================================================================================
+// More keys than slots: no false duplicate, bounded probing
+//========================================================================================================================
+static void testManyKeys ()
+{
+	ccPacketDeduplicator dedup (CCPACKET_DEDUP_WINDOW_MS);
+
+	for (uint16_t i = 0; i < 1000; i++) {
+		CHECK (dedup.filter (makePacket (i & 0xFF, i >> 8), i) == 1);
+	}
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+static void bench ()
+{
+	ccPacketDeduplicator dedup (CCPACKET_DEDUP_WINDOW_MS);
+	CCPACKET packets [32];
+	for (uint8_t i = 0; i < 32; i++) packets [i] = makePacket (i, i * 3, 60);
+
+	uint32_t now = 0;
+	uint8_t index = 0;
+	hostBench ("dedup.filter 60B", 1000000, 60, [&] () {
+		dedup.filter (packets [index++ & 31], now++);
+	});
+}
+
+HOST_TEST_MAIN (
+	testDisabledByDefault ();
+	testBurst ();
+	testPeriodicSensor ();
+	testManyKeys ();
+	if (isBench) bench ();
+)
@@ -0,0 +1,338 @@
+//************************************************************************************************************************
+// test_ccPacketEngine.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <stdlib.h>
+
+#include <cc1101.h>
+#include <ccPacketEngine.h>
+
+#include "HostRuntime.h"
+
+using namespace cc1101;
+
+
+//========================================================================================================================
+// CRC check value of "123456789" (polynomial 0x8005, init 0xFFFF, CC1101 DN502) and first PN9 bytes (CC1101 datasheet,
+// section 15.1)
+//========================================================================================================================
+static void testDatasheetVectors ()
+{
+	const uint8_t check [] = "123456789";
+
+	CHECK (ccCrc16::compute (check, 9) == 0xAEE7);
+
+	uint16_t crc = CCCRC16_INIT;
+	for (uint8_t i = 0; i < 9; i++) crc = ccCrc16::updateBitwise (crc, check [i]);
+	CHECK (crc == 0xAEE7);
+
+	const uint8_t pn9 [16] = { 0xFF, 0xE1, 0x1D, 0x9A, 0xED, 0x85, 0x33, 0x24, 0xEA, 0x7A, 0xD2, 0x39, 0x70, 0x97, 0x57, 0x0A };
+	ccPn9Whitening whitening;
+	for (uint8_t i = 0; i < sizeof (pn9); i++) CHECK (whitening.next () == pn9 [i]);
+
+	// Whole period (511 bytes) and beyond against the LFSR
+	uint16_t state = CCPN9_INIT;
+	whitening.reset ();
+	for (uint16_t i = 0; i < 3000; i++) CHECK (ccPn9Whitening::stepBitwise (state) == whitening.next ());
+}
+
+//========================================================================================================================
+// Table and slicing-by-4 CRC, table whitening == bitwise references, on random buffers fed in random chunks
+//========================================================================================================================
+static void testIncremental ()
+{
+	uint8_t buffer [1000], whitened [1000];
+
+	srand (49);
+	for (uint16_t t = 0; t < 2000; t++) {
+
+		size_t len = rand () % sizeof (buffer);
+		for (size_t i = 0; i < len; i++) buffer [i] = rand ();
+
+		uint16_t reference = CCCRC16_INIT;
+		for (size_t i = 0; i < len; i++) reference = ccCrc16::updateBitwise (reference, buffer [i]);
+
+		ccCrc16 crc;
+		for (size_t pos = 0; pos < len; ) {
+			size_t n = std::min ((size_t) rand () % 13, len - pos);
+			if (n == 1)	crc.update (buffer [pos]);
+			else		crc.update (buffer + pos, n);
+			pos += n;
+		}
+		CHECK (crc.get () == reference);
+
+		memcpy (whitened, buffer, len);
+		ccPn9Whitening whitening;
+		for (size_t pos = 0; pos < len; ) {
+			size_t n = std::min ((size_t) rand () % 600, len - pos);
+			whitening.apply (whitened + pos, n);
+			pos += n;
+		}
+		uint16_t state = CCPN9_INIT;
+		bool isSame = true;
+		for (size_t i = 0; i < len; i++) isSame &= (whitened [i] == (buffer [i] ^ ccPn9Whitening::stepBitwise (state)));
+		CHECK (isSame);
+	}
+}
+
+//========================================================================================================================
+// encode => decode in the 16 formats, a corrupted byte clears crc_ok, a truncated frame is rejected
+//========================================================================================================================
+static void testRoundTrip ()
+{
+	srand (4949);
+	for (uint8_t format = 0; format < 16; format++) {
+
+		CCFRAME_FORMAT frameFormat;
+		frameFormat.isVariableLength	= format & 1;
+		frameFormat.isAddressCheck		= format & 2;
+		frameFormat.isCrc				= format & 4;
+		frameFormat.isWhitening			= format & 8;
+
+		uint8_t data [61];
+		for (uint8_t & b : data) b = rand ();
+
+		uint8_t frame [80];
+		size_t len = ccPacketEngine::encode (ccPacketView (data, sizeof (data), 0x42), frameFormat, frame, sizeof (frame));
+		CHECK (len == ccPacketEngine::getFrameSize (sizeof (data), frameFormat));
+		CHECK (ccPacketEngine::encode (ccPacketView (data, sizeof (data), 0x42), frameFormat, frame, len - 1) == 0);
+
+		CCPACKET packet;
+		CHECK (ccPacketEngine::decode (frame, len, frameFormat, packet));
+		CHECK ((packet.length == sizeof (data)) && (memcmp (packet.data, data, sizeof (data)) == 0) && packet.crc_ok);
+		if (frameFormat.isAddressCheck) CHECK (packet.address == 0x42);
+
+		if (frameFormat.isCrc) {
+			frame [len - 3] ^= 0x10;
+			if (ccPacketEngine::decode (frame, len, frameFormat, packet)) CHECK (!packet.crc_ok);
+		}
+	}
+
+	CCFRAME_FORMAT frameFormat;
+	const uint8_t truncated [8] = { 20, 1, 2, 3, 4, 5, 6, 7 };
+	CCPACKET packet;
+	CHECK (!ccPacketEngine::decode (truncated, sizeof (truncated), frameFormat, packet));
+}
+
+// Convolutional code straight from the polynomials G0 = 1111, G1 = 1101 (CC1101 DN504), before the interleaving
+static void encodeReference (const uint8_t * in, size_t len, uint8_t * out)
+{
+	memset (out, 0, 2 * len);
+	uint8_t state = 0;												// Bit 0: most recent input bit
+	size_t k = 0;
+	for (size_t i = 0; i < len; i++) {
+		for (int8_t b = 7; b >= 0; b--) {
+			uint8_t u = (in [i] >> b) & 1, d1 = state & 1, d2 = (state >> 1) & 1, d3 = (state >> 2) & 1;
+			out [k / 8] |= (u ^ d2 ^ d3) << (7 - k % 8);		k++;
+			out [k / 8] |= (u ^ d1 ^ d2 ^ d3) << (7 - k % 8);	k++;
+			state = ((state << 1) | u) & 7;
+		}
+	}
+}
+
+static CCFRAME_FORMAT makeFecFormat (uint8_t format, uint8_t length)
+{
+	CCFRAME_FORMAT frameFormat;
+	frameFormat.isVariableLength	= format & 1;
+	frameFormat.isAddressCheck		= format & 2;
+	frameFormat.isWhitening			= format & 4;
+	frameFormat.isFec				= true;
+	if (!frameFormat.isVariableLength) frameFormat.length = length;
+	return frameFormat;
+}
+
+//========================================================================================================================
+// FEC encoder == polynomials, interleaver is its own inverse, decode corrects single and burst errors, no FEC decode
+// without a decoder
+//========================================================================================================================
+static void testFec ()
+{
+	srand (50);
+	for (uint8_t t = 0; t < 200; t++) {
+		uint8_t in [40], reference [80], encoded [80];
+		for (uint8_t & b : in) b = rand ();
+		encodeReference (in, sizeof (in), reference);
+		CHECK (ccFecEncoder::encode (in, sizeof (in), encoded, sizeof (encoded)) == sizeof (encoded));
+		for (uint8_t i = 0; i < sizeof (encoded); i += CCFEC_INTERLEAVE_BLOCK) ccFecEncoder::interleave (encoded + i);
+		CHECK (memcmp (reference, encoded, sizeof (encoded)) == 0);
+
+		uint8_t block [CCFEC_INTERLEAVE_BLOCK], original [CCFEC_INTERLEAVE_BLOCK];
+		for (uint8_t & b : block) b = rand ();
+		memcpy (original, block, sizeof (block));
+		ccFecEncoder::interleave (block);
+		ccFecEncoder::interleave (block);
+		CHECK (memcmp (original, block, sizeof (block)) == 0);
+	}
+	CHECK ((ccFecEncoder::getTerminatedSize (62) == 64) && (ccFecEncoder::getTerminatedSize (63) == 64));
+
+	std::unique_ptr <ccViterbiDecoder> viterbiDecoder (new ccViterbiDecoder ());
+	for (uint8_t format = 0; format < 8; format++) {
+
+		CCFRAME_FORMAT frameFormat = makeFecFormat (format, 59);
+		uint8_t data [59];
+		for (uint8_t & b : data) b = rand ();
+
+		uint8_t frame [300];
+		size_t len = ccPacketEngine::encode (ccPacketView (data, sizeof (data), 0x56), frameFormat, frame, sizeof (frame));
+		CHECK ((len == ccPacketEngine::getFrameSize (sizeof (data), frameFormat)) && (len % CCFEC_INTERLEAVE_BLOCK == 0));
+
+		CCPACKET packet;
+		CHECK (!ccPacketEngine::decode (frame, len, frameFormat, packet));
+		CHECK (ccPacketEngine::decode (frame, len, frameFormat, packet, viterbiDecoder.get ()));
+		CHECK (packet.crc_ok && (packet.length == sizeof (data)) && (memcmp (packet.data, data, sizeof (data)) == 0));
+		CHECK (viterbiDecoder->getNbCorrected () == 0);
+
+		frame [10] ^= 0x0C;												// One burst of 2 bits
+		frame [40] ^= 0x81;												// 2 isolated bits
+		CHECK (ccPacketEngine::decode (frame, len, frameFormat, packet, viterbiDecoder.get ()));
+		CHECK (packet.crc_ok && (memcmp (packet.data, data, sizeof (data)) == 0));
+		CHECK (viterbiDecoder->getNbCorrected () == 4);
+	}
+
+	CCFRAME_FORMAT frameFormat = makeFecFormat (0, 0);					// Fixed length without length: no terminator
+	const uint8_t frame [8] = { 0 };
+	CCPACKET packet;
+	CHECK (!ccPacketEngine::decode (frame, sizeof (frame), frameFormat, packet, viterbiDecoder.get ()));
+}
+
+class HostCC1101 : public CC1101
+{
+public:
+	virtual bool sendPacket				(const ccPacketView &) override	{ return false; }
+	virtual void startReceivePacket		(uint8_t) override				{}
+	virtual void stopReceivePacket		(void) override					{}
+};
+
+static uint32_t hostRandomBits = 0;										// xorshift32, independent of rand ()
+
+static bool isBitError (double probability)
+{
+	hostRandomBits ^= hostRandomBits << 13;
+	hostRandomBits ^= hostRandomBits >> 17;
+	hostRandomBits ^= hostRandomBits << 5;
+	return hostRandomBits < probability * 4294967296.;
+}
+
+// Packet error rate of a 59 bytes payload: random bit errors, or Gilbert-Elliott bursts (mean 4 bits, half of the bits
+// wrong in a burst) with the same mean bit error rate
+static double getPacketErrorRate (const CCFRAME_FORMAT & frameFormat, ccViterbiDecoder * viterbiDecoder, double ber, bool isBurst, uint32_t nbPackets)
+{
+	uint32_t nbErrors = 0;
+	for (uint32_t t = 0; t < nbPackets; t++) {
+
+		uint8_t data [59], frame [300];
+		for (uint8_t & b : data) b = rand ();
+		size_t len = ccPacketEngine::encode (ccPacketView (data, sizeof (data), 0x56), frameFormat, frame, sizeof (frame));
+
+		bool isInBurst = false;
+		for (size_t i = 0; i < len * 8; i++) {
+			if (isBurst) {
+				if (isInBurst)	isInBurst = !isBitError (0.25);
+				else			isInBurst = isBitError (ber / 2);
+			}
+			if (isBurst ? (isInBurst && isBitError (0.5)) : isBitError (ber)) frame [i / 8] ^= 0x80 >> (i % 8);
+		}
+
+		CCPACKET packet;
+		bool isOk = ccPacketEngine::decode (frame, len, frameFormat, packet, viterbiDecoder);
+		if (!isOk || !packet.crc_ok || (memcmp (packet.data, data, sizeof (data)) != 0)) nbErrors++;
+	}
+	return (double) nbErrors / nbPackets;
+}
+
+//========================================================================================================================
+// Fixed length profile (PKTLEN 60 = address + 59 bytes, CRC) with and without FEC: airtime at each DATA_RATE, packet
+// error rate against the bit error rate. The FEC doubles the frame but must cut the PER of a noisy channel
+//========================================================================================================================
+static void simulateFec (bool isBench)
+{
+	CCFRAME_FORMAT plain;
+	plain.isVariableLength	= false;
+	plain.isAddressCheck	= true;
+	plain.length			= 59;
+	CCFRAME_FORMAT fec		= plain;
+	fec.isFec				= true;
+
+	HostCC1101 radio;
+	hostSpiTransfer = hostRegisterFile;
+
+	const struct { DATA_RATE dataRate; const char * name; } rates [] = { { KBPS_250, "KBPS_250" }, { KBPS_38, "KBPS_38" }, { KBPS_4, "KBPS_4" } };
+	if (isBench) printf ("\n%-9s %7s %10s %10s   (59 bytes, preamble + sync + frame of %zu / %zu bytes)\n", "rate", "baud", "plain us", "fec us",
+						 ccPacketEngine::getFrameSize (59, plain), ccPacketEngine::getFrameSize (59, fec));
+	for (auto & rate : rates) {
+		radio.setDataRate (rate.dataRate);
+		uint32_t baud = radio.getDataRateBaud ();
+		uint32_t plainUs = ccPacketEngine::getAirtimeUs (59, plain, baud), fecUs = ccPacketEngine::getAirtimeUs (59, fec, baud);
+		CHECK ((plainUs > 0) && (fecUs > plainUs) && (fecUs < 2 * plainUs));
+		if (isBench) printf ("%-9s %7u %10u %10u\n", rate.name, baud, plainUs, fecUs);
+	}
+	CHECK (radio.getDataRateBaud () > 3000);								// Registers read back
+	hostSpiTransfer = nullptr;
+
+	std::unique_ptr <ccViterbiDecoder> viterbiDecoder (new ccViterbiDecoder ());
+	srand (5050);
+	hostRandomBits = 5050;
+	uint32_t nbPackets = isBench ? 20000 : 1000;
+
+	const double noisy = 1e-2;
+	double plainPer = getPacketErrorRate (plain, nullptr, noisy, false, nbPackets);
+	double fecPer = getPacketErrorRate (fec, viterbiDecoder.get (), noisy, false, nbPackets);
+	CHECK ((plainPer > 0.9) && (fecPer < 0.2));
+
+	if (!isBench) return;
+	for (bool isBurst : { false, true }) {
+		printf ("\nPER, %s\n%-8s %8s %8s\n", isBurst ? "burst errors (mean 4 bits)" : "random bit errors", "BER", "plain", "fec");
+		for (double ber : { 1e-4, 3e-4, 1e-3, 3e-3, 1e-2, 2e-2, 3e-2 }) {
+			printf ("%-8.0e %8.4f %8.4f\n", ber, getPacketErrorRate (plain, nullptr, ber, isBurst, nbPackets),
+					getPacketErrorRate (fec, viterbiDecoder.get (), ber, isBurst, nbPackets));
+		}
+	}
+
+	uint8_t data [59] = { 1 }, frame [300];
+	size_t len = ccPacketEngine::encode (ccPacketView (data, sizeof (data), 0x56), fec, frame, sizeof (frame));
+	CCPACKET packet;
+	hostBench ("viterbi decode 60 bytes", 20000, 59, [&] () {
+		ccPacketEngine::decode (frame, len, fec, packet, viterbiDecoder.get ());
+	});
+}
+
+//========================================================================================================================
+// Bytes per cycle of the CRC implementations and of the whitening, on 4 KB
+//========================================================================================================================
+static void benchCrcWhitening ()
+{
+	static uint8_t buffer [4096];
+	for (uint8_t & b : buffer) b = rand ();
+	volatile uint16_t sink = 0;
+
+	hostBench ("crc bitwise 4KB", 2000, sizeof (buffer), [&] () {
+		uint16_t crc = CCCRC16_INIT;
+		for (uint8_t b : buffer) crc = ccCrc16::updateBitwise (crc, b);
+		sink = crc;
+	});
+	hostBench ("crc table 4KB", 20000, sizeof (buffer), [&] () {
+		ccCrc16 crc;
+		for (uint8_t b : buffer) crc.update (b);
+		sink = crc.get ();
+	});
+	hostBench ("crc slicing-by-4 4KB", 20000, sizeof (buffer), [&] () {
+		sink = ccCrc16::compute (buffer, sizeof (buffer));
+	});
+	hostBench ("pn9 whitening 4KB", 20000, sizeof (buffer), [&] () {
+		ccPn9Whitening whitening;
+		whitening.apply (buffer, sizeof (buffer));
+		sink = buffer [7];
+	});
+	(void) sink;
+}
+
+HOST_TEST_MAIN (
+	testDatasheetVectors ();
+	testIncremental ();
+	testRoundTrip ();
+	testFec ();
+	simulateFec (isBench);
+	if (isBench) benchCrcWhitening ();
+)
@@ -0,0 +1,196 @@
+//************************************************************************************************************************
+// test_ccPacketParser.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <stdlib.h>
+
+#include <ccBasicPacket.h>
+#include <ccPacketParser.h>
+
+#include "HostRuntime.h"
+
+using namespace cc1101;
+
+
+static CCPACKET makeRandomPacket ()
+{
+	CCPACKET packet;
+	packet.reset ();
+	packet.length	= 1 + rand () % CCPACKET_DATA_LEN;
+	packet.address	= rand ();
+	packet.crc_ok	= rand () & 1;
+	packet.rssi		= rand ();
+	packet.lqi		= rand ();
+	for (uint8_t i = 0; i < packet.length; i++) packet.data [i] = rand ();
+	return packet;
+}
+
+static bool isSamePacket (const CCPACKET & a, const CCPACKET & b)
+{
+	return	(a.length == b.length) && (a.address == b.address) && (memcmp (a.data, b.data, a.length) == 0) &&
+			(a.crc_ok == b.crc_ok) && (a.rssi == b.rssi) && (a.lqi == b.lqi);
+}
+
+// Text fed in random chunks
+static CCPARSE_STATUS parse (ccPacketParser & parser, const std::string & text)
+{
+	parser.reset ();
+	size_t pos = 0;
+	while ((pos < text.size ()) && (parser.getStatus () == CCPARSE_MORE)) {
+		size_t len = 1 + rand () % (text.size () - pos);
+		size_t n = parser.feed ((const uint8_t *) text.data () + pos, len);
+		pos += n;
+		if (n < len) break;											// Stopped at the packet end or on error
+	}
+	return (parser.getStatus () == CCPARSE_MORE) ? parser.flush () : parser.getStatus ();
+}
+
+static std::string format (const CCPACKET & packet)
+{
+	char text [CCPACKET_TEXT_MAX_LEN];
+	size_t len = ccPacketPrinter (packet).format (text, sizeof (text));
+	return std::string (text, len);
+}
+
+//========================================================================================================================
+// Only 0-9, a-f and A-F are hex digits (no Latin-1 superscripts)
+//========================================================================================================================
+static void testDigits ()
+{
+	CCPACKET packet;
+	ccPacketParser parser (packet);
+
+	for (uint16_t c = 0; c < 256; c++) {
+
+		std::string text = "L-1 A-00 [0";
+		text += (char) c;
+		text += "] OK S-00 Q-00";
+
+		bool isHex = isxdigit (c);
+		CHECK ((parse (parser, text) == CCPARSE_DONE) == isHex);
+		if (isHex) CHECK (packet.data [0] == (uint8_t) strtol (text.substr (10, 2).c_str (), nullptr, 16));
+	}
+}
+
+//========================================================================================================================
+// Round trip oracle: format => parse (random chunks) => same packet, format again => same text
+//========================================================================================================================
+static void testRoundTrip ()
+{
+	CCPACKET parsed;
+	ccPacketParser parser (parsed);
+
+	srand (45);
+	for (uint32_t i = 0; i < 20000; i++) {
+
+		CCPACKET packet = makeRandomPacket ();
+		std::string text = format (packet);
+
+		CHECK (parse (parser, text) == CCPARSE_DONE);
+		CHECK (isSamePacket (packet, parsed));
+		CHECK (format (parsed) == text);
+	}
+}
+
+//========================================================================================================================
+// Mutated texts (bytes replaced, inserted, removed, truncated): no overflow, a parsed packet is always complete and
+// formats back to a text parsed to the same packet, a failed parse leaves a 0 length
+//========================================================================================================================
+static void fuzzMutations (uint32_t nbRuns)
+{
+	CCPACKET parsed, reparsed;
+	ccPacketParser parser (parsed);
+	ccPacketParser reparser (reparsed);
+
+	srand (4545);
+	uint32_t nbDone = 0;
+	for (uint32_t i = 0; i < nbRuns; i++) {
+
+		std::string text = format (makeRandomPacket ());
+
+		for (uint8_t k = 1 + rand () % 4; k > 0; k--) {
+			size_t pos = rand () % text.size ();
+			switch (rand () % 5) {
+				case 0: text [pos] = rand ();										break;
+				case 1: text [pos] = "0123456789abcdefABCDEF []-LASQOKN\n" [rand () % 34];	break;
+				case 2: text.insert (pos, 1, (char) rand ());						break;
+				case 3: text.erase (pos, 1 + rand () % 4);							break;
+				case 4: text.resize (pos + 1);										break;
+			}
+			if (text.empty ()) text = "L";
+		}
+
+		if (parse (parser, text) == CCPARSE_DONE) {
+			nbDone++;
+			CHECK ((1 <= parsed.length) && (parsed.length <= CCPACKET_DATA_LEN));
+			CHECK (parse (reparser, format (parsed)) == CCPARSE_DONE);
+			CHECK (isSamePacket (parsed, reparsed));
+		}
+		else {
+			CHECK (parsed.length == 0);
+			CHECK (parser.getError () != CCPARSE_ERR_NONE);
+			CHECK (parser.getErrorOffset () <= text.size ());
+		}
+	}
+	CHECK (nbDone > 0);
+}
+
+//========================================================================================================================
+// Random bytes into the batch parser: every item is reported, the line numbers only grow
+//========================================================================================================================
+static void fuzzBatch (uint32_t nbRuns)
+{
+	ccPacketBatchParser parser;
+
+	srand (454545);
+	for (uint32_t i = 0; i < nbRuns; i++) {
+
+		std::string text;
+		for (uint8_t k = rand () % 5; k > 0; k--) {
+			text += std::to_string (1 + rand () % 300) + " " + format (makeRandomPacket ()) + "\n";
+			if (rand () % 3 == 0) text [rand () % text.size ()] = rand ();
+		}
+
+		parser.reset ();
+		uint16_t lastLine = 0;
+		size_t pos = 0;
+		while (pos < text.size ()) {
+			pos += parser.feed ((const uint8_t *) text.data () + pos, text.size () - pos);
+			if (parser.hasItem ()) {
+				CHECK (parser.getLine () >= lastLine);
+				lastLine = parser.getLine ();
+				if (parser.getError () == CCPARSE_ERR_NONE) CHECK (parser.getPacket ().length > 0);
+			}
+		}
+		parser.flush ();
+		CHECK (parser.getNbErrors () <= parser.getNbItems ());
+	}
+}
+
+//========================================================================================================================
+// Parsing throughput of 100 bytes packets, in one feed
+//========================================================================================================================
+static void benchParse ()
+{
+	CCPACKET packet = makeRandomPacket (), parsed;
+	packet.length = CCPACKET_DATA_LEN;
+	std::string text = format (packet);
+	ccPacketParser parser (parsed);
+
+	hostBench ("parse 100 bytes packet", 200000, text.size (), [&] () {
+		parser.reset ();
+		parser.feed ((const uint8_t *) text.data (), text.size ());
+		parser.flush ();
+	});
+	CHECK (isSamePacket (packet, parsed));
+}
+
+HOST_TEST_MAIN (
+	testDigits ();
+	testRoundTrip ();
+	fuzzMutations (isBench ? 2000000 : 100000);
+	fuzzBatch (isBench ? 200000 : 10000);
+	if (isBench) benchParse ();
+)
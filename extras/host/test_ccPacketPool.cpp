@@ -0,0 +1,196 @@
+//************************************************************************************************************************
+// test_ccPacketPool.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <vector>
+
+#include <cc1101Transceiver.h>
+#include <ccPacketPool.h>
+
+#include "HostRuntime.h"
+
+using namespace cc1101;
+
+
+class HostTransceiver : public CC1101Transceiver
+{
+public:
+	HostTransceiver						() : CC1101Transceiver (4, 0, 0) {}
+	virtual void initRegisters			() override						{}
+};
+
+// The transmission ends after 20 SPI transfers in TX (TXOFF_MODE = IDLE)
+static uint8_t sendingRadio (uint8_t mosi)
+{
+	static uint8_t nbTxTransfers = 0;
+
+	uint8_t miso = hostRegisterFile (mosi);
+	if (hostRegisters [CC1101_MARCSTATE] != CC_MARCSTATE_TX)	nbTxTransfers = 0;
+	else if (++nbTxTransfers >= 20)								hostRegisters [CC1101_MARCSTATE] = CC_MARCSTATE_IDLE;
+	return miso;
+}
+
+//========================================================================================================================
+// Acquire until the pool is exhausted, a released packet is the next one acquired
+//========================================================================================================================
+static void testExhaustion ()
+{
+	ccPacketPool & pool = I(ccPacketPool);
+	uint32_t nbExhausted = pool.getStats ().nbExhausted;
+
+	{
+		ccPacketHandle packets [CCPACKET_POOL_SIZE];
+		for (uint8_t i = 0; i < CCPACKET_POOL_SIZE; i++) {
+			packets [i] = pool.acquire ();
+			CHECK (packets [i] && (packets [i].useCount () == 1) && (packets [i]->length == 0));
+			for (uint8_t j = 0; j < i; j++) CHECK (packets [i].get () != packets [j].get ());
+		}
+		CHECK ((pool.getStats ().nbUsed == CCPACKET_POOL_SIZE) && (pool.getStats ().highWater == CCPACKET_POOL_SIZE));
+		CHECK (pool.getNbFree () == 0);
+
+		ccPacketHandle none = pool.acquire ();
+		CHECK (!none && (none.get () == nullptr) && (none.useCount () == 0));
+		CHECK (pool.getStats ().nbExhausted == nbExhausted + 1);
+
+		// Back to the free list
+		CCPACKET * released = packets [3].get ();
+		packets [3]->length = 12;
+		packets [3].release ();
+		CHECK (!packets [3] && (pool.getNbFree () == 1));
+		packets [3] = pool.acquire ();
+		CHECK ((packets [3].get () == released) && (packets [3]->length == 0));			// Reset on acquire
+		CHECK (!pool.acquire () && (pool.getStats ().nbExhausted == nbExhausted + 2));
+	}
+
+	CHECK ((pool.getStats ().nbUsed == 0) && (pool.getNbFree () == CCPACKET_POOL_SIZE));
+	CHECK (pool.getStats ().highWater == CCPACKET_POOL_SIZE);
+}
+
+//========================================================================================================================
+// Copies add a reference, moves transfer it, self assignments change nothing, the last handle releases the packet
+//========================================================================================================================
+static void testRefCounts ()
+{
+	ccPacketPool & pool = I(ccPacketPool);
+
+	ccPacketHandle a = pool.acquire ();
+	ccPacketHandle b (a);
+	CHECK ((a.get () == b.get ()) && (a.useCount () == 2));
+
+	ccPacketHandle c (std::move (b));
+	CHECK (!b && (c.useCount () == 2));
+
+	a = a;
+	c = std::move (c);
+	CHECK (a && c && (a.useCount () == 2));
+
+	a = c;																			// Same packet
+	CHECK (a.useCount () == 2);
+
+	ccPacketHandle d = pool.acquire ();
+	CCPACKET * other = d.get ();
+	d = a;																			// Its packet goes back to the pool
+	CHECK ((a.useCount () == 3) && (pool.getStats ().nbUsed == 1));
+	CHECK (pool.acquire ().get () == other);
+
+	b = std::move (d);
+	CHECK (!d && (b.useCount () == 3));
+
+	a.release ();
+	a.release ();
+	b = ccPacketHandle ();
+	CHECK ((c.useCount () == 1) && (pool.getStats ().nbUsed == 1));
+	c.release ();
+	CHECK (pool.getStats ().nbUsed == 0);
+
+	// More handles than a byte can count
+	ccPacketHandle shared = pool.acquire ();
+	{
+		std::vector <ccPacketHandle> copies (300, shared);
+		CHECK (shared.useCount () == 301);
+	}
+	CHECK (shared.useCount () == 1);
+	shared.release ();
+	CHECK (pool.getStats ().nbUsed == 0);
+}
+
+//========================================================================================================================
+// Bounded FIFO: a push on a full queue is dropped, the queued packets are held until popped or cleared
+//========================================================================================================================
+static void testQueue ()
+{
+	ccPacketPool & pool = I(ccPacketPool);
+	ccPacketQueue <3> queue;
+
+	CHECK (!queue.push (ccPacketHandle ()) && (queue.getNbDropped () == 0));
+
+	for (uint8_t i = 0; i < 4; i++) {
+		ccPacketHandle packet = pool.acquire ();
+		packet->length = i + 1;
+		CHECK (queue.push (packet) == (i < 3));
+	}
+	CHECK (queue.isFull () && (queue.size () == 3) && (queue.getHighWater () == 3) && (queue.getNbDropped () == 1));
+	CHECK (pool.getStats ().nbUsed == 3);											// The dropped packet is released
+
+	ccPacketHandle first = queue.pop ();
+	CHECK ((first->length == 1) && (first.useCount () == 1));
+	first.release ();
+
+	ccPacketHandle packet = pool.acquire ();
+	packet->length = 4;
+	CHECK (queue.push (packet) && (packet.useCount () == 2));						// Wraps around
+	packet.release ();
+
+	for (uint8_t length = 2; length <= 4; length++) {
+		ccPacketHandle popped = queue.pop ();
+		CHECK (popped && (popped->length == length));
+	}
+	CHECK (queue.isEmpty () && !queue.pop ());
+
+	queue.push (pool.acquire ());
+	queue.push (pool.acquire ());
+	queue.clear ();
+	CHECK (queue.isEmpty () && (pool.getStats ().nbUsed == 0));
+}
+
+//========================================================================================================================
+// sendQueuedPackets tells whether the given queued packet was sent and releases the burst
+//========================================================================================================================
+static void testSendQueuedPackets ()
+{
+	ccPacketPool & pool = I(ccPacketPool);
+	HostTransceiver radio;
+
+	memset (hostRegisters, 0, sizeof (hostRegisters));
+	hostSpiTransfer = sendingRadio;
+
+	bool isSent = true;
+	CHECK ((radio.sendQueuedPackets (nullptr, &isSent) == 0) && !isSent);			// Nothing queued
+
+	ccPacketHandle empty = pool.acquire ();											// length 0: not sent
+	ccPacketHandle packet = pool.acquire ();
+	packet->length = 3;
+	CHECK (radio.queuePacket (empty) && radio.queuePacket (packet));
+
+	CHECK (radio.sendQueuedPackets (empty.get (), &isSent) == 1);
+	CHECK (!isSent && radio.getTxQueue ().isEmpty ());
+	CHECK ((empty.useCount () == 1) && (packet.useCount () == 1));
+
+	CHECK (radio.queuePacket (empty) && radio.queuePacket (packet));
+	CHECK ((radio.sendQueuedPackets (packet.get (), &isSent) == 1) && isSent);
+
+	empty.release ();
+	packet.release ();
+	CHECK (pool.getStats ().nbUsed == 0);
+
+	hostSpiTransfer = nullptr;
+}
+
+HOST_TEST_MAIN (
+	testExhaustion ();
+	testRefCounts ();
+	testQueue ();
+	testSendQueuedPackets ();
+)
@@ -0,0 +1,112 @@
+//************************************************************************************************************************
+// test_ccPacketPrinter.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <stdlib.h>
+
+#include <ccBasicPacket.h>
+
+#include "HostRuntime.h"
+
+using namespace corex;
+using namespace cc1101;
+
+
+// Previous printTo: one n2hexstr String per byte, written character by character
+static void printReference (Print & p, const CCPACKET & packet)
+{
+	p << F(PRINT_CCPACKET_DATALEN) << packet.length << F(PRINT_CCPACKET_SEPARATOR);
+	p << F(PRINT_CCPACKET_ADDRESS) << n2hexstr (packet.address) << F(PRINT_CCPACKET_SEPARATOR);
+	p << F(PRINT_CCPACKET_DATA_BEGIN) << n2hexstr (packet.data [0]);
+	for (int i = 1; i < packet.length; i++) {
+		p << F(PRINT_CCPACKET_SEPARATOR) << n2hexstr (packet.data [i]);
+	}
+	p << F(PRINT_CCPACKET_DATA_END) << F(PRINT_CCPACKET_SEPARATOR);
+	p << (packet.crc_ok ? F(PRINT_CCPACKET_CRC_OK) : F(PRINT_CCPACKET_CRC_NOK)) << F(PRINT_CCPACKET_SEPARATOR);
+	p << F(PRINT_CCPACKET_SIGNAL_STRENGTH) << n2hexstr (packet.rssi) << F(PRINT_CCPACKET_SEPARATOR);
+	p << F(PRINT_CCPACKET_SIGNAL_QUALITY) << n2hexstr (packet.lqi);
+}
+
+static CCPACKET makeRandomPacket (uint8_t length)
+{
+	CCPACKET packet;
+	packet.reset ();
+	packet.length	= length;
+	packet.address	= rand ();
+	packet.crc_ok	= rand () & 1;
+	packet.rssi		= rand ();
+	packet.lqi		= rand ();
+	for (uint8_t i = 0; i < length; i++) packet.data [i] = rand ();
+	return packet;
+}
+
+//========================================================================================================================
+// Same text as the previous printTo for every length, format () length == formattedSize ()
+//========================================================================================================================
+static void testSameAsReference ()
+{
+	srand (44);
+	for (uint32_t i = 0; i < 20000; i++) {
+
+		CCPACKET packet = makeRandomPacket (1 + i % CCPACKET_DATA_LEN);
+
+		HostPrint reference;
+		printReference (reference, packet);
+
+		char text [CCPACKET_TEXT_MAX_LEN];
+		size_t len = ccPacketPrinter (packet).format (text, sizeof (text));
+		CHECK (len == ccPacketPrinter (packet).formattedSize ());
+		CHECK (std::string (text, len) == reference.str);
+
+		HostPrint printed;
+		CHECK (ccPacketPrinter (packet).printTo (printed) == len);
+		CHECK (printed.str == reference.str);
+	}
+}
+
+//========================================================================================================================
+// Empty packet and too small buffer: nothing written
+//========================================================================================================================
+static void testLimits ()
+{
+	char text [CCPACKET_TEXT_MAX_LEN];
+
+	CCPACKET packet = makeRandomPacket (CCPACKET_DATA_LEN);
+	size_t len = ccPacketPrinter (packet).formattedSize ();
+	CHECK (len <= CCPACKET_TEXT_MAX_LEN);
+	CHECK (ccPacketPrinter (packet).format (text, len - 1) == 0);
+	CHECK (ccPacketPrinter (packet).format (text, len) == len);
+
+	packet.length = 0;
+	CHECK (ccPacketPrinter (packet).formattedSize () == 0);
+	CHECK (ccPacketPrinter (packet).format (text, sizeof (text)) == 0);
+}
+
+//========================================================================================================================
+// 100 bytes packet: single pass format against the previous printTo
+//========================================================================================================================
+static void benchFormat ()
+{
+	CCPACKET packet = makeRandomPacket (CCPACKET_DATA_LEN);
+	char text [CCPACKET_TEXT_MAX_LEN];
+
+	hostBench ("format 100 bytes", 1000000, packet.length, [&] () {
+		ccPacketPrinter (packet).format (text, sizeof (text));
+	});
+	hostBench ("printTo 100 bytes", 1000000, packet.length, [&] () {
+		HostPrint out;
+		ccPacketPrinter (packet).printTo (out);
+	});
+	hostBench ("previous printTo 100 bytes", 20000, packet.length, [&] () {
+		HostPrint out;
+		printReference (out, packet);
+	});
+}
+
+HOST_TEST_MAIN (
+	testSameAsReference ();
+	testLimits ();
+	if (isBench) benchFormat ();
+)
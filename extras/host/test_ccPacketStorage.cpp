@@ -0,0 +1,172 @@
+//************************************************************************************************************************
+// test_ccPacketStorage.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <ccPacketStorage.h>
+
+#include "HostRuntime.h"
+
+using namespace cc1101;
+
+
+static CCPACKET makePacket (uint8_t seed)
+{
+	CCPACKET packet;
+	packet.reset ();
+	packet.address	= seed;
+	packet.length	= 10 + seed % 50;
+	for (uint8_t i = 0; i < packet.length; i++) packet.data [i] = seed + i;
+	return packet;
+}
+
+// Id of the packet stored as fileId, 0 if none
+static uint8_t storedSeed (uint8_t fileId)
+{
+	CCPACKET packet;
+	return I(ccPacketStorage).read (fileId, packet) ? packet.address : 0;
+}
+
+static std::string filename (uint8_t fileId, const char * ext)
+{
+	return std::string (RF_HEADER_NAMEFILE) + std::to_string (fileId) + ext;
+}
+
+// Only the committed packets are left
+static bool isClean ()
+{
+	for (auto & file : memFs.files) {
+		if (file.first.find (RF_EXT_NAMEFILE) == std::string::npos) return false;
+	}
+	return true;
+}
+
+static void storeOriginals ()
+{
+	memFs.files.clear ();
+	CHECK (I(ccPacketStorage).write (1, makePacket (1)));
+	CHECK (I(ccPacketStorage).write (2, makePacket (2)));
+}
+
+//========================================================================================================================
+// All the packets are replaced, the new ones are added
+//========================================================================================================================
+static void testCommit ()
+{
+	storeOriginals ();
+	{
+		ccPacketStorageTransaction transaction;
+		CHECK (transaction.write (1, makePacket (11)));
+		CHECK (transaction.write (3, makePacket (13)));
+		CHECK (storedSeed (1) == 1);									// Nothing visible before commit
+		CHECK (transaction.commit ());
+	}
+	CHECK ((storedSeed (1) == 11) && (storedSeed (2) == 2) && (storedSeed (3) == 13));
+	CHECK (isClean ());
+}
+
+//========================================================================================================================
+// Destroyed without commit
+//========================================================================================================================
+static void testRollback ()
+{
+	storeOriginals ();
+	{
+		ccPacketStorageTransaction transaction;
+		CHECK (transaction.write (1, makePacket (11)));
+		CHECK (transaction.write (3, makePacket (13)));
+	}
+	CHECK ((storedSeed (1) == 1) && (storedSeed (2) == 2) && (storedSeed (3) == 0));
+	CHECK (isClean ());
+}
+
+//========================================================================================================================
+// A rename fails in the middle of the commit: the packets already replaced are put back
+//========================================================================================================================
+static void testFailedRename ()
+{
+	// 1.dat => 1.bak, 1.tmp => 1.dat, 2.dat => 2.bak, 2.tmp => 2.dat, 3.tmp => 3.dat: the (n + 1)th rename fails
+	for (int n = 0; n < 5; n++) {
+
+		storeOriginals ();
+		{
+			ccPacketStorageTransaction transaction;
+			CHECK (transaction.write (1, makePacket (11)));
+			CHECK (transaction.write (2, makePacket (12)));
+			CHECK (transaction.write (3, makePacket (13)));
+
+			memFs.failRenameAfter = n;
+			CHECK (!transaction.commit ());
+			memFs.failRenameAfter = -1;
+		}
+		CHECK ((storedSeed (1) == 1) && (storedSeed (2) == 2) && (storedSeed (3) == 0));
+		CHECK (isClean ());
+	}
+}
+
+//========================================================================================================================
+// Reset during the commit, after the (n + 1)th rename: the journal is complete, the commit is completed at boot
+//========================================================================================================================
+static void testRecoverInterruptedCommit ()
+{
+	const std::pair <std::string, std::string> renames [] = {
+		{ filename (1, RF_EXT_NAMEFILE), filename (1, RF_EXT_BAK_NAMEFILE) }, { filename (1, RF_EXT_TMP_NAMEFILE), filename (1, RF_EXT_NAMEFILE) },
+		{ filename (2, RF_EXT_NAMEFILE), filename (2, RF_EXT_BAK_NAMEFILE) }, { filename (2, RF_EXT_TMP_NAMEFILE), filename (2, RF_EXT_NAMEFILE) },
+		{ filename (3, RF_EXT_TMP_NAMEFILE), filename (3, RF_EXT_NAMEFILE) },
+	};
+	const uint8_t journal [] = { RF_JOURNAL_MAGIC, 3, 1, 2, 3, RF_JOURNAL_MAGIC };
+
+	for (int n = -1; n < 5; n++) {
+
+		// Staged packets and journal written, then the renames of the commit up to the reset
+		storeOriginals ();
+		for (uint8_t fileId = 1; fileId <= 3; fileId++) {
+			CHECK (ccPacketStorage::writeFile (filename (fileId, RF_EXT_TMP_NAMEFILE).c_str (), makePacket (10 + fileId), nullptr));
+		}
+		memFs.files [RF_JOURNAL_NAMEFILE] = std::string ((const char *) journal, sizeof (journal));
+
+		for (int i = 0; i <= n; i++) {
+			memFs.files [renames [i].second] = memFs.files [renames [i].first];
+			memFs.files.erase (renames [i].first);
+		}
+
+		I(ccPacketStorage).recover ();
+		CHECK ((storedSeed (1) == 11) && (storedSeed (2) == 12) && (storedSeed (3) == 13));
+		CHECK (isClean ());
+	}
+}
+
+//========================================================================================================================
+// Reset while the journal is written or before any commit: the transaction is cancelled, the stale files removed
+//========================================================================================================================
+static void testRecoverCancelled ()
+{
+	// Truncated journal
+	storeOriginals ();
+	memFs.files [filename (1, RF_EXT_TMP_NAMEFILE)] = memFs.files [filename (2, RF_EXT_NAMEFILE)];
+	memFs.files [filename (3, RF_EXT_TMP_NAMEFILE)] = memFs.files [filename (2, RF_EXT_NAMEFILE)];
+	const uint8_t journal [] = { RF_JOURNAL_MAGIC, 2, 1 };
+	memFs.files [RF_JOURNAL_NAMEFILE] = std::string ((const char *) journal, sizeof (journal));
+
+	I(ccPacketStorage).recover ();
+	CHECK ((storedSeed (1) == 1) && (storedSeed (2) == 2) && (storedSeed (3) == 0));
+	CHECK (isClean ());
+
+	// No journal: a .tmp is never committed, a .bak was already replaced
+	storeOriginals ();
+	memFs.files [filename (1, RF_EXT_TMP_NAMEFILE)] = memFs.files [filename (2, RF_EXT_NAMEFILE)];
+	memFs.files [filename (2, RF_EXT_BAK_NAMEFILE)] = memFs.files [filename (1, RF_EXT_NAMEFILE)];
+
+	I(ccPacketStorage).recover ();
+	CHECK ((storedSeed (1) == 1) && (storedSeed (2) == 2));
+	CHECK (isClean ());
+}
+
+HOST_TEST_MAIN (
+	testCommit ();
+	testRollback ();
+	testFailedRename ();
+	testRecoverInterruptedCommit ();
+	testRecoverCancelled ();
+)
@@ -0,0 +1,145 @@
+//************************************************************************************************************************
+// test_ccPulse.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <stdlib.h>
+
+#include <ccPulse.h>
+
+#include "HostRuntime.h"
+
+using namespace cc1101;
+
+
+//========================================================================================================================
+// Level bit and saturated duration
+//========================================================================================================================
+static void testMakePulse ()
+{
+	CHECK (makePulse (true, 350) == (CCPULSE_LEVEL_BIT | 350));
+	CHECK (makePulse (false, 350) == 350);
+	CHECK (makePulse (true, 100000) == (CCPULSE_LEVEL_BIT | CCPULSE_MAX_US));
+	CHECK (pulseLevel (makePulse (true, 0)) && !pulseLevel (makePulse (false, CCPULSE_MAX_US)));
+	CHECK (pulseWidth (makePulse (true, 1234)) == 1234);
+}
+
+//========================================================================================================================
+// Random pulses encoded into a stream then decoded back, a steady signal takes 1 byte per pulse and the largest jumps
+// CCPULSE_DELTA_MAX_BYTES
+//========================================================================================================================
+static void testDeltaRoundTrip ()
+{
+	const uint16_t nbPulses = 5000;
+	uint16_t pulses [nbPulses];
+	uint8_t stream [nbPulses * CCPULSE_DELTA_MAX_BYTES];
+
+	srand (31);
+	for (uint16_t i = 0; i < nbPulses; i++) {
+		switch (rand () % 3) {
+			case 0:		pulses [i] = makePulse (rand () & 1, rand () % (CCPULSE_MAX_US + 1));	break;
+			case 1:		pulses [i] = makePulse (rand () & 1, (rand () & 1) ? 0 : CCPULSE_MAX_US);	break;
+			default:	pulses [i] = makePulse (i & 1, 300 + rand () % 8);						break;
+		}
+	}
+
+	ccPulseDeltaEncoder encoder;
+	size_t len = 0;
+	for (uint16_t i = 0; i < nbPulses; i++) {
+		uint8_t n = encoder.encode (pulses [i], stream + len);
+		CHECK ((n >= 1) && (n <= CCPULSE_DELTA_MAX_BYTES));
+		len += n;
+	}
+
+	ccPulseDeltaDecoder decoder;
+	size_t pos = 0;
+	bool isSame = true;
+	for (uint16_t i = 0; i < nbPulses; i++) {
+		uint16_t pulse = 0;
+		uint8_t n = decoder.decode (stream + pos, len - pos, pulse);
+		CHECK (n > 0);
+		isSame &= (pulse == pulses [i]);
+		pos += n;
+	}
+	CHECK (isSame && (pos == len));
+
+	// Steady signal
+	encoder.reset ();
+	uint8_t out [CCPULSE_DELTA_MAX_BYTES];
+	encoder.encode (makePulse (true, 500), out);
+	encoder.encode (makePulse (false, 1000), out);
+	for (uint16_t i = 0; i < 100; i++) {
+		CHECK (encoder.encode (makePulse (true, 500 + (i & 1)), out) == 1);
+		CHECK (encoder.encode (makePulse (false, 1000 - (i & 1)), out) == 1);
+	}
+
+	// Largest jumps, both signs
+	encoder.reset ();
+	CHECK (encoder.encode (makePulse (true, CCPULSE_MAX_US), out) == CCPULSE_DELTA_MAX_BYTES);
+	CHECK (encoder.encode (makePulse (true, 0), out) == CCPULSE_DELTA_MAX_BYTES);
+}
+
+//========================================================================================================================
+// A truncated or too long varint is rejected
+//========================================================================================================================
+static void testDeltaTruncated ()
+{
+	ccPulseDeltaEncoder encoder;
+	uint8_t out [CCPULSE_DELTA_MAX_BYTES];
+	uint8_t n = encoder.encode (makePulse (false, 20000), out);
+	CHECK (n == CCPULSE_DELTA_MAX_BYTES);
+
+	ccPulseDeltaDecoder decoder;
+	uint16_t pulse = 0;
+	for (uint8_t len = 0; len < n; len++) CHECK (decoder.decode (out, len, pulse) == 0);
+	CHECK ((decoder.decode (out, n, pulse) == n) && (pulse == makePulse (false, 20000)));
+
+	const uint8_t tooLong [] = { 0x80, 0x80, 0x80, 0x01 };
+	decoder.reset ();
+	CHECK (decoder.decode (tooLong, sizeof (tooLong), pulse) == 0);
+}
+
+//========================================================================================================================
+// The ring keeps CCPULSE_RING_LEN - 1 pulses, counts the lost ones and stays in order across the index wrap around
+//========================================================================================================================
+static void testRingWrapAround ()
+{
+	static ccPulseRing ring;
+	uint16_t pulse = 0;
+
+	CHECK (!ring.pop (pulse) && (ring.available () == 0));
+
+	for (uint16_t i = 0; i < CCPULSE_RING_LEN - 1; i++) CHECK (ring.push (i));
+	CHECK (ring.available () == CCPULSE_RING_LEN - 1);
+	CHECK (!ring.push (0xFFFF) && !ring.push (0xFFFF));
+	CHECK (ring.getOverflows () == 2);
+
+	bool isInOrder = true;
+	for (uint16_t i = 0; i < CCPULSE_RING_LEN - 1; i++) isInOrder &= (ring.pop (pulse) && (pulse == i));
+	CHECK (isInOrder && !ring.pop (pulse));
+
+	// Producer ahead of the consumer by a varying amount, head and tail wrap many times
+	srand (1024);
+	uint16_t nbPushed = 0, nbPopped = 0;
+	isInOrder = true;
+	for (uint32_t t = 0; t < 20000; t++) {
+		uint16_t nbPush = rand () % 64;
+		for (uint16_t i = 0; (i < nbPush) && (ring.available () < CCPULSE_RING_LEN - 1); i++) CHECK (ring.push (nbPushed++));
+		uint16_t nbPop = rand () % 64;
+		for (uint16_t i = 0; (i < nbPop) && ring.pop (pulse); i++) isInOrder &= (pulse == nbPopped++);
+		CHECK (ring.available () == (uint16_t) (nbPushed - nbPopped));
+	}
+	CHECK (isInOrder && (nbPushed > 10 * CCPULSE_RING_LEN));
+
+	ring.clear ();
+	CHECK ((ring.available () == 0) && (ring.getOverflows () == 0) && !ring.pop (pulse));
+	CHECK (ring.push (7) && ring.pop (pulse) && (pulse == 7));
+}
+
+HOST_TEST_MAIN (
+	testMakePulse ();
+	testDeltaRoundTrip ();
+	testDeltaTruncated ();
+	testRingWrapAround ();
+)
@@ -0,0 +1,231 @@
+//************************************************************************************************************************
+// test_ccPulseAnalyzer.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <stdlib.h>
+#include <vector>
+
+#include <ccPulseAnalyzer.h>
+#include <ccX2dEncoder.h>
+#include <ccX2dDecoder.h>
+
+#include "HostRuntime.h"
+
+using namespace cc1101;
+
+
+/**
+ * Pulse trace: merges the consecutive periods of the same level, +-jitter µs on each period
+ */
+struct TRACE
+{
+	std::vector <uint16_t>	pulses;
+	uint16_t				jitterUs = 0;
+
+	void add (bool level, uint32_t us)
+	{
+		if (jitterUs > 0) us = us + (rand () % (2 * jitterUs + 1)) - jitterUs;
+		if (!pulses.empty () && (pulseLevel (pulses.back ()) == level)) {
+			pulses.back () = makePulse (level, pulseWidth (pulses.back ()) + us);
+		}
+		else {
+			pulses.push_back (makePulse (level, us));
+		}
+	}
+
+	void feed (ccPulseAnalyzer & analyzer) const { for (uint16_t pulse : pulses) analyzer.feed (pulse); }
+};
+
+static bool isNear (uint16_t value, uint16_t expected, uint16_t tolerance)
+{
+	return (value + tolerance >= expected) && (value <= expected + tolerance);
+}
+
+//========================================================================================================================
+// X2D burst (3 frames, 848µs half bits) as sent by the Tybox: Manchester, and the guess decodes the frames
+//========================================================================================================================
+static void testManchesterX2d ()
+{
+	X2D_FIELDS fields = { 0x3E4C };
+	fields.command = X2D_CMD_HEATING_ON;
+
+	X2D_FRAME frame = ccX2dEncoder::encode (fields);
+	ccBitPacket bits, chips;
+	bits.fromBytes (frame.data, frame.nbBits);
+	bits.manchesterEncode (chips);
+
+	srand (5);
+	TRACE trace;
+	trace.jitterUs = 20;
+	for (uint8_t k = 0; k < X2D_BURST_LEN; k++) {
+		trace.add (0, 20000);
+		for (uint16_t i = 0; i < chips.getNbBits (); i++) trace.add (chips.getBit (i), 848);
+	}
+	trace.add (0, 20000);
+
+	ccPulseAnalyzer analyzer;
+	trace.feed (analyzer);
+	CHECK (analyzer.analyze ());
+	CHECK (analyzer.getParams ().modulation == OOK_MC_ZEROBIT);
+	CHECK (isNear (analyzer.getParams ().shortUs, 848, 20));
+	CHECK (analyzer.getPeriods ().size () == 3);
+
+	ccDemodulator demodulator (analyzer.getParams ());
+	ccX2dDecoder decoder;
+	uint8_t nbDecoded = 0;
+	for (uint16_t pulse : trace.pulses) {
+		if (demodulator.feed (pulse) && decoder.decode (demodulator.getBits ())) nbDecoded++;
+	}
+	CHECK (nbDecoded == X2D_BURST_LEN);
+
+	HostPrint report;
+	analyzer.printTo (report);
+	CHECK (report.str.find ("Guessing modulation: Manchester coding") != std::string::npos);
+	CHECK (report.str.find ("-X 'n=name,m=OOK_MC_ZEROBIT,s=") != std::string::npos);
+}
+
+//========================================================================================================================
+// PWM with a fixed period of 3 short widths: pulses and gaps both in a 1:2 ratio, not Manchester (single period)
+//========================================================================================================================
+static void testPwmFixedPeriod ()
+{
+	srand (6);
+	TRACE trace;
+	trace.jitterUs = 10;
+	trace.add (0, 15000);
+	for (uint8_t i = 0; i < 64; i++) {
+		bool bit = rand () % 2;
+		trace.add (1, bit ? 500 : 1000);
+		trace.add (0, bit ? 1000 : 500);
+	}
+	trace.add (0, 15000);
+
+	ccPulseAnalyzer analyzer;
+	trace.feed (analyzer);
+	CHECK (analyzer.analyze ());
+	CHECK (analyzer.getPeriods ().size () == 1);
+	CHECK (analyzer.getParams ().modulation == OOK_PWM);
+	CHECK (isNear (analyzer.getParams ().shortUs, 500, 10) && isNear (analyzer.getParams ().longUs, 1000, 10));
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+static void testPwmFixedGapAndSync ()
+{
+	srand (7);
+	TRACE trace;
+	trace.jitterUs = 15;
+	for (uint8_t k = 0; k < 3; k++) {
+		trace.add (0, 15000);
+		for (uint8_t i = 0; i < 40; i++) {
+			trace.add (1, (rand () % 2) ? 400 : 1200);
+			trace.add (0, 800);
+		}
+	}
+	trace.add (0, 15000);
+
+	ccPulseAnalyzer analyzer;
+	trace.feed (analyzer);
+	CHECK (analyzer.analyze ());
+	CHECK (analyzer.getParams ().modulation == OOK_PWM && analyzer.getParams ().syncUs == 0);
+	CHECK (isNear (analyzer.getParams ().shortUs, 400, 15) && isNear (analyzer.getParams ().longUs, 1200, 15));
+
+	// Tybox PWM view: 232µs sync pulse then 848 / 1684µs pulses
+	TRACE sync;
+	sync.jitterUs = 10;
+	for (uint8_t k = 0; k < 3; k++) {
+		sync.add (0, 15000);
+		sync.add (1, 232);
+		sync.add (0, 800);
+		for (uint8_t i = 0; i < 40; i++) {
+			sync.add (1, (rand () % 2) ? 848 : 1684);
+			sync.add (0, 800);
+		}
+	}
+	sync.add (0, 15000);
+
+	analyzer.clear ();
+	sync.feed (analyzer);
+	CHECK (analyzer.analyze ());
+	CHECK (analyzer.getParams ().modulation == OOK_PWM);
+	CHECK (isNear (analyzer.getParams ().syncUs, 232, 10));
+	CHECK (isNear (analyzer.getParams ().shortUs, 848, 10) && isNear (analyzer.getParams ().longUs, 1684, 10));
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+static void testPpm ()
+{
+	srand (8);
+	TRACE trace;
+	trace.jitterUs = 15;
+	for (uint8_t k = 0; k < 3; k++) {
+		trace.add (0, 15000);
+		for (uint8_t i = 0; i < 40; i++) {
+			trace.add (1, 500);
+			trace.add (0, (rand () % 2) ? 1000 : 2000);
+		}
+		trace.add (1, 500);
+		trace.add (0, 6000);
+	}
+
+	ccPulseAnalyzer analyzer;
+	trace.feed (analyzer);
+	CHECK (analyzer.analyze ());
+	CHECK (analyzer.getParams ().modulation == OOK_PPM);
+	CHECK (isNear (analyzer.getParams ().shortUs, 1000, 15) && isNear (analyzer.getParams ().longUs, 2000, 15));
+	CHECK (analyzer.getParams ().gapUs > 2000 && analyzer.getParams ().resetUs > 6000);
+}
+
+//========================================================================================================================
+// More than 65535 widths in one bin: no count wrap, the sum saturates
+//========================================================================================================================
+static void testLongCapture ()
+{
+	ccHistogram histogram;
+	for (uint32_t i = 0; i < 100000; i++) histogram.add (1000);
+	histogram.fuse ();
+
+	CHECK (histogram.size () == 1);
+	CHECK (histogram [0].count == 100000);
+	CHECK (histogram [0].getMean () == 1000);
+
+	for (uint32_t i = 0; i < 200000; i++) histogram.add (30000);
+	histogram.fuse ();
+	CHECK (histogram.size () == 2);
+	CHECK (histogram [1].getMean () == 30000);
+	CHECK ((uint64_t) histogram [1].count * 30000 <= UINT32_MAX);
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+static void bench ()
+{
+	srand (9);
+	std::vector <uint16_t> pulses;
+	for (uint16_t i = 0; i < 4096; i++) {
+		pulses.push_back (makePulse (1, (rand () % 2) ? 848 : 1696));
+		pulses.push_back (makePulse (0, (rand () % 2) ? 848 : 1696));
+	}
+
+	ccPulseAnalyzer analyzer;
+	hostBench ("analyzer 8192 pulses", 1000, 0, [&] () {
+		analyzer.clear ();
+		for (uint16_t pulse : pulses) analyzer.feed (pulse);
+		analyzer.analyze ();
+	});
+}
+
+HOST_TEST_MAIN (
+	testManchesterX2d ();
+	testPwmFixedPeriod ();
+	testPwmFixedGapAndSync ();
+	testPpm ();
+	testLongCapture ();
+	if (isBench) bench ();
+)
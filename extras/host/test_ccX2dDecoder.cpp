@@ -0,0 +1,211 @@
+//************************************************************************************************************************
+// test_ccX2dDecoder.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <stdlib.h>
+
+#include <ccX2dEncoder.h>
+#include <ccX2dDecoder.h>
+
+#include "../../examples/ThermostatRemoteControl/X2dRadioTyboxCommands.h"
+
+#include "HostRuntime.h"
+
+using namespace cc1101;
+
+
+/**
+ * Corpus: the rtl_433 captures of the notes in examples/ThermostatRemoteControl (X2dRadioTyboxCommands.h for the
+ * house 3e4c, X2dRadioTyboxCommands.maison for the house a5ad)
+ */
+struct X2D_CAPTURE
+{
+	const char *	row;
+	uint16_t		houseCode;
+	uint8_t			command;
+	uint8_t			frameIndex;
+};
+
+static const X2D_CAPTURE corpus [] = {
+	{ "{122} 55 55 7f 7e a2 55 54 aa aa aa db bf 1b c0 15 40",	0x3E4C, X2D_CMD_HEATING_OFF,	0 },
+	{ "{122} 55 55 7f 7e a2 55 54 aa 95 55 24 40 f4 3f ea 8",	0x3E4C, X2D_CMD_HEATING_OFF,	1 },
+	{ "{122} 55 55 7f 7e a2 55 54 aa b5 55 5b bf 14 00 15 40",	0x3E4C, X2D_CMD_HEATING_OFF,	2 },
+	{ "{123} 55 55 7f 7e a2 55 54 aa aa 8a db bf 03 1f f5 4",	0x3E4C, X2D_CMD_HEATING_ON,		0 },
+	{ "{122} 55 55 7f 7e a2 55 54 aa 95 75 24 40 e1 c0 15 40",	0x3E4C, X2D_CMD_HEATING_ON,		1 },
+	{ "{122} 55 55 7f 7e a2 55 54 aa b5 75 5b bf 0e 00 15 40",	0x3E4C, X2D_CMD_HEATING_ON,		2 },
+	{ "{121} 55 55 7f 36 39 aa a9 55 55 55 b7 3f 33 00 2a 80",	0xA5AD, X2D_CMD_HEATING_OFF,	0 },
+	{ "{121} 55 55 7f 36 39 aa a9 55 2a aa 48 c0 ec ff d5 0",	0xA5AD, X2D_CMD_HEATING_OFF,	1 },
+	{ "{121} 55 55 7f 36 39 aa a9 55 6a aa b7 7e 2c 80 2a 80",	0xA5AD, X2D_CMD_HEATING_OFF,	2 },
+	{ "{121} 55 55 7f 36 39 aa a9 55 55 15 b7 3f 04 ff d5 0",	0xA5AD, X2D_CMD_HEATING_ON,		0 },
+	{ "{121} 55 55 7f 36 39 aa a9 55 2a ea 48 c0 c4 ff d5 0",	0xA5AD, X2D_CMD_HEATING_ON,		1 },
+	{ "{121} 55 55 7f 36 39 aa a9 55 6a ea b7 7e 1b 7f d5 0",	0xA5AD, X2D_CMD_HEATING_ON,		2 },
+};
+
+// Rows of the same bursts demodulated as PWM by rtl_433: not X2D frames
+static const char * const pwmRows [] = {
+	"{80} 00 7e f9 a0 20 80 ad f7 77 f8",
+	"{82} 00 7e f9 a0 20 0c 56 ff dd fe 00",
+};
+
+static bool checkEvent (const X2D_EVENT & event, uint16_t houseCode, uint8_t command, uint8_t frameIndex)
+{
+	return (event.getHouseCode () == houseCode) && (event.getCommand () == command) &&
+		   (event.getFrameIndex () == frameIndex) && (event.isLastFrame () == (frameIndex + 1 == X2D_BURST_LEN));
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+static void testCorpus ()
+{
+	ccX2dDecoder decoder;
+	X2D_EVENT event;
+
+	for (const X2D_CAPTURE & capture : corpus) {
+		ccBitPacket bits;
+		HostPrint out;
+		CHECK (bits.parse (capture.row, out));
+		CHECK (decoder.decode (bits, event));
+		CHECK (checkEvent (event, capture.houseCode, capture.command, capture.frameIndex));
+
+		HostPrint text;
+		event.printTo (text);
+		CHECK (text.str.find ("X2D house-") == 0);
+	}
+
+	for (const char * row : pwmRows) {
+		ccBitPacket bits;
+		HostPrint out;
+		CHECK (bits.parse (row, out));
+		CHECK (!decoder.decode (bits, event));
+	}
+
+	CHECK (decoder.getNbFrames () == sizeof (corpus) / sizeof (corpus [0]));
+	CHECK (decoder.getNbChecksumErrors () + decoder.getNbFramingErrors () == sizeof (pwmRows) / sizeof (pwmRows [0]));
+}
+
+//========================================================================================================================
+// The packets of the example (flash arrays) as received by the CC1101
+//========================================================================================================================
+static void testExamplePackets ()
+{
+	ccX2dDecoder decoder;
+	X2D_EVENT event;
+
+	for (uint8_t i = 0; i < X2D_BURST_LEN; i++) {
+		CCPACKET packet;
+		packet = HEATING_ON_CMD [i];
+		CHECK (decoder.decode (packet, event));
+		CHECK (checkEvent (event, TYBOX_X2D_FIELDS.houseCode, X2D_CMD_HEATING_ON, i));
+
+		packet = HEATING_OFF_CMD [i];
+		CHECK (decoder.decode (packet, event));
+		CHECK (checkEvent (event, TYBOX_X2D_FIELDS.houseCode, X2D_CMD_HEATING_OFF, i));
+	}
+}
+
+//========================================================================================================================
+// Random fields: encoder => decoder at any bit offset, polarity, and from the Manchester chips
+//========================================================================================================================
+static X2D_FIELDS randomFields ()
+{
+	X2D_FIELDS fields;
+	fields.houseCode	= rand ();
+	fields.source		= rand ();
+	fields.recipient	= rand ();
+	fields.reserved		= rand ();
+	fields.sequence		= rand () % X2D_BURST_LEN;
+	fields.command		= rand ();
+	fields.argument		= rand ();
+	return fields;
+}
+
+static bool sameFields (const X2D_FIELDS & a, const X2D_FIELDS & b)
+{
+	return (a.houseCode == b.houseCode) && (a.source == b.source) && (a.recipient == b.recipient) &&
+		   (a.reserved == b.reserved) && (a.sequence == b.sequence) && (a.command == b.command) && (a.argument == b.argument);
+}
+
+static void testRoundTrip ()
+{
+	ccX2dDecoder decoder;
+	X2D_EVENT event;
+
+	srand (3);
+	for (uint16_t i = 0; i < 2000; i++) {
+		X2D_FIELDS fields = randomFields ();
+		X2D_FRAME frame = ccX2dEncoder::encode (fields);
+
+		ccBitPacket bits;
+		bits.fromBytes (frame.data, frame.nbBits);
+		bits.shiftRight (rand () % 5);
+		if (rand () % 2) bits.invert ();
+
+		CHECK (decoder.decode (bits, event));
+		CHECK (sameFields (event.fields, fields));
+
+		ccBitPacket chips;
+		bits.manchesterEncode (chips);
+		if (rand () % 2) chips.shiftLeft (1);						// Out of phase chips
+
+		CHECK (decoder.decodeManchester (chips, event));
+		CHECK (sameFields (event.fields, fields));
+	}
+}
+
+//========================================================================================================================
+// Any single bit error in the flag, payload or checksum is rejected (checksum or framing)
+//========================================================================================================================
+static void testBitErrors ()
+{
+	ccX2dDecoder decoder;
+	X2D_EVENT event;
+
+	srand (5);
+	for (uint16_t i = 0; i < 200; i++) {
+		X2D_FRAME frame = ccX2dEncoder::encode (randomFields ());
+
+		for (uint16_t pos = X2D_PREAMBLE_BITS; pos < frame.nbBits - X2D_END_ONES - X2D_END_ZEROS; pos++) {
+			ccBitPacket bits;
+			bits.fromBytes (frame.data, frame.nbBits);
+
+			ccBitPacket error;
+			for (uint16_t k = 0; k < bits.getNbBits (); k++) error.appendBit (k == pos);
+			bits.xorWith (error);
+
+			CHECK (!decoder.decode (bits, event));
+		}
+	}
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+static void bench ()
+{
+	ccX2dDecoder decoder;
+	X2D_EVENT event;
+	CCPACKET packet;
+	packet = HEATING_ON_CMD [0];
+
+	hostBench ("x2d decode packet", 1000000, X2D_FRAME_LEN, [&] () {
+		decoder.decode (packet, event);
+	});
+
+	ccBitPacket bits, chips;
+	bits.fromBytes (packet.data, packet.length * 8);
+	bits.manchesterEncode (chips);
+	hostBench ("x2d decode manchester", 1000000, chips.getNbBits () / 8, [&] () {
+		decoder.decodeManchester (chips, event);
+	});
+}
+
+HOST_TEST_MAIN (
+	testCorpus ();
+	testExamplePackets ();
+	testRoundTrip ();
+	testBitErrors ();
+	if (isBench) bench ();
+)
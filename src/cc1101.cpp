@@ -110,6 +110,153 @@ void CC1101::setPowerDownState (void)
 	cmdStrobe			(CC1101_SPWD);		// Enter Power-down state
 }
 
+// RX timeout per EVENT0 unit (datasheet table 31, MCSM2.RX_TIME rows x WORCTRL.WOR_RES columns, in 1/10000 us at 26 MHz)
+static const uint32_t rxTimeoutFactors [CC1101_RX_TIME_MAX + 1][4] PROGMEM = {
+	{ 36058, 180288, 324519, 468750 },
+	{ 18029,  90144, 162260, 234375 },
+	{  9014,  45072,  81130, 117188 },
+	{  4507,  22536,  40565,  58594 },
+	{  2254,  11268,  20282,  29297 },
+	{  1127,   5634,  10141,  14648 },
+	{   563,   2817,   5071,   7324 }
+};
+
+//========================================================================================================================
+// RX window in percent of the EVENT0 period: 12.5% >> RX_TIME for WOR_RES = 0, 1.95% >> RX_TIME for WOR_RES = 1, ...
+//========================================================================================================================
+static float getRxTimeoutDutyCyclePct (uint8_t rxTime, uint8_t worRes)
+{
+	float unitUs = ((uint32_t) CC1101_RCOSC_PERIOD_NS << (5 * worRes)) / 1000.0f;
+	return 100.0f * pgm_read_dword (&rxTimeoutFactors [rxTime][worRes]) / CC1101_RX_TIMEOUT_FACTOR_SCALE / unitUs;
+}
+
+//========================================================================================================================
+// computeWakeOnRadio
+//
+// Compute the Wake-On-Radio registers for the current data rate (datasheet section 19.5)
+//
+// 'dutyCyclePct'	Maximum RX duty cycle in percent (12.5% down to 0.195% below 1.89 s of latency, much lower above: the
+//					RX window depends on WOR_RES, see rxTimeoutFactors)
+// 'maxLatencyMs'	Worst-case detection latency = EVENT0 period (the transmitter preamble must be at least that long)
+// 'settings'		Computed settings, expected average current and latency
+//
+// Return:
+// 	False if the duty cycle is too low to qualify a sync word at the current data rate
+//========================================================================================================================
+bool CC1101::computeWakeOnRadio (float dutyCyclePct, uint32_t maxLatencyMs, WOR_SETTINGS & settings) const
+{
+	uint32_t baud = getDataRateBaud ();
+	uint64_t periodNs = (uint64_t) maxLatencyMs * 1000000UL;
+
+	// EVENT0 : smallest resolution that can hold the period on 16 bits
+	settings.worRes = 0;
+	while ((settings.worRes < 3) && (periodNs / ((uint64_t) CC1101_RCOSC_PERIOD_NS << (5 * settings.worRes)) > CC1101_WOREVT_MAX)) {
+		settings.worRes++;
+	}
+	uint64_t unitNs = (uint64_t) CC1101_RCOSC_PERIOD_NS << (5 * settings.worRes);
+	settings.event0 = MIN (periodNs / unitNs, CC1101_WOREVT_MAX);
+	if (settings.event0 == 0) settings.event0 = 1;
+	settings.event0Us = (settings.event0 * unitNs) / 1000;
+
+	// EVENT1 : shortest timeout leaving twice the crystal start-up time (4, 6, 8, 12, 16, 24, 32, 48 RC periods)
+	static const uint8_t event1Periods [8] = { 4, 6, 8, 12, 16, 24, 32, 48 };
+	settings.event1 = 0;
+	while ((settings.event1 < 7) && (event1Periods [settings.event1] * CC1101_RCOSC_PERIOD_NS < 2000UL * CC1101_XOSC_STARTUP_US)) {
+		settings.event1++;
+	}
+	uint32_t event1Us = (event1Periods [settings.event1] * CC1101_RCOSC_PERIOD_NS) / 1000;
+
+	// RX_TIME : longest RX window (EVENT0 x C (RX_TIME, WOR_RES)) below the duty cycle target
+	settings.rxTime = 0;
+	while ((settings.rxTime < CC1101_RX_TIME_MAX) && (getRxTimeoutDutyCyclePct (settings.rxTime, settings.worRes) > dutyCyclePct)) {
+		settings.rxTime++;
+	}
+	settings.rxTimeoutUs = ((uint64_t) settings.event0 * pgm_read_dword (&rxTimeoutFactors [settings.rxTime][settings.worRes])) / CC1101_RX_TIMEOUT_FACTOR_SCALE;
+
+	uint32_t syncDetectUs = (baud > 0) ? (uint32_t) ((CC1101_SYNC_DETECT_BITS * 1000000ULL) / baud) : 0;
+
+	// Worst case: the signal starts right after the RX window => a full period, the wake up then the sync word
+	settings.latencyUs = settings.event0Us + event1Us + syncDetectUs;
+
+	// Average current over one period
+	uint64_t chargeUaUs =	(uint64_t) CC1101_CURRENT_IDLE_UA * event1Us +
+							(uint64_t) CC1101_CURRENT_RX_UA * settings.rxTimeoutUs +
+							(uint64_t) CC1101_CURRENT_CAL_UA * CC1101_FS_CAL_US / 4;
+	uint32_t activeUs = event1Us + settings.rxTimeoutUs + CC1101_FS_CAL_US / 4;
+	if (settings.event0Us > activeUs) {
+		chargeUaUs += (uint64_t) CC1101_CURRENT_SLEEP_WOR_UA * (settings.event0Us - activeUs);
+	}
+	settings.averageCurrentUa = chargeUaUs / ((settings.event0Us > activeUs) ? settings.event0Us : activeUs);
+
+	Logln (F("WOR: EVENT0 ") << settings.event0Us << F("us, RX ") << settings.rxTimeoutUs << F("us, latency ") << settings.latencyUs <<
+		   F("us, average current ") << settings.averageCurrentUa << F("uA"));
+
+	if (settings.rxTimeoutUs < syncDetectUs) {
+		Logln (F("WOR: RX window too short to detect the sync word at ") << baud << F(" bauds"));
+		return false;
+	}
+	return true;
+}
+
+//========================================================================================================================
+// calibrateRcOscillator
+//
+// Calibrate the WOR RC oscillator then freeze the result in RCCTRL1/RCCTRL0 (the calibration is not run again on each
+// wake up, which saves current)
+//========================================================================================================================
+void CC1101::calibrateRcOscillator (void)
+{
+	uint8_t worCtrl = readConfigReg (CC1101_WORCTRL) & ~CC1101_WORCTRL_RC_PD;
+
+	setIdleState		();
+	writeReg			(CC1101_WORCTRL, worCtrl | CC1101_WORCTRL_RC_CAL);
+	calibrate			();								// The RC oscillator is calibrated along with the synthesizer
+	EspBoard::asyncDelayMillis (2);
+
+	uint8_t rcCtrl1 = readStatusReg (CC1101_RCCTRL1_STATUS);
+	uint8_t rcCtrl0 = readStatusReg (CC1101_RCCTRL0_STATUS);
+
+	writeReg			(CC1101_RCCTRL1, rcCtrl1);
+	writeReg			(CC1101_RCCTRL0, rcCtrl0);
+	writeReg			(CC1101_WORCTRL, worCtrl & ~CC1101_WORCTRL_RC_CAL);
+
+	Logln (F("RC oscillator calibrated: RCCTRL1 ") << String (rcCtrl1, HEX) << F(" RCCTRL0 ") << String (rcCtrl0, HEX));
+}
+
+//========================================================================================================================
+// setWakeOnRadio
+//
+// Write the Wake-On-Radio registers. The driver IRQ is on GDO2: it asserts when a sync word is detected (the RX window
+// is then extended by RX_TIME_QUAL) and deasserts at the end of the packet (IOCFG2 = 0x06), so the MCU is only woken up
+// by an actual transmission and reads the packet on the falling edge
+//========================================================================================================================
+void CC1101::setWakeOnRadio (const WOR_SETTINGS & settings)
+{
+	setIdleState	();
+
+	writeReg		(CC1101_WOREVT1,	settings.event0 >> 8);
+	writeReg		(CC1101_WOREVT0,	settings.event0 & 0xFF);
+	writeReg		(CC1101_WORCTRL,	(settings.event1 << 4) | (settings.worRes & 0x03));		// RC oscillator on, calibration frozen
+	writeReg		(CC1101_MCSM2,		CC1101_MCSM2_RX_TIME_QUAL | settings.rxTime);
+	writeReg		(CC1101_MCSM0,		0x38);			// Auto calibrate every 4th time when going from RX or TX to IDLE, PO timeout Approx. 146µs - 171µs
+	writeReg		(CC1101_IOCFG2,		0x06);			// Asserts on sync word detected (wakes up the MCU), deasserts at the end of the packet
+
+	calibrateRcOscillator ();
+}
+
+//========================================================================================================================
+// startWakeOnRadio
+//
+// Start the automatic RX polling sequence, the CC1101 goes back to SLEEP between two RX windows
+//========================================================================================================================
+void CC1101::startWakeOnRadio (void)
+{
+	setIdleState	();
+	flushRxFifo		();
+	cmdStrobe		(CC1101_SWORRST);					// Reset the real time clock
+	cmdStrobe		(CC1101_SWOR);						// Start Wake-On-Radio
+}
+
 
 //========================================================================================================================
 // cmdStrobe => writeCommand
@@ -325,6 +472,164 @@ void CC1101::readBurstReg (uint8_t * buffer, uint8_t regAddr, uint8_t len)
 		buffer[i] = readConfigReg (regAddr);
 }
 
+//========================================================================================================================
+// writeTxFifo
+//
+// Write a part of a packet into the TX FIFO, straight from flash for a PROGMEM view (no RAM copy of the packet)
+//
+// 'packet'	Packet to send
+// 'index'	First byte to write
+// 'len'	Number of bytes
+//========================================================================================================================
+void CC1101::writeTxFifo (const ccPacketView & packet, uint8_t index, uint8_t len)
+{
+	if (!packet.isProgmem) {
+		writeBurstReg (CC1101_TXFIFO, packet.data + index, len);
+		return;
+	}
+
+	for (uint8_t i = 0; i < len; i++) {
+		writeReg (CC1101_TXFIFO, packet [index + i]);
+	}
+}
+
+//========================================================================================================================
+// cmdStrobeFast
+//
+// Same as cmdStrobe without log nor status check
+//========================================================================================================================
+void CC1101::cmdStrobeFast (uint8_t cmd)
+{
+	select				();
+	while (digitalRead(MISO) == HIGH) {}	// The chip is awake, MISO goes low immediately
+	SPI.transfer		(cmd);
+	deselect			();
+}
+
+//========================================================================================================================
+// writeRegFast
+//
+// Same as writeReg without log, status check nor delay
+//========================================================================================================================
+void CC1101::writeRegFast (uint8_t regAddr, uint8_t value)
+{
+	select				();
+	while (digitalRead(MISO) == HIGH) {}
+	SPI.transfer		(regAddr);
+	SPI.transfer		(value);
+	deselect			();
+}
+
+//========================================================================================================================
+// readStatusRegFast
+//
+// Read a status register without delay, reading it until two consecutive values are identical (SPI synchronization
+// issue, see readRegWithSyncProblem)
+//========================================================================================================================
+uint8_t CC1101::readStatusRegFast (uint8_t regAddr) const
+{
+	uint8_t value1, value2;
+
+	auto read = [regAddr] () {
+		select				();
+		while (digitalRead(MISO) == HIGH) {}
+		SPI.transfer		(regAddr | CC1101_STATUS_REGISTER);
+		uint8_t val = SPI.transfer (0x00);
+		deselect			();
+		return val;
+	};
+
+	value1 = read ();
+	do
+	{
+		value2 = value1;
+		value1 = read ();
+	}
+	while (value1 != value2);
+
+	return value1;
+}
+
+//========================================================================================================================
+// readRxFifoFast
+//
+// Burst read of the RX FIFO without delay (the caller must leave at least one byte in the FIFO while receiving,
+// see the CC1101 errata)
+//========================================================================================================================
+void CC1101::readRxFifoFast (uint8_t * buffer, uint8_t len)
+{
+	select				();
+	while (digitalRead(MISO) == HIGH) {}
+	SPI.transfer		(CC1101_RXFIFO | READ_BURST);
+	for (uint8_t i = 0; i < len; i++) {
+		buffer [i] = SPI.transfer (0x00);
+	}
+	deselect			();
+}
+
+//========================================================================================================================
+// setManualCalibration
+//
+// Disable the automatic calibration (MCSM0.FS_AUTOCAL = 0) so that IDLE to RX only takes the settling time
+//
+// Return:
+// 	Previous MCSM0 value to restore
+//========================================================================================================================
+uint8_t CC1101::setManualCalibration (void)
+{
+	uint8_t mcsm0 = readConfigReg (CC1101_MCSM0);
+	writeRegFast (CC1101_MCSM0, mcsm0 & 0xCF);
+	return mcsm0;
+}
+
+//========================================================================================================================
+// calibrateChannel
+//
+// Calibrate the frequency synthesizer on a channel and return the calibration result (the radio is left in IDLE state)
+//
+// Return:
+// 	false if the calibration didn't end within CC1101_CALIBRATION_TIMEOUT_US (fscal unchanged)
+//========================================================================================================================
+bool CC1101::calibrateChannel (uint8_t chnl, uint8_t (&fscal) [CC1101_FSCAL_LEN])
+{
+	cmdStrobeFast		(CC1101_SIDLE);
+	writeRegFast		(CC1101_CHANNR, chnl);
+	cmdStrobeFast		(CC1101_SCAL);
+
+	// Wait the end of calibration (about 720µs)
+	uint32_t startUs = micros ();
+	while ((readStatusRegFast (CC1101_MARCSTATE) & CC1101_BITS_MARCSTATE) != CC_MARCSTATE_IDLE) {
+		if (micros () - startUs > CC1101_CALIBRATION_TIMEOUT_US) {
+			cmdStrobeFast	(CC1101_SIDLE);
+			Logln			(F("Calibration timeout on channel ") << chnl);
+			return false;
+		}
+	}
+
+	fscal [0] = readConfigReg (CC1101_FSCAL3);
+	fscal [1] = readConfigReg (CC1101_FSCAL2);
+	fscal [2] = readConfigReg (CC1101_FSCAL1);
+
+	return true;
+}
+
+//========================================================================================================================
+// retuneChannel
+//
+// Switch to a channel with its cached calibration and enter RX (MCSM0.FS_AUTOCAL must be 0, see setManualCalibration)
+//========================================================================================================================
+void CC1101::retuneChannel (uint8_t chnl, const uint8_t (&fscal) [CC1101_FSCAL_LEN])
+{
+	_channel = chnl;
+
+	cmdStrobeFast		(CC1101_SIDLE);
+	writeRegFast		(CC1101_CHANNR, chnl);
+	writeRegFast		(CC1101_FSCAL3, fscal [0]);
+	writeRegFast		(CC1101_FSCAL2, fscal [1]);
+	writeRegFast		(CC1101_FSCAL1, fscal [2]);
+	cmdStrobeFast		(CC1101_SRX);
+}
+
 //========================================================================================================================
 // setSyncWord (overriding method)
 //
@@ -359,6 +664,7 @@ void CC1101::setDevAddress (uint8_t addr)
 //========================================================================================================================
 void CC1101::setChannel (uint8_t chnl)
 {
+	_channel = chnl;
 	writeReg (CC1101_CHANNR,	chnl);
 }
 
@@ -371,6 +677,9 @@ void CC1101::setChannel (uint8_t chnl)
 //========================================================================================================================
 void CC1101::setDataRate (DATA_RATE dataRate)
 {
+	_dataRate = dataRate;
+	updateRssiOffset ();
+
 	// Data Rate - details extracted from SmartRF Studio
 	switch (dataRate)
 	{
@@ -416,6 +725,34 @@ void CC1101::setDataRate (DATA_RATE dataRate)
 	}
 }
 
+//========================================================================================================================
+// updateRssiOffset
+//
+// RSSI offset for the current carrier frequency and data rate (datasheet table 31, 4 kBaud uses the 1.2 kBaud value)
+//========================================================================================================================
+void CC1101::updateRssiOffset (void)
+{
+	if (_carrierFreq == CFREQ_433) {
+		_rssiOffset = (_dataRate == KBPS_250) ? RSSI_OFFSET_433MHZ_HIGH : RSSI_OFFSET_433MHZ_LOW;
+	}
+	else {
+		_rssiOffset = RSSI_OFFSET_868MHZ;
+	}
+}
+
+//========================================================================================================================
+// rssiToDbm
+//
+// Convert the RSSI byte (status register or appended status byte) to dBm (datasheet section 17.3)
+//
+// 'rssiRaw'		RSSI value in 2's complement, 0.5 dB per step
+// 'rssiOffset'		RSSI offset of the carrier frequency and data rate
+//========================================================================================================================
+int16_t CC1101::rssiToDbm (uint8_t rssiRaw, uint8_t rssiOffset)
+{
+	return ((int16_t) (int8_t) rssiRaw) / 2 - rssiOffset;
+}
+
 //========================================================================================================================
 // setCarrierFreq
 //
@@ -425,6 +762,9 @@ void CC1101::setDataRate (DATA_RATE dataRate)
 //========================================================================================================================
 void CC1101::setCarrierFreq (CFREQ freq)
 {
+	_carrierFreq = freq;
+	updateRssiOffset ();
+
 	switch(freq)
 	{
 		case CFREQ_433:
@@ -500,6 +840,41 @@ bool CC1101::isRssiLqiCrc () const
 	return ((readConfigReg (CC1101_PKTCTRL1) & 0x04) != 0x00);
 }
 
+//===================================================================================================================
+// Forward error correction with interleaving (MDMCFG1.FEC_EN), transparent for the FIFOs
+//===================================================================================================================
+bool CC1101::isFecEnabled () const
+{
+	return ((readConfigReg (CC1101_MDMCFG1) & CC1101_MDMCFG1_FEC_EN) != 0x00);
+}
+
+//===================================================================================================================
+// Data rate configured in MDMCFG4.DRATE_E and MDMCFG3.DRATE_M: ((256 + DRATE_M) * 2^DRATE_E / 2^28) * f_xosc
+//===================================================================================================================
+uint32_t CC1101::getDataRateBaud () const
+{
+	uint8_t drateE = readConfigReg (CC1101_MDMCFG4) & 0x0F;
+	uint8_t drateM = readConfigReg (CC1101_MDMCFG3);
+
+	return (uint32_t) ((((uint64_t) (256 + drateM) << drateE) * CRYSTAL_FREQUENCY) >> 28);
+}
+
+//===================================================================================================================
+// Base frequency (FREQ2..0: FREQ * f_xosc / 2^16) + CHANNR * channel spacing (MDMCFG1.CHANSPC_E, MDMCFG0.CHANSPC_M:
+// (256 + CHANSPC_M) * 2^CHANSPC_E * f_xosc / 2^18)
+//===================================================================================================================
+uint32_t CC1101::getFrequencyHz () const
+{
+	uint32_t freq = ((uint32_t) readConfigReg (CC1101_FREQ2) << 16) | ((uint32_t) readConfigReg (CC1101_FREQ1) << 8) | readConfigReg (CC1101_FREQ0);
+	uint8_t chanspcE = readConfigReg (CC1101_MDMCFG1) & 0x03;
+	uint8_t chanspcM = readConfigReg (CC1101_MDMCFG0);
+
+	uint64_t baseHz		= ((uint64_t) freq * CRYSTAL_FREQUENCY) >> 16;
+	uint64_t spacingHz	= (((uint64_t) (256 + chanspcM) << chanspcE) * CRYSTAL_FREQUENCY) >> 18;
+
+	return (uint32_t) (baseHz + readConfigReg (CC1101_CHANNR) * spacingHz);
+}
+
 //===================================================================================================================
 //	sendPacket
 //
@@ -511,7 +886,7 @@ bool CC1101::isRssiLqiCrc () const
 //			True if the transmission succeeds
 //			False otherwise
 //===================================================================================================================
-bool CC1101::sendCCPacket (CCPACKET & packet)
+bool CC1101::sendCCPacket (const ccPacketView & packet)
 {
 	uint8_t marcState;
 
@@ -553,7 +928,7 @@ bool CC1101::sendCCPacket (CCPACKET & packet)
 	bool isFixedLength	= isFixedPacketLength ();
 	bool isAddrCheck	= isAddressCheck ();
 
-	Logln (F("*** Writing packet: (") << packet << F(") to TX FIFO ***"));
+	Logln (F("*** Writing packet: (") << ccPacketPrinter (packet) << F(") to TX FIFO ***"));
 
 	if (!isFixedLength) {
 		// Packet length configured by the first byte after sync word
@@ -569,7 +944,7 @@ bool CC1101::sendCCPacket (CCPACKET & packet)
 	uint8_t index = len;
 
 	// Write data into the TX FIFO
-	writeBurstReg	(CC1101_TXFIFO, packet.data, len);
+	writeTxFifo		(packet, 0, len);
 
 	printFIFOState	();
 
@@ -583,7 +958,7 @@ bool CC1101::sendCCPacket (CCPACKET & packet)
 		len = (packet.length - index < freeBytes) ? packet.length - index : freeBytes;
 
 		// Write pending data into the TX FIFO
-		writeBurstReg (CC1101_TXFIFO, &(packet.data [index]), len);
+		writeTxFifo (packet, index, len);
 
 		index += len;
 	}
@@ -672,9 +1047,11 @@ uint8_t CC1101::receiveCCPacket (CCPACKET & packet)	// if data available
 			packet.crc_ok = bitRead (val, 7);
 		}
 
+		packet.channel = _channel;
+
 		Logln (F("*** Receiving packet: (") << packet << F(") from RX FIFO ***"));
 
-		printLQI_RSSI ();
+		printLQI_RSSI (packet);
 	}
 	else
 		rxBytesPending = 0;
@@ -828,17 +1205,11 @@ void CC1101::printFIFOState (void)
 }
 
 //===================================================================================================================
-// p92
+// p92 : status bytes appended to the packet (the RSSI/LQI status registers are already those of the next packet)
 //===================================================================================================================
-void CC1101::printLQI_RSSI (void)
+void CC1101::printLQI_RSSI (const CCPACKET & packet)
 {
-	uint8_t quality = readStatusReg (CC1101_LQI);
-	uint8_t lqi = quality & 0x7F;
-	bool crc = bitRead (quality, 7);
-
-	uint8_t sinalStrength = readStatusReg (CC1101_RSSI);
-
-	Logln (F("CRC: ") << crc << F(" RSSI: ") << sinalStrength << F(" LQI: ") << lqi);
+	Logln (F("CRC: ") << packet.crc_ok << F(" RSSI: ") << getRssiDbm (packet.rssi) << F(" dBm LQI: ") << packet.lqi);
 }
 
 //===================================================================================================================
@@ -22,7 +22,7 @@
 
 #include <SPI.h>							// On Arduino, SPI pins are predefined
 
-#include "ccPacket.h"
+#include "ccBasicPacket.h"
 
 namespace cc1101 {
 
@@ -50,7 +50,9 @@ const uint8_t PA_TABLE_30	[8] {0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x00,};
  */
 #define CRYSTAL_FREQUENCY		26000000
 #define FIFOBUFFER			 	0x42	//size of Fifo Buffer
-#define RSSI_OFFSET_868MHZ		0x4E  	//dec = 74
+#define RSSI_OFFSET_868MHZ		74		// Typical RSSI offset at 868 MHz (all data rates)
+#define RSSI_OFFSET_433MHZ_LOW	75		// Typical RSSI offset at 433 MHz, 1.2 to 38.4 kBaud
+#define RSSI_OFFSET_433MHZ_HIGH	79		// Typical RSSI offset at 433 MHz, 250 kBaud
 #define BROADCAST_ADDRESS		0x00	//broadcast address
 #define CC1101_TEMP_ADC_MV		3.225	//3.3V/1023 . mV pro digit
 #define CC1101_TEMP_CELS_CO		2.47	//Temperature coefficient 2.47mV per Grad Celsius
@@ -59,6 +61,40 @@ const uint8_t PA_TABLE_30	[8] {0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x00,};
 #define MIN(x, y)				(((x) < (y)) ? (x) : (y))
 
 
+/**
+ * Frequency synthesizer calibration result of a channel (FSCAL3, FSCAL2, FSCAL1), written back to retune without
+ * calibration (swra147 : fast frequency hopping)
+ */
+#define CC1101_FSCAL_LEN				3
+#define CC1101_SETTLE_US				100			// Frequency synthesizer settling time when going from IDLE to RX without calibration
+#define CC1101_CALIBRATION_TIMEOUT_US	3000		// Synthesizer calibration (about 720µs) not finished => chip missing or stuck
+
+/**
+ * Wake-On-Radio (datasheet section 19.5)
+ */
+#define CC1101_RCOSC_PERIOD_NS			28846		// RC oscillator period = 750 / f_xosc
+#define CC1101_WOREVT_MAX				0xFFFF		// EVENT0 is a 16 bits value
+#define CC1101_WORCTRL_RC_PD			0x80		// Power down the RC oscillator
+#define CC1101_WORCTRL_RC_CAL			0x08		// Enable the RC oscillator calibration
+#define CC1101_MCSM2_RX_TIME_QUAL		0x08		// At RX timeout, stay in RX if sync word found (or PQI reached)
+#define CC1101_MCSM2_RX_TIME_NONE		0x07		// No RX timeout (until end of packet)
+#define CC1101_RX_TIME_MAX				6			// Last MCSM2.RX_TIME value with a timeout
+#define CC1101_RX_TIMEOUT_FACTOR_SCALE	10000		// Datasheet RX timeout factors C (RX_TIME, WOR_RES) are in 1/10000 us
+#define CC1101_XOSC_STARTUP_US			150			// Typical crystal oscillator start-up time
+#define CC1101_FS_CAL_US				720			// Typical frequency synthesizer calibration time (FS_AUTOCAL every 4th wake up)
+#define CC1101_SYNC_DETECT_BITS			64			// Preamble (4 bytes) + sync word needed to qualify a packet
+
+/**
+ * Forward error correction (datasheet section 15.4), fixed packet length mode only
+ */
+#define CC1101_MDMCFG1_FEC_EN			0x80		// Convolutional coding + interleaving of the bytes after the sync word
+
+// Typical current consumptions from the datasheet (433 MHz)
+#define CC1101_CURRENT_SLEEP_WOR_UA		1			// SLEEP state with the RC oscillator running
+#define CC1101_CURRENT_IDLE_UA			1700		// XOSC running (EVENT1 timeout)
+#define CC1101_CURRENT_CAL_UA			8000		// Frequency synthesizer calibration
+#define CC1101_CURRENT_RX_UA			16000		// RX state
+
 /**
  * Frequency channels
  */
@@ -283,6 +319,22 @@ enum DATA_RATE
 	KBPS_4
 };
 
+/**
+ *  Wake-On-Radio configuration computed from a duty cycle and a latency target
+ */
+struct WOR_SETTINGS
+{
+	uint16_t event0				= 0;							// WOREVT1:WOREVT0
+	uint8_t  worRes				= 0;							// WORCTRL.WOR_RES: EVENT0 resolution (x 32^WOR_RES RC periods)
+	uint8_t  event1				= 0;							// WORCTRL.EVENT1: XOSC start-up timeout
+	uint8_t  rxTime				= 0;							// MCSM2.RX_TIME: RX timeout = EVENT0 x C (RX_TIME, WOR_RES)
+
+	uint32_t event0Us			= 0;							// Wake up period
+	uint32_t rxTimeoutUs		= 0;							// RX window on each wake up
+	uint32_t latencyUs			= 0;							// Worst-case detection latency (= minimum preamble length for the transmitter)
+	uint32_t averageCurrentUa	= 0;							// Expected average current
+};
+
 /* Chip states */
 enum CC_STATE
 {
@@ -461,6 +513,8 @@ protected:
 	CFREQ	 _carrierFreq				= CFREQ_868;			// The frequency chosen
 	DATA_RATE _dataRate					= KBPS_38;
 	uint8_t   _devAddress				= 0x00;
+	uint8_t   _channel					= 0x00;					// Current channel number
+	uint8_t   _rssiOffset				= RSSI_OFFSET_868MHZ;	// Depends on the carrier frequency and the data rate
 
 	CC_STATE  _currentState				= CC_STATE_UNKNOWN;		// What the state of the CC1101 is according to our last check
 	CC_STATE  _lastState				= CC_STATE_UNKNOWN;
@@ -469,6 +523,7 @@ protected:
 	CC_MARCSTATE _lastMarcState			= CC_MARCSTATE_UNKNOWN;
 
 	CCPACKET  _lastPacketReceived;								// Last radio signal received by CC1101
+	volatile uint16_t _lastPacketGeneration	= 0;				// Incremented each time _lastPacketReceived is replaced
 
 protected:
 
@@ -483,14 +538,17 @@ protected:
 	uint8_t readReg						(uint8_t regAddr, uint8_t regType) const;
 
 	void writeBurstReg					(uint8_t regAddr, const uint8_t* buffer, const uint8_t len);
+	void writeTxFifo					(const ccPacketView & packet, uint8_t index, uint8_t len);
 	void readBurstReg					(uint8_t * buffer, uint8_t regAddr, uint8_t len);
 
 	bool isFixedPacketLength			() const;
 	bool isAddressCheck					() const;
 	uint8_t getFixedPacketLength		() const;
 	bool isRssiLqiCrc					() const;
+	bool isFecEnabled					() const;
+	void updateRssiOffset				(void);
 
-	virtual bool sendCCPacket 			(CCPACKET & packet);
+	virtual bool sendCCPacket 			(const ccPacketView & packet);
  	virtual uint8_t receiveCCPacket		(CCPACKET & packet);
 
 	void printState						(uint8_t status);
@@ -499,7 +557,7 @@ protected:
 	void printRegisterConfiguration		(void);
 	void printFIFOState					(void);
 	void printMarcstate					(void);
-	void printLQI_RSSI					(void);
+	void printLQI_RSSI					(const CCPACKET & packet);
 	void printGD0xStatus				(void);
 
 public:
@@ -513,18 +571,45 @@ public:
 	void wakeUp							(void);
 	void setPowerDownState				(void);
 
+	bool computeWakeOnRadio				(float dutyCyclePct, uint32_t maxLatencyMs, WOR_SETTINGS & settings) const;
+	void calibrateRcOscillator			(void);
+	void setWakeOnRadio					(const WOR_SETTINGS & settings);
+	void startWakeOnRadio				(void);
+
 	void setSyncWord					(uint8_t sync1, uint8_t sync0);
 	void setDevAddress					(uint8_t addr);
 	void setCarrierFreq					(CFREQ freq);
 	void setDataRate 					(DATA_RATE dataRate);
 	void setChannel						(uint8_t chnl);
+	uint8_t getChannel					() const				{ return _channel; }
+
+	int16_t getRssiDbm					(uint8_t rssiRaw) const	{ return rssiToDbm (rssiRaw, _rssiOffset); }
+	static int16_t rssiToDbm			(uint8_t rssiRaw, uint8_t rssiOffset);
 
-	virtual bool sendPacket 			(CCPACKET & packet) = 0;
+	virtual bool sendPacket 			(const ccPacketView & packet) = 0;
 
 	virtual void startReceivePacket		(uint8_t delayMs) 	= 0;
 	virtual void stopReceivePacket		(void) 				= 0;
 
-	CCPACKET & getLastPacketReceived	(void) { return _lastPacketReceived; }
+	ccRxPacketView getLastPacketView	(void) const			{ return ccRxPacketView (_lastPacketReceived, _lastPacketGeneration);	}
+	void releaseLastPacket				(void)					{ _lastPacketGeneration = _lastPacketGeneration + 1; _lastPacketReceived.reset ();	}
+
+	uint32_t getDataRateBaud			() const;
+	uint32_t getFrequencyHz				() const;				// Carrier frequency of the current channel
+	uint8_t getRssiOffset				() const				{ return _rssiOffset; }
+
+	// Fast path (no log, no delay) for the time critical tools working next to the driver (ccSpectrumScanner,
+	// ccChannelHopper, ccFskDetector): stopReceivePacket before, startReceivePacket after
+	void cmdStrobeFast					(uint8_t cmd);
+	void writeRegFast					(uint8_t regAddr, uint8_t value);
+	uint8_t readStatusRegFast			(uint8_t regAddr) const;
+	uint8_t readConfigRegister			(uint8_t regAddr) const	{ return readConfigReg (regAddr); }
+	void readRxFifoFast					(uint8_t * buffer, uint8_t len);
+	void setChannelFast					(uint8_t chnl)			{ writeRegFast (CC1101_CHANNR, chnl); _channel = chnl; }	// No calibration
+
+	bool calibrateChannel				(uint8_t chnl, uint8_t (&fscal) [CC1101_FSCAL_LEN]);	// false on timeout
+	void retuneChannel					(uint8_t chnl, const uint8_t (&fscal) [CC1101_FSCAL_LEN]);
+	uint8_t setManualCalibration		(void);
  };
 
 }
\ No newline at end of file
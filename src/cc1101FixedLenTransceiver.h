@@ -8,6 +8,7 @@
 #pragma once
 
 #include "cc1101Transceiver.h"
+#include "ccPacketEngine.h"
 
 namespace cc1101 {
 
@@ -16,20 +17,54 @@ namespace cc1101 {
  *
  * Description: cc1101 fixed packet length transceiver
  * CC1101FixedLenTransceiver interface
+ *
+ * The optional FEC (both ends must enable it) doubles the airtime after the sync word but corrects the bit errors of
+ * the weak long distance links: compare the airtimes and packet error rates before choosing (the bench of
+ * extras/host/test_ccPacketEngine prints them at each DATA_RATE).
  */
 class CC1101FixedLenTransceiver : public CC1101Transceiver
 {
+private:
+
+	bool _isFec;
+
 public:
 
-	CC1101FixedLenTransceiver (uint8_t irqPin, uint8_t address = 0x56, uint8_t length = 60)
-		: CC1101Transceiver (irqPin, address, length)
+	CC1101FixedLenTransceiver (uint8_t irqPin, uint8_t address = 0x56, uint8_t length = 60, bool fec = false)
+		: CC1101Transceiver (irqPin, address, length), _isFec (fec)
 	{
 		initRegisters 		();
 		startReceivePacket	();
 	}
 
+	void setFecEnabled (bool enabled)
+	{
+		stopReceivePacket	();
+		_isFec = enabled;
+		writeReg			(CC1101_MDMCFG1,	getMdmcfg1 ());
+		startReceivePacket	();
+	}
+
+	bool isFec () const { return _isFec; }
+
+	CCFRAME_FORMAT getFrameFormat () const
+	{
+		CCFRAME_FORMAT format;
+		format.isVariableLength	= false;
+		format.isAddressCheck	= isAddressCheck ();
+		format.isCrc			= true;
+		format.isWhitening		= false;
+		format.isFec			= _isFec;
+		format.length			= getLength ();
+		return format;
+	}
+
+	uint32_t getPacketAirtimeUs () const { return ccPacketEngine::getAirtimeUs (getLength (), getFrameFormat (), getDataRateBaud ()); }
+
 protected:
 
+	uint8_t getMdmcfg1 () const { return 0x22 | (_isFec ? CC1101_MDMCFG1_FEC_EN : 0x00); }
+
 	virtual void initRegisters	(void) override
 	{
 		/**
@@ -67,7 +102,7 @@ protected:
 		writeReg			(CC1101_FIFOTHR,	0x07);			// used to program threshold points in the FIFOs. Bytes in TX FIFO 33, Bytes in RX FIFO 32. A signal will assert when the number of bytes in the FIFO is equal to or higher than the programmed threshold
 
 		writeReg			(CC1101_MDMCFG2,	0x93);			// Modem Configuration: Enable digital DC blocking filter before demodulator, GFSK + 30/32 sync word bits detected
-		writeReg			(CC1101_MDMCFG1,	0x22);			// 00100010 minimum of 4 preamble bytes to be transmitted + 2 bit exponent of channel spacing
+		writeReg			(CC1101_MDMCFG1,	getMdmcfg1 ());	// x0100010 FEC option + minimum of 4 preamble bytes to be transmitted + 2 bit exponent of channel spacing
 
 		writeReg			(CC1101_PKTCTRL0,	0x04);			// whitening off + fixed length packet + crc appended
 //	 	disableAddressCheck	();									// Append two bytes with status RSSI/LQI/CRC OK, No address check
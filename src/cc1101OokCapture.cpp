@@ -0,0 +1,186 @@
+//************************************************************************************************************************
+// cc1101OokCapture.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <Common.h>
+
+#include "cc1101OokCapture.h"
+
+using namespace corex;
+
+
+namespace cc1101 {
+
+CC1101OokCapture * CC1101OokCapture :: _instance = nullptr;
+
+//========================================================================================================================
+//
+//========================================================================================================================
+CC1101OokCapture :: CC1101OokCapture (uint8_t gdo2Pin)
+	: CC1101 (gdo2Pin)
+{
+	_instance = this;
+	initRegisters ();
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+CC1101OokCapture :: ~CC1101OokCapture ()
+{
+	stopReceivePacket ();
+	_instance = nullptr;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void CC1101OokCapture :: initRegisters ()
+{
+	/**
+	 * Configuration:
+	 *
+	 * Carrier frequency = 433
+	 * Modulation format = ASK/OOK
+	 * Manchester enable = false
+	 * Sync word qualifier mode = No preamble/sync
+	 * Data format = Asynchronous serial mode, data output on GDO2
+	 * Length config = Infinite packet length mode
+	 * RX filter BW = 203 kHz
+	 */
+
+	setCarrierFreq		(CFREQ_433);
+	setChannel			(0x00);
+
+	writeReg			(CC1101_FSCTRL1,	0x06);			// Frequency Synthesizer Control
+	writeReg			(CC1101_MDMCFG4,	0x87);			// RX filter BW = 203 kHz (the data rate is not used in asynchronous mode)
+	writeReg			(CC1101_MDMCFG3,	0x83);
+	writeReg			(CC1101_MDMCFG2,	0x30);			// Modem Configuration: ASK/OOK, no Manchester, no preamble/sync
+	writeReg			(CC1101_MDMCFG1,	0x00);
+
+	writeReg			(CC1101_AGCCTRL2,	0x03);			// AGC Control: all gain settings, max 33 dB target (OOK)
+	writeReg			(CC1101_AGCCTRL1,	0x00);
+	writeReg			(CC1101_AGCCTRL0,	0x91);			// Medium hysteresis, 16 samples, OOK decision boundary 8 dB
+	writeReg			(CC1101_FREND1,		0x56);
+	writeReg			(CC1101_FREND0,		0x11);			// OOK: PATABLE index 1 for a '1'
+
+	writeReg			(CC1101_MCSM0,		0x18);			// Auto calibrate When going from IDLE to RX or TX (or FSTXON)
+	writeReg			(CC1101_MCSM1,		0x3C);			// Stay in RX after reception
+
+	writeReg			(CC1101_PKTCTRL0,	0x32);			// Asynchronous serial mode, infinite packet length
+	writeReg			(CC1101_PKTCTRL1,	0x00);			// No status, no address check
+
+	writeReg			(CC1101_IOCFG2,		0x0D);			// Serial Data Output (asynchronous)
+	writeReg			(CC1101_IOCFG0,		0x2E);			// High impedance (3-state)
+
+	const byte paTable [8] = {0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};	// OOK: off / low power
+	writeBurstReg	(CC1101_PATABLE, (byte*)paTable, 8);
+}
+
+//========================================================================================================================
+// Interrupt Service Routines (ISR) handler has to be marked with ICACHE_RAM_ATTR
+//========================================================================================================================
+#if defined (ESP8266) || defined (ESP32)
+void IRAM_ATTR CC1101OokCapture :: _ISR_gdo2_edge ()
+#else
+void CC1101OokCapture :: _ISR_gdo2_edge ()
+#endif
+{
+	uint32_t now = micros ();
+	CC1101OokCapture * capture = _instance;
+
+	// The level which just ended is the opposite of the current one
+	bool level = (digitalRead (capture->_irqPin) == LOW);
+	capture->_pulses.push (makePulse (level, now - capture->_lastEdgeUs));
+	capture->_lastEdgeUs = now;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool CC1101OokCapture :: sendPacket (const ccPacketView &)
+{
+	Logln (F("Packets can't be sent in asynchronous capture mode"));
+	return false;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void CC1101OokCapture :: startReceivePacket (uint8_t delayMs /*= 0*/)
+{
+	if (_isCapturing) return;
+
+	Logln (F("--------- CC1101 Starting to capture pulses --------- "));
+
+	if (delayMs > 0) EspBoard::asyncDelayMillis (delayMs);
+
+	setIdleState		();
+	setRxState			();
+
+	_pulses.clear		();
+	_encoder.reset		();
+	_lastEdgeUs			= micros ();
+	_isCapturing		= true;
+
+	attachInterrupt (digitalPinToInterrupt (_irqPin), _ISR_gdo2_edge, CHANGE);
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void CC1101OokCapture :: stopReceivePacket ()
+{
+	if (!_isCapturing) return;
+
+	detachInterrupt (digitalPinToInterrupt (_irqPin));
+	_isCapturing = false;
+
+	setIdleState ();
+
+	Logln (F("Capture stopped: ") << available () << F(" pulses pending, ") << getOverflows () << F(" lost"));
+}
+
+//========================================================================================================================
+// Pop the captured pulses in delta encoded form (see ccPulseDeltaEncoder)
+//
+// Return:
+// 	Nb bytes written
+//========================================================================================================================
+size_t CC1101OokCapture :: exportDelta (uint8_t * out, size_t len)
+{
+	size_t n = 0;
+	uint16_t pulse;
+
+	while ((n + CCPULSE_DELTA_MAX_BYTES <= len) && _pulses.pop (pulse)) {
+		n += _encoder.encode (pulse, out + n);
+	}
+
+	return n;
+}
+
+//========================================================================================================================
+// Pop the captured pulses in delta encoded form as hexadecimal text
+//========================================================================================================================
+size_t CC1101OokCapture :: exportDelta (Print & p)
+{
+	static const char hexDigits [] = "0123456789abcdef";
+
+	uint8_t buffer [CCPULSE_DELTA_MAX_BYTES];
+	size_t n = 0;
+	uint16_t pulse;
+
+	while (_pulses.pop (pulse)) {
+		uint8_t len = _encoder.encode (pulse, buffer);
+		for (uint8_t i = 0; i < len; i++) {
+			n += p.write (hexDigits [buffer [i] >> 4]);
+			n += p.write (hexDigits [buffer [i] & 0x0F]);
+		}
+	}
+
+	return n;
+}
+
+}
@@ -0,0 +1,60 @@
+//************************************************************************************************************************
+// cc1101OokCapture.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include "cc1101.h"
+#include "ccPulse.h"
+
+
+namespace cc1101 {
+
+/**
+ * Class: CC1101OokCapture
+ *
+ * Description: cc1101 raw OOK pulses capture (replaces the SDR + rtl_433 step to learn new remotes)
+ * The CC1101 is set in asynchronous serial mode (PKTCTRL0.PKT_FORMAT = 3) and outputs the demodulated data on GDO2.
+ * Each edge is timestamped by an interrupt and the pulse / gap durations (µs) are stored in a preallocated ring buffer.
+ */
+class CC1101OokCapture : public CC1101
+{
+private:
+
+	static CC1101OokCapture *	_instance;						// Used by the interrupt service routine
+
+	ccPulseRing					_pulses;
+	ccPulseDeltaEncoder			_encoder;
+	volatile uint32_t			_lastEdgeUs		= 0;
+	bool						_isCapturing	= false;
+
+private:
+
+	static void _ISR_gdo2_edge			();
+
+protected:
+
+	virtual void initRegisters			();
+
+public:
+
+	CC1101OokCapture					(uint8_t gdo2Pin);
+	virtual ~CC1101OokCapture			();
+
+	virtual bool sendPacket				(const ccPacketView & packet) override;
+
+	virtual void startReceivePacket		(uint8_t delayMs = 0) override;
+	virtual void stopReceivePacket		() override;
+
+	bool isCapturing					() const				{ return _isCapturing;				}
+	uint16_t available					() const				{ return _pulses.available ();		}
+	uint32_t getOverflows				() const				{ return _pulses.getOverflows ();	}
+	bool readPulse						(uint16_t & pulse)		{ return _pulses.pop (pulse);		}
+
+	size_t exportDelta					(uint8_t * out, size_t len);
+	size_t exportDelta					(Print & p);
+};
+
+}
@@ -0,0 +1,205 @@
+//************************************************************************************************************************
+// cc1101OokTransmitter.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <Common.h>
+
+#include "cc1101OokTransmitter.h"
+
+using namespace corex;
+
+
+namespace cc1101 {
+
+CC1101OokTransmitter * CC1101OokTransmitter :: _instance = nullptr;
+
+//========================================================================================================================
+//
+//========================================================================================================================
+CC1101OokTransmitter :: CC1101OokTransmitter (uint8_t gdo0Pin)
+	: CC1101 (), _gdo0Pin (gdo0Pin)
+{
+	_instance = this;
+
+	pinMode			(_gdo0Pin, OUTPUT);
+	digitalWrite	(_gdo0Pin, LOW);
+
+	initRegisters	();
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+CC1101OokTransmitter :: ~CC1101OokTransmitter ()
+{
+	timer1_disable ();
+	timer1_detachInterrupt ();
+	_instance = nullptr;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void CC1101OokTransmitter :: initRegisters ()
+{
+	/**
+	 * Configuration:
+	 *
+	 * Carrier frequency = 433
+	 * Modulation format = ASK/OOK
+	 * Manchester enable = false
+	 * Data format = Asynchronous serial mode, data input on GDO0
+	 * Length config = Infinite packet length mode
+	 * TX power = 10 dBm
+	 */
+
+	setCarrierFreq		(CFREQ_433);
+	setChannel			(0x00);
+
+	writeReg			(CC1101_MDMCFG2,	0x30);			// Modem Configuration: ASK/OOK, no Manchester, no preamble/sync
+	writeReg			(CC1101_MDMCFG1,	0x00);
+
+	writeReg			(CC1101_MCSM0,		0x18);			// Auto calibrate When going from IDLE to RX or TX (or FSTXON)
+	writeReg			(CC1101_MCSM1,		0x00);
+
+	writeReg			(CC1101_PKTCTRL0,	0x32);			// Asynchronous serial mode, infinite packet length
+	writeReg			(CC1101_PKTCTRL1,	0x00);			// No status, no address check
+
+	writeReg			(CC1101_IOCFG0,		0x2E);			// GDO0 is the TX data input in asynchronous serial mode
+	writeReg			(CC1101_IOCFG2,		0x2E);			// High impedance (3-state)
+
+	writeReg			(CC1101_FREND0,		0x11);			// OOK: PATABLE index 0 for a '0', index 1 for a '1'
+
+	const byte paTable [8] = {0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};	// OOK: off / long distance
+	writeBurstReg	(CC1101_PATABLE, (byte*)paTable, 8);
+}
+
+//========================================================================================================================
+// Direct GPIO register access: constant time, no function call
+//========================================================================================================================
+#if defined (ESP8266)
+inline void IRAM_ATTR CC1101OokTransmitter :: writeGdo0 (bool level)
+{
+	if (level)	GPOS = (1 << _gdo0Pin);
+	else		GPOC = (1 << _gdo0Pin);
+}
+#else
+inline void CC1101OokTransmitter :: writeGdo0 (bool level)
+{
+	digitalWrite (_gdo0Pin, level ? HIGH : LOW);
+}
+#endif
+
+//========================================================================================================================
+// Advance the schedule of one pulse and return the timer delay from now to the new edge: the latency of the current
+// interrupt (now - edgeCycles) is subtracted
+//========================================================================================================================
+uint32_t IRAM_ATTR CC1101OokTransmitter :: scheduleEdge (uint32_t & edgeCycles, uint16_t widthUs, uint32_t nowCycles)
+{
+	edgeCycles += (uint32_t) widthUs * CCOOKTX_CPU_CYCLES_PER_US;
+
+	int32_t delayCycles = (int32_t) (edgeCycles - nowCycles);
+	uint32_t ticks = (delayCycles > 0) ? ((uint32_t) delayCycles * CCOOKTX_TIMER_TICKS_PER_US) / CCOOKTX_CPU_CYCLES_PER_US : 0;
+
+	return (ticks < CCOOKTX_MIN_TIMER_TICKS) ? CCOOKTX_MIN_TIMER_TICKS : ticks;
+}
+
+//========================================================================================================================
+// Timer interrupt at the end of the current pulse: start the next one first (fixed latency) then fetch the following
+//========================================================================================================================
+#if defined (ESP8266) || defined (ESP32)
+void IRAM_ATTR CC1101OokTransmitter :: _ISR_timer ()
+#else
+void CC1101OokTransmitter :: _ISR_timer ()
+#endif
+{
+	CC1101OokTransmitter * tx = _instance;
+
+	if (!tx->_isSending) return;
+
+	uint16_t pulse = tx->_nextPulse;
+	if (pulse == 0) {
+		// End of stream
+		tx->writeGdo0 (false);
+		timer1_disable ();
+		tx->_isSending = false;
+		return;
+	}
+
+	tx->writeGdo0 (pulseLevel (pulse));
+	timer1_write (scheduleEdge (tx->_edgeCycles, pulseWidth (pulse), ESP.getCycleCount ()));
+
+	if (!tx->_pulses.pop (tx->_nextPulse)) tx->_nextPulse = 0;
+}
+
+//========================================================================================================================
+// Blocking transmission of a stream of pulses
+//========================================================================================================================
+bool CC1101OokTransmitter :: sendPulses (ccPulseSource & source)
+{
+	Logln (F("--------- CC1101 sending raw pulses --------- "));
+
+	uint16_t pulse;
+
+	_pulses.clear ();
+	if (!source.next (_nextPulse)) return false;
+	while ((_pulses.available () < CCOOKTX_PREFILL) && source.next (pulse)) {
+		_pulses.push (pulse);
+	}
+
+	setIdleState	();
+	setTxState		();								// The carrier follows GDO0
+
+	_isSending = true;
+
+	timer1_isr_init			();
+	timer1_attachInterrupt	(_ISR_timer);
+	timer1_enable			(TIM_DIV16, TIM_EDGE, TIM_SINGLE);
+	_edgeCycles = ESP.getCycleCount ();
+	timer1_write			(scheduleEdge (_edgeCycles, 10, _edgeCycles));	// First edge in 10µs
+
+	// Stream the remaining pulses while the timer interrupt consumes them
+	bool hasNext = source.next (pulse);
+	while (_isSending && hasNext) {
+		if (_pulses.push (pulse)) {
+			hasNext = source.next (pulse);
+		}
+		else {
+			yield ();
+		}
+	}
+	bool underflow = hasNext;						// The stream was not completely sent
+
+	while (_isSending) {
+		yield ();
+	}
+
+	timer1_detachInterrupt	();
+	setIdleState			();
+
+	if (underflow) Logln (F("Pulses underflow, transmission aborted"));
+
+	return !underflow;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool CC1101OokTransmitter :: sendPulses (const uint16_t * pulses, size_t nbPulses, uint8_t nbRepeats /*= 1*/)
+{
+	ccPulseArraySource source (pulses, nbPulses, nbRepeats);
+	return sendPulses (source);
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool CC1101OokTransmitter :: sendPacket (const ccPacketView &)
+{
+	Logln (F("Packets can't be sent in asynchronous mode, use sendPulses"));
+	return false;
+}
+
+}
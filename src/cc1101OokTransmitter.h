@@ -0,0 +1,74 @@
+//************************************************************************************************************************
+// cc1101OokTransmitter.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include "cc1101.h"
+#include "ccPulse.h"
+
+
+namespace cc1101 {
+
+#define CCOOKTX_TIMER_TICKS_PER_US		5							// Timer1 at 80 MHz / 16
+#ifdef F_CPU
+#	define CCOOKTX_CPU_CYCLES_PER_US	(F_CPU / 1000000UL)			// CPU cycle counter (CCOUNT), the edges schedule
+#else
+#	define CCOOKTX_CPU_CYCLES_PER_US	80
+#endif
+#define CCOOKTX_MIN_TIMER_TICKS			10							// 2µs: an edge already late is started as soon as possible
+#define CCOOKTX_PREFILL					64							// Pulses queued before starting the timer
+
+
+/**
+ * Class: CC1101OokTransmitter
+ *
+ * Description: cc1101 raw OOK pulses transmitter
+ * Replays signals the packet engine can't express (non byte aligned X2D frames, PWM remotes..). The CC1101 is set in
+ * asynchronous serial TX mode and the MCU drives its GDO0 input from a pulse / gap list. The edges are scheduled by
+ * the hardware timer1 interrupt which only writes the pin and reloads the timer, the loop streams the pulses.
+ * The timer is reloaded from inside the interrupt: its delay is computed from the scheduled time of the edge (CPU cycle
+ * counter), not from the interrupt entry, so the interrupt latency doesn't accumulate over the frame (each edge is
+ * only late by its own latency).
+ */
+class CC1101OokTransmitter : public CC1101
+{
+private:
+
+	static CC1101OokTransmitter *	_instance;					// Used by the interrupt service routine
+
+	uint8_t						_gdo0Pin;
+	ccPulseRing					_pulses;
+	uint16_t					_nextPulse		= 0;				// Pulse started by the next timer interrupt
+	uint32_t					_edgeCycles		= 0;				// Scheduled time (CPU cycles) of the next edge
+	volatile bool				_isSending		= false;
+
+private:
+
+	static void _ISR_timer				();
+	void writeGdo0						(bool level);
+
+protected:
+
+	virtual void initRegisters			();
+
+public:
+
+	CC1101OokTransmitter				(uint8_t gdo0Pin);
+	virtual ~CC1101OokTransmitter		();
+
+	bool sendPulses						(ccPulseSource & source);
+	bool sendPulses						(const uint16_t * pulses, size_t nbPulses, uint8_t nbRepeats = 1);	// RAM or PROGMEM
+
+	virtual bool sendPacket				(const ccPacketView & packet) override;
+
+	static uint32_t scheduleEdge		(uint32_t & edgeCycles, uint16_t widthUs, uint32_t nowCycles);	// Timer ticks to the next edge
+
+	// Transmit only
+	virtual void startReceivePacket		(uint8_t /* delayMs */ = 0) override	{}
+	virtual void stopReceivePacket		() override						{}
+};
+
+}
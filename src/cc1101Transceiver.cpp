@@ -41,12 +41,47 @@ void CC1101Transceiver :: startSendPacket ()
 //========================================================================================================================
 //
 //========================================================================================================================
-bool CC1101Transceiver :: sendPacket (CCPACKET & packet)
+bool CC1101Transceiver :: transmitPacket (const ccPacketView & packet)
+{
+	if (!isCompressing ()) return sendCCPacket (packet);
+
+	CCPACKET packed;
+	if (!ccPacketCompressor::pack (packet, packed)) {
+		Logln(F("Packet too long to be sent with a compression header"));
+		return false;
+	}
+	return sendCCPacket (packed);
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool CC1101Transceiver :: sendPacket (const ccPacketView & packet)
 {
 	stopReceivePacket ();
 	startSendPacket ();
 
-	bool result = sendCCPacket (packet);
+	bool result = transmitPacket (packet);
+
+	// Return back in Rx state after 100ms
+	startReceivePacket ();
+
+	return result;
+}
+
+//========================================================================================================================
+// Burst of packets of any size (CCPACKET, BasicPacket<N>, byte arrays) without copy
+//========================================================================================================================
+bool CC1101Transceiver :: sendPackets (const ccPacketView * packets, uint8_t nbPackets)
+{
+	stopReceivePacket ();
+	startSendPacket ();
+
+	bool result = true;
+	for (int i=0; i<nbPackets; i++)
+	{
+		result &= transmitPacket (packets[i]);
+	}
 
 	// Return back in Rx state after 100ms
 	startReceivePacket ();
@@ -65,7 +100,7 @@ bool CC1101Transceiver :: sendPackets (CCPACKET * packets, uint8_t nbPackets)
 	bool result = true;
 	for (int i=0; i<nbPackets; i++)
 	{
-		result &= sendCCPacket (packets[i]);
+		result &= transmitPacket (packets[i]);
 	}
 
 	// Return back in Rx state after 100ms
@@ -74,6 +109,31 @@ bool CC1101Transceiver :: sendPackets (CCPACKET * packets, uint8_t nbPackets)
 	return result;
 }
 
+//========================================================================================================================
+// The queued packets go back to the pool once sent (or failed). isPacketSent tells whether the queued pool packet
+// `packet` was sent, the other packets of the burst may succeed or fail independently
+//========================================================================================================================
+uint8_t CC1101Transceiver :: sendQueuedPackets (const CCPACKET * packet /*= nullptr*/, bool * isPacketSent /*= nullptr*/)
+{
+	if (isPacketSent != nullptr) *isPacketSent = false;
+	if (_txQueue.isEmpty ()) return 0;
+
+	stopReceivePacket ();
+	startSendPacket ();
+
+	uint8_t nbSent = 0;
+	for (ccPacketHandle queued = _txQueue.pop (); queued; queued = _txQueue.pop ()) {
+		if (!transmitPacket (*queued)) continue;
+		nbSent++;
+		if ((isPacketSent != nullptr) && (queued.get () == packet)) *isPacketSent = true;
+	}
+
+	// Return back in Rx state after 100ms
+	startReceivePacket ();
+
+	return nbSent;
+}
+
 //========================================================================================================================
 // Interrupt Service Routines (ISR) handler has to be marked with ICACHE_RAM_ATTR
 //========================================================================================================================
@@ -118,6 +178,14 @@ void CC1101Transceiver :: continueReceivePacket ()
 {
 	uint8_t marcState;
 
+	if (_wakeOnRadio) {
+		startWakeOnRadio ();								// RX polling, GDO2 asserts on a sync word
+
+		callBakFunction = std::bind (&CC1101Transceiver::checkNewPacketReceived, this);
+		attachInterrupt (_irqPin, _ISR_cc1101_irq_pin, FALLING);	// End of the packet
+		return;
+	}
+
 	setIdleState 		();
 	setRxState			(); 								// Switch to RX state
 
@@ -139,6 +207,37 @@ void CC1101Transceiver :: continueReceivePacket ()
 	attachInterrupt (_irqPin, _ISR_cc1101_irq_pin, RISING);
 }
 
+//========================================================================================================================
+// Receive with Wake-On-Radio: the CC1101 sleeps between two RX windows and the MCU is only interrupted when a packet
+// is received. The transmitter preamble must last at least maxLatencyMs
+//========================================================================================================================
+bool CC1101Transceiver :: setWakeOnRadioReceive (float dutyCyclePct, uint32_t maxLatencyMs)
+{
+	WOR_SETTINGS settings;
+
+	bool result = computeWakeOnRadio (dutyCyclePct, maxLatencyMs, settings);
+
+	stopReceivePacket	();
+	setWakeOnRadio		(settings);
+	_wakeOnRadio		= true;
+	continueReceivePacket ();
+
+	return result;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void CC1101Transceiver :: setContinuousReceive ()
+{
+	stopReceivePacket	();
+	setIdleState		();								// Exit Wake-On-Radio
+	writeReg			(CC1101_MCSM2,	CC1101_MCSM2_RX_TIME_NONE);
+	writeReg			(CC1101_MCSM0,	0x18);			// Auto calibrate When going from IDLE to RX or TX (or FSTXON)
+	_wakeOnRadio		= false;
+	continueReceivePacket ();
+}
+
 //========================================================================================================================
 //
 //========================================================================================================================
@@ -166,7 +265,49 @@ uint8_t CC1101Transceiver :: receivePacket	(CCPACKET & packet)
 //
 //========================================================================================================================
 bool CC1101Transceiver :: checkNewPacketReceived () {
-	return (receivePacket (_lastPacketReceived) > 0);
+
+	if (receivePacket (_rxPacket) == 0) return false;
+
+	if (isCompressing () && !ccPacketCompressor::unpack (_rxPacket)) {
+		Logln (F("Malformatted compressed packet dropped"));
+		return false;
+	}
+
+	// Only the packets delivered or repeated count in the link stats of their sender
+	if (isRssiLqiCrc ()) {
+		_linkStats.update (_rxPacket, getRssiDbm (_rxPacket.rssi), millis ());
+	}
+
+	uint8_t repeats = _deduplicator.filter (_rxPacket, millis ());
+	if (repeats > 1) {
+		// Copy of a packet already delivered => just count it
+		if ((_rxPacket.address == _lastPacketReceived.address) && (_rxPacket.length == _lastPacketReceived.length) &&
+			(memcmp (_rxPacket.data, _lastPacketReceived.data, _rxPacket.length) == 0)) {
+			_lastPacketRepeats = repeats;
+		}
+		Logln (F("Repeated packet dropped (x") << repeats << F(")"));
+		return false;
+	}
+
+	_lastPacketGeneration = _lastPacketGeneration + 1;			// Invalidates the views on the previous packet
+	_lastPacketReceived	= _rxPacket;
+	_lastPacketRepeats	= 1;
+
+	_lastPacketMeta.timestampMs	= millis ();				// Metadata stored with the packet (ccPacketStorage)
+	_lastPacketMeta.frequencyHz	= getFrequencyHz ();
+	_lastPacketMeta.profile		= getProfile ();
+
+	if (_isRxQueueEnabled) {
+		ccPacketHandle packet = I(ccPacketPool).acquire ();
+		if (packet) {
+			*packet = _rxPacket;
+			if (!_rxQueue.push (packet)) Logln (F("RX queue full, packet dropped"));
+		}
+	}
+
+	notifyPacketReceived (_lastPacketReceived, _lastPacketRepeats);
+
+	return true;
 }
 
 }
\ No newline at end of file
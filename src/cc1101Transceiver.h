@@ -6,10 +6,28 @@
 
 #pragma once
 
+#include <Common.h>
+
 #include "cc1101.h"
+#include "ccPacketDeduplicator.h"
+#include "ccLinkStats.h"
+#include "ccPacketPool.h"
+#include "ccPacketCompressor.h"
+#include "ccPacketCodec.h"
 
 namespace cc1101 {
 
+#define CCPACKET_RX_QUEUE_LEN			4							// Received packets waiting for the application (pool packets)
+#define CCPACKET_TX_QUEUE_LEN			4							// Packets waiting to be sent in one burst (pool packets)
+
+// Radio profile of the received packets (CCPACKET_META.profile), 0 => unknown
+enum CC_PROFILE
+{
+	CC_PROFILE_FIXED_LEN = 1,
+	CC_PROFILE_VAR_LEN,
+	CC_PROFILE_X2D
+};
+
 /**
  * Class: CC1101Transceiver
  *
@@ -23,17 +41,37 @@ protected:
 	uint8_t _address;
 	uint8_t	_len;
 
+	CCPACKET				_rxPacket;							// Reception buffer, copied in _lastPacketReceived if it's a new packet
+	ccPacketDeduplicator	_deduplicator;						// Repeated frames suppression
+	uint8_t					_lastPacketRepeats	= 0;			// Nb copies received of the last packet
+	CCPACKET_META			_lastPacketMeta;					// Reception time, frequency and profile of the last packet
+	ccLinkStats				_linkStats;							// Per sender link quality
+
+	bool					_wakeOnRadio		= false;		// Low power reception (RX polling) instead of continuous RX
+
+	bool					_isCompressionEnabled	= false;	// Variable length packets payloads compressed (ccPacketCompressor header)
+
+	bool					_isRxQueueEnabled	= false;		// Each new packet is also queued (a pool packet is held per queued packet)
+	ccPacketQueue <CCPACKET_RX_QUEUE_LEN>	_rxQueue;
+	ccPacketQueue <CCPACKET_TX_QUEUE_LEN>	_txQueue;
+
 protected:
 
 	virtual void initRegisters			() = 0;
 
 	virtual void startSendPacket		();
+	bool transmitPacket					(const ccPacketView & packet);	// Compressed if enabled
 
 	uint8_t receivePacket				(CCPACKET & packet);
 	virtual void continueReceivePacket	();
 
 	bool checkNewPacketReceived			();
 
+public:
+
+	// Each new packet received (once per burst of repeated frames) and its current repeat count
+	corex::Signal <const CCPACKET &, uint8_t>	notifyPacketReceived;
+
 public:
 
 	CC1101Transceiver 					(uint8_t irqPin, uint8_t address, uint8_t length);
@@ -41,11 +79,38 @@ public:
 	virtual uint8_t getAddress			() const { return _address; }
 	virtual uint8_t getLength			() const { return _len - (isAddressCheck () ? 1 : 0); }
 
-	virtual bool sendPacket 			(CCPACKET & packet) override;
+	virtual bool sendPacket 			(const ccPacketView & packet) override;
+	bool sendPacket						(const uint8_t * data, uint8_t length, uint8_t address = 0)	{ return sendPacket (ccPacketView (data, length, address));				}
+	bool sendPacket_P					(const uint8_t * data, uint8_t length, uint8_t address = 0)	{ return sendPacket (ccPacketView::fromProgmem (data, length, address));	}
+	virtual bool sendPackets			(const ccPacketView * packets, uint8_t nbPackets);
 	virtual bool sendPackets			(CCPACKET * packets, uint8_t nbPackets);
 
 	virtual void startReceivePacket		(uint8_t delayMs = 100) override;
 	virtual void stopReceivePacket		() override;
+
+	bool setWakeOnRadioReceive			(float dutyCyclePct, uint32_t maxLatencyMs);
+	void setContinuousReceive			();
+
+	void setDuplicateFilterWindow		(uint32_t windowMs)		{ _deduplicator.setWindow (windowMs); _deduplicator.reset (); }	// 0 to disable
+	uint8_t getLastPacketRepeats		() const				{ return _lastPacketRepeats; }
+	const CCPACKET_META & getLastPacketMeta () const			{ return _lastPacketMeta; }
+
+	virtual CC_PROFILE getProfile		() const				{ return isFixedPacketLength () ? CC_PROFILE_FIXED_LEN : CC_PROFILE_VAR_LEN; }
+
+	const ccLinkStats & getLinkStats	() const				{ return _linkStats; }
+	void resetLinkStats					()						{ _linkStats.reset (); }
+
+	void setCompressionEnabled			(bool enabled)			{ _isCompressionEnabled = enabled; }	// Both ends must enable it
+	bool isCompressing					() const				{ return _isCompressionEnabled && (_len == 0); }	// Variable length only
+
+	void setRxQueueEnabled				(bool enabled)			{ _isRxQueueEnabled = enabled; if (!enabled) _rxQueue.clear (); }
+	ccPacketHandle popReceivedPacket	()						{ return _rxQueue.pop (); }		// Empty handle if no packet
+
+	bool queuePacket					(const ccPacketHandle & packet)	{ return _txQueue.push (packet); }
+	uint8_t sendQueuedPackets			(const CCPACKET * packet = nullptr, bool * isPacketSent = nullptr);	// One burst, returns the number of packets sent
+
+	const ccPacketQueue <CCPACKET_RX_QUEUE_LEN> & getRxQueue () const	{ return _rxQueue; }
+	const ccPacketQueue <CCPACKET_TX_QUEUE_LEN> & getTxQueue () const	{ return _txQueue; }
 };
 
 }
\ No newline at end of file
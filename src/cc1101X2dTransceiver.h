@@ -28,6 +28,8 @@ public:
 		initRegisters ();
 	}
 
+	virtual CC_PROFILE getProfile	() const override	{ return CC_PROFILE_X2D; }
+
 protected:
 
 	virtual void initRegisters	(void) override
@@ -0,0 +1,120 @@
+//************************************************************************************************************************
+// ccBasicPacket.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <Common.h>
+
+#include "ccBasicPacket.h"
+
+using namespace corex;
+
+
+namespace cc1101 {
+
+// Two hex digits per byte value (512 bytes in flash)
+static const char hexTable [512 + 1] PROGMEM =
+	"000102030405060708090A0B0C0D0E0F"
+	"101112131415161718191A1B1C1D1E1F"
+	"202122232425262728292A2B2C2D2E2F"
+	"303132333435363738393A3B3C3D3E3F"
+	"404142434445464748494A4B4C4D4E4F"
+	"505152535455565758595A5B5C5D5E5F"
+	"606162636465666768696A6B6C6D6E6F"
+	"707172737475767778797A7B7C7D7E7F"
+	"808182838485868788898A8B8C8D8E8F"
+	"909192939495969798999A9B9C9D9E9F"
+	"A0A1A2A3A4A5A6A7A8A9AAABACADAEAF"
+	"B0B1B2B3B4B5B6B7B8B9BABBBCBDBEBF"
+	"C0C1C2C3C4C5C6C7C8C9CACBCCCDCECF"
+	"D0D1D2D3D4D5D6D7D8D9DADBDCDDDEDF"
+	"E0E1E2E3E4E5E6E7E8E9EAEBECEDEEEF"
+	"F0F1F2F3F4F5F6F7F8F9FAFBFCFDFEFF";
+
+//========================================================================================================================
+// Exact text length: "L-$len A-$aa [$dd $dd ..] (N)OK S-$ss Q-$qq", 0 if the packet is empty or too long
+//========================================================================================================================
+size_t ccPacketPrinter :: formattedSize () const
+{
+	if ((_view.length == 0) || (_view.length > CCPACKET_DATA_LEN)) return 0;
+
+	uint8_t lengthDigits = (_view.length >= 100) ? 3 : (_view.length >= 10) ? 2 : 1;
+
+	return	(2 + lengthDigits + 1) +								// L-$len
+			(2 + 2 + 1) +											// A-$aa
+			(1 + 3 * _view.length - 1 + 1 + 1) +					// [$dd $dd ..]
+			((_crcOk ? 2 : 3) + 1) +								// (N)OK
+			(2 + 2 + 1) +											// S-$ss
+			(2 + 2);												// Q-$qq
+}
+
+//========================================================================================================================
+// Single pass formatting in a caller buffer (no terminating 0), returns formattedSize () or 0 if the buffer is too small
+//========================================================================================================================
+size_t ccPacketPrinter :: format (char * buffer, size_t size) const
+{
+	size_t len = formattedSize ();
+	if ((len == 0) || (len > size)) return 0;
+
+	char * p = buffer;
+
+	auto putStr = [&p] (PGM_P str) {
+		size_t n = strlen_P (str);
+		memcpy_P (p, str, n);
+		p += n;
+	};
+	auto putHex = [&p] (uint8_t value) {
+		memcpy_P (p, hexTable + 2 * value, 2);
+		p += 2;
+	};
+
+	putStr (PSTR(PRINT_CCPACKET_DATALEN));
+	if (_view.length >= 100)	*p++ = '0' + _view.length / 100;
+	if (_view.length >= 10)		*p++ = '0' + (_view.length / 10) % 10;
+	*p++ = '0' + _view.length % 10;
+	*p++ = PRINT_CCPACKET_SEPARATOR [0];
+
+	putStr (PSTR(PRINT_CCPACKET_ADDRESS));
+	putHex (_view.address);
+	*p++ = PRINT_CCPACKET_SEPARATOR [0];
+
+	*p++ = PRINT_CCPACKET_DATA_BEGIN [0];
+	putHex (_view [0]);
+	for (uint8_t i = 1; i < _view.length; i++) {
+		*p++ = PRINT_CCPACKET_SEPARATOR [0];
+		putHex (_view [i]);
+	}
+	*p++ = PRINT_CCPACKET_DATA_END [0];
+	*p++ = PRINT_CCPACKET_SEPARATOR [0];
+
+	putStr (_crcOk ? PSTR(PRINT_CCPACKET_CRC_OK) : PSTR(PRINT_CCPACKET_CRC_NOK));
+	*p++ = PRINT_CCPACKET_SEPARATOR [0];
+
+	putStr (PSTR(PRINT_CCPACKET_SIGNAL_STRENGTH));
+	putHex (_rssi);
+	*p++ = PRINT_CCPACKET_SEPARATOR [0];
+
+	putStr (PSTR(PRINT_CCPACKET_SIGNAL_QUALITY));
+	putHex (_lqi);
+
+	return p - buffer;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+size_t ccPacketPrinter :: printTo (Print & p) const {
+
+	char text [CCPACKET_TEXT_MAX_LEN];
+
+	size_t len = format (text, sizeof (text));
+	if (len == 0) {
+		Logln(F("WARNING !!! => No signal or Packet buffer is too small!!"));
+		return 0;
+	}
+
+	return p.write ((const uint8_t *) text, len);
+}
+
+}
@@ -0,0 +1,216 @@
+//************************************************************************************************************************
+// ccBasicPacket.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include <string.h>
+#include <type_traits>
+
+#include "ccPacket.h"
+
+
+// The constexpr functions of the library (flash packet views, X2D frames encoder) use loops and local variables
+static_assert (__cplusplus >= 201402L, "C++14 required: ESP8266 Arduino core 3.0 or later (gnu++17)");
+
+
+namespace cc1101 {
+
+template <size_t N> struct BasicPacket;
+
+
+/**
+ * Class: ccPacketView
+ *
+ * Description:
+ * Read-only span over the payload of any packet (CCPACKET, BasicPacket<N>, byte array in RAM or in flash): what the
+ * driver needs to transmit, without copy. The bytes of a flash view (PROGMEM) must be read with operator[] or copyTo,
+ * never through data.
+ */
+class ccPacketView
+{
+public:
+
+	const uint8_t *	data				= nullptr;
+	uint8_t			length				= 0;
+	uint8_t			address				= 0;
+	bool			isProgmem			= false;					// data points to flash
+
+public:
+
+	constexpr ccPacketView				() {}
+	constexpr ccPacketView				(const uint8_t * d, uint8_t len, uint8_t addr = 0) : data (d), length (len), address (addr) {}
+
+	template <size_t N>
+	constexpr ccPacketView				(const uint8_t (&d) [N], uint8_t addr = 0) : data (d), length (N), address (addr) {}
+
+	template <size_t N>
+	constexpr ccPacketView				(const BasicPacket <N> & packet) : data (packet.data), length (packet.length), address (packet.address) {}
+
+	ccPacketView						(const CCPACKET & packet) : data (packet.data), length (packet.length), address (packet.address) {}
+
+	static constexpr ccPacketView fromProgmem (const uint8_t * d, uint8_t len, uint8_t addr = 0)
+	{
+		ccPacketView view (d, len, addr);
+		view.isProgmem = true;
+		return view;
+	}
+
+	template <size_t N>
+	static constexpr ccPacketView fromProgmem (const uint8_t (&d) [N], uint8_t addr = 0)	{ return fromProgmem (d, N, addr); }
+
+	constexpr const uint8_t * begin		() const				{ return data;				}
+	constexpr const uint8_t * end		() const				{ return data + length;		}
+	constexpr uint8_t size				() const				{ return length;			}
+	constexpr bool empty				() const				{ return length == 0;		}
+
+	uint8_t operator[]					(uint8_t i) const		{ return isProgmem ? pgm_read_byte (data + i) : data [i];	}
+
+	void copyTo							(uint8_t * dest, uint8_t index, uint8_t len) const
+	{
+		if (isProgmem)	memcpy_P	(dest, data + index, len);
+		else			memmove		(dest, data + index, len);
+	}
+};
+
+
+/**
+ * Class: ccRxPacketView
+ *
+ * Description:
+ * Read-only view on the last packet received by the driver, without copy. The driver buffer is reused by the next
+ * reception: the view records the buffer generation and becomes invalid (empty) as soon as the packet is replaced or
+ * released, so a stale view can't be read by mistake.
+ */
+class ccRxPacketView
+{
+private:
+
+	const CCPACKET *			_packet			= nullptr;
+	const volatile uint16_t *	_generation		= nullptr;
+	uint16_t					_expected		= 0;
+
+public:
+
+	ccRxPacketView						() {}
+	ccRxPacketView						(const CCPACKET & packet, const volatile uint16_t & generation)
+		: _packet (&packet), _generation (&generation), _expected (generation) {}
+
+	bool isValid						() const				{ return (_packet != nullptr) && (_packet->length > 0) && (*_generation == _expected);	}
+
+	const CCPACKET * get				() const				{ return isValid () ? _packet : nullptr;					}
+
+	// Snapshot of the packet, false if it was replaced or released (even during the copy => dest is undefined)
+	bool copyTo							(CCPACKET & dest) const
+	{
+		if (!isValid ()) return false;
+		dest = *_packet;
+		return isValid ();
+	}
+};
+
+
+/**
+ * Struct: BasicPacket
+ *
+ * Description:
+ * Packet with its capacity as a template parameter. Plain data (no vtable, no hidden header): the payload comes first
+ * so an array of packets keeps the payloads aligned, and the size is N + 6 bytes. Printed through ccPacketPrinter.
+ */
+template <size_t N>
+struct BasicPacket
+{
+	static_assert ((0 < N) && (N <= 0xFF), "The packet length must fit in a byte");
+
+	uint8_t		data [N];											// Data buffer
+	uint8_t		length;												// Data length
+	uint8_t		address;											// CC recipient device ID
+	bool		crc_ok;												// CRC OK flag
+	uint8_t		rssi;												// Received Strength Signal Indication
+	uint8_t		lqi;												// Link Quality Index
+	uint8_t		channel;											// Channel number (CHANNR) the packet was received on
+
+	static constexpr uint8_t capacity	()						{ return N; }
+
+	void reset							()						{ memset (this, 0, sizeof (*this)); }
+	ccPacketView view					() const				{ return ccPacketView (*this); }
+
+	bool assign							(const ccPacketView & other)
+	{
+		if (other.length > N) return false;
+		other.copyTo (data, 0, other.length);
+		length	= other.length;
+		address	= other.address;
+		return true;
+	}
+
+	bool assign							(const CCPACKET & other)
+	{
+		if (!assign (ccPacketView (other))) return false;
+		crc_ok	= other.crc_ok;
+		rssi	= other.rssi;
+		lqi		= other.lqi;
+		channel	= other.channel;
+		return true;
+	}
+
+	void toCCPacket						(CCPACKET & packet) const
+	{
+		packet.length	= length;
+		packet.address	= address;
+		packet.crc_ok	= crc_ok;
+		packet.rssi		= rssi;
+		packet.lqi		= lqi;
+		packet.channel	= channel;
+		memcpy (packet.data, data, length);
+	}
+};
+
+
+/**
+ * Packet sizes
+ */
+typedef BasicPacket <CCPACKET_RXTXFIFO_DATA_LEN>	FifoPacket;		// Fits in the FIFO, no refill while sending
+typedef BasicPacket <CCPACKET_DATA_LEN>				LargePacket;	// Same capacity as CCPACKET
+
+static_assert (std::is_trivial <FifoPacket>::value && std::is_standard_layout <FifoPacket>::value, "BasicPacket must stay plain data");
+
+
+#define CCPACKET_TEXT_MAX_LEN			(6 + 5 + 3 * CCPACKET_DATA_LEN + 2 + 4 + 5 + 4)	// Formatted CCPACKET_DATA_LEN bytes packet
+
+
+/**
+ * Class: ccPacketPrinter
+ *
+ * Description:
+ * Printable adaptor of a packet, in the CCPACKET text format: L-$len A-$addr [$data] (N)OK S-$rssi Q-$lqi
+ * The text is formatted in a single pass with a hex table, its exact size is known without formatting.
+ */
+class ccPacketPrinter : public Printable
+{
+private:
+
+	ccPacketView	_view;
+	bool			_crcOk			= false;
+	uint8_t			_rssi			= 0;
+	uint8_t			_lqi			= 0;
+
+public:
+
+	ccPacketPrinter						(const ccPacketView & view) : _view (view) {}
+	ccPacketPrinter						(const CCPACKET & packet)
+		: _view (packet), _crcOk (packet.crc_ok), _rssi (packet.rssi), _lqi (packet.lqi) {}
+
+	template <size_t N>
+	ccPacketPrinter						(const BasicPacket <N> & packet)
+		: _view (packet), _crcOk (packet.crc_ok), _rssi (packet.rssi), _lqi (packet.lqi) {}
+
+	size_t formattedSize				() const;
+	size_t format						(char * buffer, size_t size) const;
+
+	virtual size_t printTo				(Print & p) const override;
+};
+
+}
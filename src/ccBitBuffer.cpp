@@ -0,0 +1,114 @@
+//************************************************************************************************************************
+// ccBitBuffer.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include "ccBitBuffer.h"
+
+
+namespace cc1101 {
+
+//========================================================================================================================
+// Each byte is erased by its first bit => no need to erase the rows
+//========================================================================================================================
+void ccBitBuffer :: clear ()
+{
+	_nbRows			= 0;
+	_isTruncated	= false;
+	_bitsPerRow [0]		= 0;
+	_syncsBeforeRow [0]	= 0;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccBitBuffer :: addBit (bool bit)
+{
+	if (_nbRows == 0) _nbRows = 1;
+
+	uint8_t row		= _nbRows - 1;
+	uint16_t nbBits	= _bitsPerRow [row];
+
+	if (nbBits >= CCBITS_ROW_BYTES * 8) {
+		_isTruncated = true;
+		return;
+	}
+
+	if ((nbBits & 7) == 0) {
+		_rows [row][nbBits >> 3] = bit ? 0x80 : 0x00;				// New byte: erases the bits of a previous message
+	}
+	else if (bit) {
+		_rows [row][nbBits >> 3] |= 0x80 >> (nbBits & 7);
+	}
+
+	_bitsPerRow [row] = nbBits + 1;
+}
+
+//========================================================================================================================
+// Start a new row (the last row is overwritten when the buffer is full)
+//========================================================================================================================
+void ccBitBuffer :: addRow ()
+{
+	if (_nbRows == 0) _nbRows = 1;
+
+	if (_nbRows < CCBITS_MAX_ROWS) {
+		_nbRows++;
+	}
+	else {
+		_isTruncated = true;
+	}
+
+	_bitsPerRow [_nbRows - 1]		= 0;
+	_syncsBeforeRow [_nbRows - 1]	= 0;
+}
+
+//========================================================================================================================
+// Sync delimiter: starts a new row if the current one is not empty
+//========================================================================================================================
+void ccBitBuffer :: addSync ()
+{
+	if (_nbRows == 0) _nbRows = 1;
+	if (_bitsPerRow [_nbRows - 1] > 0) addRow ();
+
+	_syncsBeforeRow [_nbRows - 1]++;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+uint32_t ccBitBuffer :: getTotalBits () const
+{
+	uint32_t n = 0;
+	for (uint8_t i = 0; i < _nbRows; i++) {
+		n += _bitsPerRow [i];
+	}
+	return n;
+}
+
+//========================================================================================================================
+// One "[row] {bits} hex" line per row
+//========================================================================================================================
+size_t ccBitBuffer :: printTo (Print & p) const
+{
+	static const char hex [] = "0123456789abcdef";
+
+	size_t n = 0;
+	for (uint8_t i = 0; i < _nbRows; i++) {
+		n += p.print ('[');
+		if (i < 10) n += p.print ('0');
+		n += p.print ((int) i);
+		n += p.print (F("] {"));
+		n += p.print ((int) _bitsPerRow [i]);
+		n += p.print ('}');
+		for (uint16_t j = 0; j < (_bitsPerRow [i] + 7) / 8; j++) {
+			n += p.print (' ');
+			n += p.print (hex [_rows [i][j] >> 4]);
+			n += p.print (hex [_rows [i][j] & 0x0F]);
+		}
+		n += p.print ('\n');
+	}
+	return n;
+}
+
+}
@@ -0,0 +1,58 @@
+//************************************************************************************************************************
+// ccBitBuffer.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include <stdio.h>
+#if defined (ESP8266) || defined (ESP32)
+#	include <Arduino.h>
+#endif
+
+
+namespace cc1101 {
+
+#define CCBITS_MAX_ROWS					8
+#define CCBITS_ROW_BYTES				32							// 256 bits per row
+
+
+/**
+ * Class: ccBitBuffer
+ *
+ * Description:
+ * Preallocated rows of demodulated bits (same layout as the rtl_433 bitbuffer: MSB first, one row per repetition or
+ * per sync delimiter). Printed as "{bits} hex" lines like rtl_433.
+ */
+class ccBitBuffer : public Printable
+{
+private:
+
+	uint8_t		_rows				[CCBITS_MAX_ROWS][CCBITS_ROW_BYTES];
+	uint16_t	_bitsPerRow			[CCBITS_MAX_ROWS];
+	uint8_t		_syncsBeforeRow		[CCBITS_MAX_ROWS];
+	uint8_t		_nbRows				= 0;
+	bool		_isTruncated		= false;						// Bits lost because a row or the buffer was full
+
+public:
+
+	ccBitBuffer							()							{ clear (); }
+
+	void clear							();
+	void addBit							(bool bit);
+	void addRow							();
+	void addSync						();
+
+	uint8_t getNbRows					() const					{ return _nbRows;				}
+	uint16_t getNbBits					(uint8_t row) const			{ return _bitsPerRow [row];		}
+	uint8_t getSyncsBeforeRow			(uint8_t row) const			{ return _syncsBeforeRow [row];	}
+	const uint8_t * getRow				(uint8_t row) const			{ return _rows [row];			}
+	bool getBit							(uint8_t row, uint16_t i) const	{ return (_rows [row][i >> 3] >> (7 - (i & 7))) & 1; }
+	uint32_t getTotalBits				() const;
+	bool isTruncated					() const					{ return _isTruncated;			}
+
+	virtual size_t printTo				(Print & p) const override;
+};
+
+}
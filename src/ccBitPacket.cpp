@@ -0,0 +1,412 @@
+//************************************************************************************************************************
+// ccBitPacket.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <Common.h>
+
+#include "ccBitPacket.h"
+
+using namespace corex;
+
+
+namespace cc1101 {
+
+// Manchester (1 => 10, 0 => 01) of a nibble
+static const uint8_t MANCHESTER_ENCODE [16] PROGMEM = {
+	0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA
+};
+
+// Manchester decoding of 4 symbols (one encoded byte): number of valid leading symbols in the high nibble (decoding
+// stops at the first 00 or 11 symbol), their bits right aligned in the low nibble
+static const uint8_t MANCHESTER_DECODE [256] PROGMEM = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x20, 0x20, 0x20, 0x20, 0x30, 0x40, 0x41, 0x30, 0x31, 0x42, 0x43, 0x31, 0x20, 0x20, 0x20, 0x20,
+	0x21, 0x21, 0x21, 0x21, 0x32, 0x44, 0x45, 0x32, 0x33, 0x46, 0x47, 0x33, 0x21, 0x21, 0x21, 0x21,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+	0x22, 0x22, 0x22, 0x22, 0x34, 0x48, 0x49, 0x34, 0x35, 0x4A, 0x4B, 0x35, 0x22, 0x22, 0x22, 0x22,
+	0x23, 0x23, 0x23, 0x23, 0x36, 0x4C, 0x4D, 0x36, 0x37, 0x4E, 0x4F, 0x37, 0x23, 0x23, 0x23, 0x23,
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccBitPacket :: clear ()
+{
+	memset (_data, 0, getNbBytes ());
+	_nbBits = 0;
+}
+
+//========================================================================================================================
+// Unused bits of the last byte set to 0
+//========================================================================================================================
+void ccBitPacket :: clearTail ()
+{
+	if (_nbBits & 7) {
+		_data [_nbBits >> 3] &= 0xFF << (8 - (_nbBits & 7));
+	}
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool ccBitPacket :: appendBit (bool bit)
+{
+	if (_nbBits >= CCBITPACKET_MAX_BITS) return false;
+
+	if ((_nbBits & 7) == 0) _data [_nbBits >> 3] = 0;
+	if (bit) _data [_nbBits >> 3] |= 0x80 >> (_nbBits & 7);
+
+	_nbBits++;
+	return true;
+}
+
+//========================================================================================================================
+// The bits are merged by bytes in the partial last byte then in the following ones
+//========================================================================================================================
+bool ccBitPacket :: appendBits (uint32_t value, uint8_t nbBits)
+{
+	if ((nbBits > 32) || (_nbBits + nbBits > CCBITPACKET_MAX_BITS)) return false;
+
+	while (nbBits > 0) {
+
+		uint8_t offset	= _nbBits & 7;
+		uint8_t room	= 8 - offset;
+		uint8_t n		= (nbBits < room) ? nbBits : room;
+		uint8_t bits	= (value >> (nbBits - n)) & ((1 << n) - 1);
+
+		if (offset == 0) _data [_nbBits >> 3] = 0;
+		_data [_nbBits >> 3] |= bits << (room - n);
+
+		_nbBits	+= n;
+		nbBits	-= n;
+	}
+	return true;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool ccBitPacket :: appendBits (const uint8_t * data, uint16_t nbBits)
+{
+	if (_nbBits + nbBits > CCBITPACKET_MAX_BITS) return false;
+
+	if ((_nbBits & 7) == 0) {
+		// Aligned: bytes copy
+		memcpy (_data + (_nbBits >> 3), data, (nbBits + 7) >> 3);
+		_nbBits += nbBits;
+		clearTail ();
+		return true;
+	}
+
+	uint16_t i = 0;
+	for (; i + 8 <= nbBits; i += 8) {
+		appendBits (data [i >> 3], 8);
+	}
+	if (i < nbBits) {
+		appendBits (data [i >> 3] >> (8 - (nbBits - i)), nbBits - i);
+	}
+	return true;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+uint32_t ccBitPacket :: extractBits (uint16_t start, uint8_t nbBits) const
+{
+	uint32_t value = 0;
+
+	for (uint8_t n = 0; n < nbBits; ) {
+
+		uint16_t pos = start + n;
+		if (pos >= _nbBits) {
+			value = ((nbBits - n) < 32) ? value << (nbBits - n) : 0;
+			break;
+		}
+
+		uint8_t offset	= pos & 7;
+		uint8_t avail	= 8 - offset;
+		uint8_t take	= ((uint8_t) (nbBits - n) < avail) ? (nbBits - n) : avail;
+
+		value = (value << take) | ((_data [pos >> 3] >> (avail - take)) & ((1 << take) - 1));
+		n += take;
+	}
+	return value;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccBitPacket :: shiftLeft (uint16_t n)
+{
+	if (n >= _nbBits) {
+		clear ();
+		return;
+	}
+
+	uint16_t bytes		= n >> 3;
+	uint8_t bits		= n & 7;
+	uint16_t newNbBits	= _nbBits - n;
+	uint16_t nbBytes	= getNbBytes ();
+
+	for (uint16_t i = 0; i < (newNbBits + 7) >> 3; i++) {
+		uint8_t hi = _data [i + bytes];
+		uint8_t lo = (i + bytes + 1 < nbBytes) ? _data [i + bytes + 1] : 0;
+		_data [i] = bits ? (hi << bits) | (lo >> (8 - bits)) : hi;
+	}
+
+	_nbBits = newNbBits;
+	clearTail ();
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool ccBitPacket :: shiftRight (uint16_t n)
+{
+	if (_nbBits + n > CCBITPACKET_MAX_BITS) return false;
+
+	uint16_t bytes		= n >> 3;
+	uint8_t bits		= n & 7;
+	uint16_t nbBytes	= getNbBytes ();
+
+	_nbBits += n;
+
+	for (int16_t i = getNbBytes () - 1; i >= 0; i--) {
+		int16_t src = i - bytes;
+		uint8_t hi = ((src >= 0) && (src < nbBytes)) ? _data [src] : 0;
+		uint8_t lo = ((src >= 1) && (src - 1 < nbBytes)) ? _data [src - 1] : 0;
+		_data [i] = bits ? (hi >> bits) | (lo << (8 - bits)) : hi;
+	}
+
+	clearTail ();
+	return true;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccBitPacket :: truncate (uint16_t nbBits)
+{
+	if (nbBits >= _nbBits) return;
+
+	_nbBits = nbBits;
+	clearTail ();
+}
+
+//========================================================================================================================
+// 32 bits words then the remaining bytes
+//========================================================================================================================
+void ccBitPacket :: invert ()
+{
+	uint16_t nbBytes	= getNbBytes ();
+	uint16_t i			= 0;
+
+	for (; i + 4 <= nbBytes; i += 4) {
+		uint32_t word;
+		memcpy (&word, _data + i, 4);
+		word = ~word;
+		memcpy (_data + i, &word, 4);
+	}
+	for (; i < nbBytes; i++) {
+		_data [i] = ~_data [i];
+	}
+
+	clearTail ();
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccBitPacket :: xorWith (const ccBitPacket & other)
+{
+	uint16_t nbBytes	= ((_nbBits < other._nbBits) ? _nbBits : other._nbBits) >> 3;
+	uint16_t i			= 0;
+
+	for (; i + 4 <= nbBytes; i += 4) {
+		uint32_t word, otherWord;
+		memcpy (&word, _data + i, 4);
+		memcpy (&otherWord, other._data + i, 4);
+		word ^= otherWord;
+		memcpy (_data + i, &word, 4);
+	}
+	for (; i < nbBytes; i++) {
+		_data [i] ^= other._data [i];
+	}
+
+	// Bits of the last common byte
+	uint16_t common = (_nbBits < other._nbBits) ? _nbBits : other._nbBits;
+	if (common & 7) {
+		_data [i] ^= other._data [i] & (0xFF << (8 - (common & 7)));
+	}
+}
+
+//========================================================================================================================
+// One lookup per nibble
+//========================================================================================================================
+bool ccBitPacket :: manchesterEncode (ccBitPacket & out) const
+{
+	if (2 * _nbBits > CCBITPACKET_MAX_BITS) return false;
+
+	out.clear ();
+
+	uint16_t nbFullBytes = _nbBits >> 3;
+	for (uint16_t i = 0; i < nbFullBytes; i++) {
+		out._data [2 * i]		= pgm_read_byte (&MANCHESTER_ENCODE [_data [i] >> 4]);
+		out._data [2 * i + 1]	= pgm_read_byte (&MANCHESTER_ENCODE [_data [i] & 0x0F]);
+	}
+	out._nbBits = nbFullBytes * 16;
+
+	for (uint16_t i = nbFullBytes * 8; i < _nbBits; i++) {
+		out.appendBits (getBit (i) ? 0x02 : 0x01, 2);
+	}
+	return true;
+}
+
+//========================================================================================================================
+// One lookup per encoded byte (4 symbols)
+//========================================================================================================================
+uint16_t ccBitPacket :: manchesterDecode (ccBitPacket & out) const
+{
+	out.clear ();
+
+	uint16_t nbSymbols = _nbBits >> 1;
+
+	for (uint16_t s = 0; s < nbSymbols; s += 4) {
+
+		uint8_t nbInByte	= ((nbSymbols - s) < 4) ? (nbSymbols - s) : 4;
+		uint8_t decoded		= pgm_read_byte (&MANCHESTER_DECODE [_data [s >> 2]]);
+		uint8_t nbDecoded	= decoded >> 4;
+		uint8_t nbValid		= (nbDecoded < nbInByte) ? nbDecoded : nbInByte;
+
+		out.appendBits ((decoded & 0x0F) >> (nbDecoded - nbValid), nbValid);
+
+		if (nbValid < nbInByte) break;						// Invalid symbol
+	}
+	return out._nbBits;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool ccBitPacket :: fromBytes (const uint8_t * data, uint16_t nbBits)
+{
+	clear ();
+	return appendBits (data, nbBits);
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool ccBitPacket :: fromCCPacket (const CCPACKET & packet, uint16_t nbBits /*= 0*/)
+{
+	if ((nbBits == 0) || (nbBits > packet.length * 8)) nbBits = packet.length * 8;
+	return fromBytes (packet.data, nbBits);
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool ccBitPacket :: fromBitBuffer (const ccBitBuffer & bits, uint8_t row)
+{
+	if (row >= bits.getNbRows ()) return false;
+	return fromBytes (bits.getRow (row), bits.getNbBits (row));
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccBitPacket :: toCCPacket (CCPACKET & packet) const
+{
+	packet.length = getNbBytes ();
+	memcpy (packet.data, _data, packet.length);
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool ccBitPacket :: operator== (const ccBitPacket & other) const
+{
+	return (_nbBits == other._nbBits) && (memcmp (_data, other._data, getNbBytes ()) == 0);
+}
+
+//========================================================================================================================
+// rtl_433 notation: "{N} hh hh .."
+//========================================================================================================================
+size_t ccBitPacket :: printTo (Print & p) const
+{
+	static const char hex [] = "0123456789abcdef";
+
+	size_t n = 0;
+	n += p.print ('{');
+	n += p.print ((unsigned) _nbBits);
+	n += p.print ('}');
+	for (uint16_t i = 0; i < getNbBytes (); i++) {
+		n += p.print (' ');
+		n += p.print (hex [_data [i] >> 4]);
+		n += p.print (hex [_data [i] & 0x0F]);
+	}
+	return n;
+}
+
+//========================================================================================================================
+// "{N}" then hex digits (spaces allowed), the digits beyond N bits are ignored. Unchanged if str is invalid
+//========================================================================================================================
+bool ccBitPacket :: parse (const char * str, Print & out)
+{
+	while (*str == ' ') str++;
+
+	if (*str++ != '{') {
+		out << F("Malformatted bits length begin! ABORTED!!") << LN;
+		return false;
+	}
+
+	uint32_t nbBits = 0;
+	while (isdigit (*str)) {
+		nbBits = nbBits * 10 + (*str++ - '0');
+		if (nbBits > CCBITPACKET_MAX_BITS) {
+			out << F("Bits length error! ABORTED!!") << LN;
+			return false;
+		}
+	}
+
+	if (*str++ != '}') {
+		out << F("Malformatted bits length end! ABORTED!!") << LN;
+		return false;
+	}
+
+	ccBitPacket bits;
+
+	while ((bits._nbBits < nbBits) && *str) {
+		char c = *str++;
+		if (c == ' ') continue;
+		if (!isxdigit (c)) {
+			out << F("Malformatted hex digit! ABORTED!!") << LN;
+			return false;
+		}
+		uint8_t nibble = isdigit (c) ? c - '0' : (tolower (c) - 'a' + 10);
+		uint8_t n = (nbBits - bits._nbBits < 4) ? nbBits - bits._nbBits : 4;
+		bits.appendBits (nibble >> (4 - n), n);
+	}
+
+	if (bits._nbBits < nbBits) {
+		out << F("Missing hex digits! ABORTED!!") << LN;
+		return false;
+	}
+
+	*this = bits;
+	return true;
+}
+
+}
@@ -0,0 +1,74 @@
+//************************************************************************************************************************
+// ccBitPacket.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include "ccPacket.h"
+#include "ccBitBuffer.h"
+
+
+namespace cc1101 {
+
+#define CCBITPACKET_MAX_BYTES			CCPACKET_DATA_LEN
+#define CCBITPACKET_MAX_BITS			(CCBITPACKET_MAX_BYTES * 8)
+
+
+/**
+ * Class: ccBitPacket
+ *
+ * Description:
+ * Bitstream packet for the frames that are not byte aligned ({122} bits X2D frames..). The bits are stored MSB first,
+ * the unused bits of the last byte are always 0 so that the frame can be handed to the packet engine as a CCPACKET.
+ * Manchester uses the G.E. Thomas convention of the X2D frames (1 => 10, 0 => 01), invert () gives the IEEE one.
+ * Printed and parsed in the rtl_433 "{N} hex" notation.
+ */
+class ccBitPacket : public Printable
+{
+private:
+
+	alignas (4) uint8_t		_data [CCBITPACKET_MAX_BYTES]	= {0};
+	uint16_t				_nbBits							= 0;
+
+private:
+
+	void clearTail						();
+
+public:
+
+	void clear							();
+
+	uint16_t getNbBits					() const					{ return _nbBits;					}
+	uint16_t getNbBytes					() const					{ return (_nbBits + 7) >> 3;		}
+	const uint8_t * getData				() const					{ return _data;						}
+	bool getBit							(uint16_t i) const			{ return (_data [i >> 3] >> (7 - (i & 7))) & 1; }
+
+	bool appendBit						(bool bit);
+	bool appendBits						(uint32_t value, uint8_t nbBits);			// MSB first, 32 bits max
+	bool appendBits						(const uint8_t * data, uint16_t nbBits);
+	bool append							(const ccBitPacket & other)	{ return appendBits (other._data, other._nbBits); }
+	uint32_t extractBits				(uint16_t start, uint8_t nbBits) const;	// 32 bits max, 0 beyond the end
+
+	void shiftLeft						(uint16_t n);								// Drop the first n bits
+	bool shiftRight						(uint16_t n);								// Insert n 0 bits at the beginning
+	void truncate						(uint16_t nbBits);
+	void invert							();
+	void xorWith						(const ccBitPacket & other);				// On the common length
+
+	bool manchesterEncode				(ccBitPacket & out) const;
+	uint16_t manchesterDecode			(ccBitPacket & out) const;					// Decoded bits until an invalid symbol
+
+	bool fromBytes						(const uint8_t * data, uint16_t nbBits);
+	bool fromCCPacket					(const CCPACKET & packet, uint16_t nbBits = 0);	// 0 => all the bytes
+	bool fromBitBuffer					(const ccBitBuffer & bits, uint8_t row);
+	void toCCPacket						(CCPACKET & packet) const;					// Last byte padded with 0
+
+	bool operator==						(const ccBitPacket & other) const;
+
+	virtual size_t printTo				(Print & p) const override;
+	bool parse							(const char * str, Print & out);			// "{N} hex" or "{N}hex"
+};
+
+}
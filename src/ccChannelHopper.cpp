@@ -0,0 +1,190 @@
+//************************************************************************************************************************
+// ccChannelHopper.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <Common.h>
+
+#include "ccChannelHopper.h"
+
+using namespace corex;
+
+
+namespace cc1101 {
+
+//========================================================================================================================
+//
+//========================================================================================================================
+ccChannelHopper :: ccChannelHopper (CC1101Transceiver & transceiver)
+	: _transceiver (transceiver)
+{
+	_transceiver.notifyPacketReceived += [this] (const CCPACKET & packet, uint8_t /* repeats: the copies of a burst are already filtered */) {
+		onPacketReceived (packet);
+	};
+}
+
+//========================================================================================================================
+// Shortest dwell to catch a preamble and a sync word at the current data rate (twice the settling + detection time)
+//========================================================================================================================
+uint16_t ccChannelHopper :: getMinDwellMs () const
+{
+	uint32_t baud = _transceiver.getDataRateBaud ();
+	if (baud == 0) return 1;
+
+	uint32_t detectUs = CC1101_SETTLE_US + (CC1101_SYNC_DETECT_BITS * 1000000UL) / baud;
+	return (2 * detectUs + 999) / 1000;
+}
+
+//========================================================================================================================
+// Add a channel to the hopping sequence (dwellMs = 0 => minimal dwell), calibrates it
+//========================================================================================================================
+bool ccChannelHopper :: addChannel (uint8_t channel, uint16_t dwellMs /*= 0*/)
+{
+	if (_isHopping || (_nbChannels >= CCHOPPER_MAX_CHANNELS)) return false;
+
+	HOP_CHANNEL & hopChannel = _channels [_nbChannels++];
+
+	hopChannel				= HOP_CHANNEL ();
+	hopChannel.channel		= channel;
+	hopChannel.dwellMs		= (dwellMs > 0) ? dwellMs : getMinDwellMs ();
+
+	_transceiver.stopReceivePacket ();
+	bool isCalibrated = _transceiver.calibrateChannel (channel, hopChannel.fscal);
+	_transceiver.setChannel (_transceiver.getChannel ());	// Back to the working channel
+	_transceiver.startReceivePacket (0);
+
+	if (!isCalibrated) {
+		_nbChannels--;
+		return false;
+	}
+
+	Logln (F("Hopping channel ") << channel << F(" dwell ") << hopChannel.dwellMs << F("ms"));
+
+	return true;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool ccChannelHopper :: setDwell (uint8_t channel, uint16_t dwellMs)
+{
+	for (uint8_t i = 0; i < _nbChannels; i++) {
+		if (_channels [i].channel == channel) {
+			_channels [i].dwellMs = (dwellMs > 0) ? dwellMs : 1;
+			return true;
+		}
+	}
+	return false;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccChannelHopper :: clear ()
+{
+	stop ();
+	_nbChannels = 0;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccChannelHopper :: start ()
+{
+	if (_isHopping || (_nbChannels == 0)) return;
+
+	_transceiver.stopReceivePacket ();
+
+	_mcsm0		= _transceiver.setManualCalibration ();
+	_current	= 0;
+	_isHopping	= true;
+
+	_channels [_current].nbDwells++;
+	_transceiver.retuneChannel (_channels [_current].channel, _channels [_current].fscal);
+	_transceiver.startReceivePacket (0);
+
+	_dwellStartMs = millis ();
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccChannelHopper :: stop ()
+{
+	if (!_isHopping) return;
+
+	_isHopping = false;
+
+	_transceiver.stopReceivePacket ();
+	_transceiver.writeRegFast (CC1101_MCSM0, _mcsm0);
+	_transceiver.startReceivePacket (0);					// Calibrates again on the current channel
+}
+
+//========================================================================================================================
+// To be called from the application loop
+//========================================================================================================================
+void ccChannelHopper :: loop ()
+{
+	if (!_isHopping) return;
+
+	uint32_t nowMs = millis ();
+	if (nowMs - _dwellStartMs < _channels [_current].dwellMs) return;
+
+	_dwellStartMs = nowMs;
+	hop ();
+}
+
+//========================================================================================================================
+// Dwell timeout: go to the next channel unless something is being received (no log here, time critical)
+//========================================================================================================================
+void ccChannelHopper :: hop ()
+{
+	// Sending, packet being read or receiver not restarted yet: leave the radio alone
+	uint8_t marcState	= _transceiver.readStatusRegFast (CC1101_MARCSTATE) & CC1101_BITS_MARCSTATE;
+	if (marcState != CC_MARCSTATE_RX) return;
+
+	uint8_t pktStatus	= _transceiver.readStatusRegFast (CC1101_PKTSTATUS);
+	uint8_t rxBytes		= _transceiver.readStatusRegFast (CC1101_RXBYTES) & CC1101_BYTES_IN_FIFO;
+
+	if ((pktStatus & CCHOPPER_CARRIER_MASK) || (rxBytes > 0)) {
+		// Carrier, preamble or sync word detected or packet not read yet => extend the dwell
+		_channels [_current].nbExtends++;
+	}
+	else {
+		_current = (_current + 1) % _nbChannels;
+		_channels [_current].nbDwells++;
+		_transceiver.retuneChannel (_channels [_current].channel, _channels [_current].fscal);
+	}
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccChannelHopper :: onPacketReceived (const CCPACKET & packet)
+{
+	for (uint8_t i = 0; i < _nbChannels; i++) {
+		if (_channels [i].channel == packet.channel) {
+			_channels [i].nbPackets++;
+			return;
+		}
+	}
+}
+
+//========================================================================================================================
+// One "channel dwellMs dwells extends packets" line per channel
+//========================================================================================================================
+size_t ccChannelHopper :: printTo (Print & p) const
+{
+	size_t n = 0;
+	for (uint8_t i = 0; i < _nbChannels; i++) {
+		n += p.print ((int) _channels [i].channel);		n += p.print (' ');
+		n += p.print ((int) _channels [i].dwellMs);		n += p.print (' ');
+		n += p.print (_channels [i].nbDwells);			n += p.print (' ');
+		n += p.print (_channels [i].nbExtends);			n += p.print (' ');
+		n += p.print (_channels [i].nbPackets);			n += p.print ('\n');
+	}
+	return n;
+}
+
+}
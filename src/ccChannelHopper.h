@@ -0,0 +1,81 @@
+//************************************************************************************************************************
+// ccChannelHopper.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include "cc1101Transceiver.h"
+
+
+namespace cc1101 {
+
+#define CCHOPPER_MAX_CHANNELS			8
+#define CCHOPPER_CARRIER_MASK			0x68						// PKTSTATUS: CS | PQT_REACHED | SFD
+
+
+/**
+ * Channel of the hopping sequence and its catch rate
+ */
+struct HOP_CHANNEL
+{
+	uint8_t		channel						= 0;
+	uint16_t	dwellMs						= 0;
+	uint8_t		fscal [CC1101_FSCAL_LEN]	= {0};					// Cached calibration
+	uint32_t	nbDwells					= 0;					// Number of times the receiver listened on this channel
+	uint32_t	nbExtends					= 0;					// Dwells extended by carrier sense / preamble / sync
+	uint32_t	nbPackets					= 0;					// Packets received on this channel
+};
+
+
+/**
+ * Class: ccChannelHopper
+ *
+ * Description:
+ * Makes a transceiver cycle its receiver over a set of channels. Each channel is calibrated once so that a hop only
+ * writes CHANNR and the cached FSCAL registers; the dwell is extended while a carrier, a preamble or a sync word is
+ * detected or while a received packet has not been read yet. Received packets are tagged with their channel
+ * (CCPACKET::channel) and counted per channel to tune the dwell times.
+ * The hops are driven by loop () (no timer callback talking over the SPI bus behind a send or a packet read) and only
+ * happen while the radio is in RX: a send or a stopped / not yet restarted receiver suspends the hopping.
+ */
+class ccChannelHopper : public Printable
+{
+private:
+
+	CC1101Transceiver &	_transceiver;
+
+	HOP_CHANNEL			_channels [CCHOPPER_MAX_CHANNELS];
+	uint8_t				_nbChannels			= 0;
+	uint8_t				_current			= 0;
+	uint8_t				_mcsm0				= 0;				// Calibration mode to restore
+	bool				_isHopping			= false;
+	uint32_t			_dwellStartMs		= 0;
+
+private:
+
+	void hop							();
+	void onPacketReceived				(const CCPACKET & packet);
+
+public:
+
+	ccChannelHopper						(CC1101Transceiver & transceiver);
+
+	uint16_t getMinDwellMs				() const;
+	bool addChannel						(uint8_t channel, uint16_t dwellMs = 0);
+	bool setDwell						(uint8_t channel, uint16_t dwellMs);
+	void clear							();
+
+	void start							();
+	void stop							();
+	void loop							();							// Hops when the dwell is over
+	bool isHopping						() const			{ return _isHopping;		}
+
+	uint8_t size						() const			{ return _nbChannels;		}
+	const HOP_CHANNEL & operator[]		(uint8_t i) const	{ return _channels [i];		}
+
+	virtual size_t printTo				(Print & p) const override;
+};
+
+}
@@ -0,0 +1,158 @@
+//************************************************************************************************************************
+// ccDecoderRegistry.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include "ccDecoderRegistry.h"
+
+using namespace corex;
+
+
+namespace cc1101 {
+
+//========================================================================================================================
+// Evaluates the decoder predicates once for all the first byte and length values
+//========================================================================================================================
+bool ccDecoderRegistry :: add (ccProtocolDecoder * decoder)
+{
+	if ((decoder == nullptr) || (_nbDecoders >= CCREGISTRY_MAX_DECODERS)) return false;
+
+	uint8_t i		= _nbDecoders++;
+	uint8_t mask	= 1 << i;
+
+	_decoders [i]	= decoder;
+	_stats [i]		= DECODER_STATS ();
+
+	for (uint16_t b = 0; b < 256; b++) {
+		if (decoder->acceptsFirstByte (b)) _byFirstByte [b] |= mask;
+	}
+	for (uint8_t len = 1; len <= CCPACKET_DATA_LEN; len++) {
+		if (decoder->acceptsLength (len)) _byLength [len] |= mask;
+	}
+	if (decoder->acceptsBits ()) _bitsDecoders |= mask;
+
+	Logln (F("Decoder ") << decoder->getName () << F(" registered"));
+
+	return true;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccDecoderRegistry :: clear ()
+{
+	resetStats ();
+
+	_nbDecoders		= 0;
+	_bitsDecoders	= 0;
+	memset (_byFirstByte,	0, sizeof (_byFirstByte));
+	memset (_byLength,		0, sizeof (_byLength));
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccDecoderRegistry :: notify (uint8_t i, const ccDecodedEvent * event, uint32_t startUs)
+{
+	uint32_t elapsedUs = micros () - startUs;
+
+	DECODER_STATS & stats = _stats [i];
+	stats.nbCalls++;
+	stats.totalUs += elapsedUs;
+	if (elapsedUs > stats.maxUs) stats.maxUs = elapsedUs;
+
+	if (event != nullptr) {
+		stats.nbDecoded++;
+		notifyDecoded (*_decoders [i], *event);
+	}
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+uint8_t ccDecoderRegistry :: dispatch (const CCPACKET & packet)
+{
+	if ((packet.length == 0) || (packet.length > CCPACKET_DATA_LEN)) return 0;
+
+	uint8_t candidates	= _byFirstByte [packet.data [0]] & _byLength [packet.length];
+	uint8_t nbDecoded	= 0;
+
+	for (uint8_t i = 0; candidates != 0; i++, candidates >>= 1) {
+		if (candidates & 1) {
+			uint32_t startUs = micros ();							// The match is part of the decoder time
+			if (!_decoders [i]->matches (packet)) continue;
+			const ccDecodedEvent * event = _decoders [i]->decode (packet);
+			notify (i, event, startUs);
+			if (event != nullptr) nbDecoded++;
+		}
+	}
+	return nbDecoded;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+uint8_t ccDecoderRegistry :: dispatch (const ccBitBuffer & bits)
+{
+	uint8_t candidates	= _bitsDecoders;
+	uint8_t nbDecoded	= 0;
+
+	for (uint8_t i = 0; candidates != 0; i++, candidates >>= 1) {
+		if (candidates & 1) {
+			uint32_t startUs = micros ();
+			const ccDecodedEvent * event = _decoders [i]->decode (bits);
+			notify (i, event, startUs);
+			if (event != nullptr) nbDecoded++;
+		}
+	}
+	return nbDecoded;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccDecoderRegistry :: attach (CC1101Transceiver & transceiver)
+{
+	transceiver.notifyPacketReceived += [this] (const CCPACKET & packet, uint8_t /* repeats */) {
+		dispatch (packet);
+	};
+}
+
+//========================================================================================================================
+// The rows found by the flex decoders are dispatched to the bits decoders
+//========================================================================================================================
+void ccDecoderRegistry :: attach (ccFlexRegistry & flexRegistry)
+{
+	flexRegistry.notifyDecoded += [this] (const ccFlexDecoder &, const ccBitBuffer & bits) {
+		dispatch (bits);
+	};
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccDecoderRegistry :: resetStats ()
+{
+	for (uint8_t i = 0; i < _nbDecoders; i++) {
+		_stats [i] = DECODER_STATS ();
+	}
+}
+
+//========================================================================================================================
+// One "name calls decoded totalUs maxUs" line per decoder
+//========================================================================================================================
+size_t ccDecoderRegistry :: printTo (Print & p) const
+{
+	size_t n = 0;
+	for (uint8_t i = 0; i < _nbDecoders; i++) {
+		n += p.print (_decoders [i]->getName ());	n += p.print (' ');
+		n += p.print (_stats [i].nbCalls);			n += p.print (' ');
+		n += p.print (_stats [i].nbDecoded);		n += p.print (' ');
+		n += p.print (_stats [i].totalUs);			n += p.print (' ');
+		n += p.print (_stats [i].maxUs);			n += p.print ('\n');
+	}
+	return n;
+}
+
+}
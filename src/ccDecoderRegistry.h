@@ -0,0 +1,88 @@
+//************************************************************************************************************************
+// ccDecoderRegistry.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include <Common.h>
+
+#include "cc1101Transceiver.h"
+#include "ccFlexRegistry.h"
+#include "ccProtocolDecoder.h"
+
+
+namespace cc1101 {
+
+#define CCREGISTRY_MAX_DECODERS			8							// One bit per decoder in the index masks
+
+
+/**
+ * CPU time of one decoder
+ */
+struct DECODER_STATS
+{
+	uint32_t	nbCalls			= 0;
+	uint32_t	nbDecoded		= 0;
+	uint32_t	totalUs			= 0;
+	uint32_t	maxUs			= 0;
+};
+
+
+/**
+ * Class: ccDecoderRegistry
+ *
+ * Description:
+ * Dispatches the received packets and the demodulated pulse trains to the registered protocol decoders. The
+ * candidates of a packet are found with two precomputed masks indexed by its first byte and by its length, instead of
+ * asking every decoder. Each decoded event is notified to the subscribers, the CPU time of each decoder is measured.
+ */
+class ccDecoderRegistry : public Printable
+{
+private:
+
+	ccProtocolDecoder *		_decoders [CCREGISTRY_MAX_DECODERS];
+	DECODER_STATS			_stats [CCREGISTRY_MAX_DECODERS];
+	uint8_t					_nbDecoders							= 0;
+
+	uint8_t					_byFirstByte [256]					= {0};	// Mask of the candidate decoders
+	uint8_t					_byLength [CCPACKET_DATA_LEN + 1]	= {0};
+	uint8_t					_bitsDecoders						= 0;
+
+private:
+
+	void notify							(uint8_t i, const ccDecodedEvent * event, uint32_t startUs);
+
+public:
+
+	corex::Signal <const ccProtocolDecoder &, const ccDecodedEvent &>	notifyDecoded;
+
+	// Typed subscription: the callback only receives the events of the EVENT type
+	template <class EVENT>
+	void subscribe						(std::function <void (const EVENT &)> callback)
+	{
+		notifyDecoded += [callback] (const ccProtocolDecoder &, const ccDecodedEvent & event) {
+			if (event.type == EVENT::TYPE) callback (static_cast <const EVENT &> (event));
+		};
+	}
+
+public:
+
+	bool add							(ccProtocolDecoder * decoder);
+	void clear							();
+
+	uint8_t dispatch					(const CCPACKET & packet);		// Returns the number of decoders that decoded it
+	uint8_t dispatch					(const ccBitBuffer & bits);
+
+	void attach							(CC1101Transceiver & transceiver);
+	void attach							(ccFlexRegistry & flexRegistry);
+
+	uint8_t size						() const					{ return _nbDecoders;		}
+	const DECODER_STATS & getStats		(uint8_t i) const			{ return _stats [i];		}
+	void resetStats						();
+
+	virtual size_t printTo				(Print & p) const override;
+};
+
+}
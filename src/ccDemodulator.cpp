@@ -0,0 +1,193 @@
+//************************************************************************************************************************
+// ccDemodulator.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include "ccDemodulator.h"
+
+
+namespace cc1101 {
+
+//========================================================================================================================
+//
+//========================================================================================================================
+ccDemodulator :: ccDemodulator (const CCDEMOD_PARAMS & params)
+{
+	setParams (params);
+}
+
+//========================================================================================================================
+// Integer windows: |width - expected| < tolerance
+//========================================================================================================================
+void ccDemodulator :: setParams (const CCDEMOD_PARAMS & params)
+{
+	_params = params;
+
+	uint16_t tolerance = (_params.toleranceUs > 0) ? _params.toleranceUs : _params.longUs / 4;
+
+	auto lower = [tolerance] (uint16_t us) -> uint16_t { return (us > tolerance) ? us - tolerance : 0; };
+	auto upper = [tolerance] (uint16_t us) -> uint16_t { return ((uint32_t) us + tolerance > 0xFFFF) ? 0xFFFF : us + tolerance; };
+
+	_halfBitLimit	= ((uint32_t) _params.shortUs * 3) / 2;
+	_shortMin		= lower (_params.shortUs);
+	_shortMax		= upper (_params.shortUs);
+	_longMin		= lower (_params.longUs);
+	_longMax		= upper (_params.longUs);
+	_syncMin		= lower (_params.syncUs);
+	_syncMax		= upper (_params.syncUs);
+
+	reset ();
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccDemodulator :: reset ()
+{
+	_inMessage = false;
+	restart ();
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccDemodulator :: restart ()
+{
+	_bits.clear ();
+	_sinceLastBitUs	= 0;
+	_isComplete		= false;
+
+	if (_params.modulation == OOK_MC_ZEROBIT) {
+		_bits.addBit (0);											// The first rising edge is always a zero
+	}
+}
+
+//========================================================================================================================
+// Messages without data are dropped
+//========================================================================================================================
+bool ccDemodulator :: endOfMessage ()
+{
+	_inMessage = false;
+
+	uint32_t nbBits = _bits.getTotalBits ();
+	bool hasData = (_params.modulation == OOK_MC_ZEROBIT) ? (nbBits > 1) : ((nbBits > 0) || (_bits.getNbRows () > 1));
+
+	if (hasData) {
+		_isComplete = true;
+		return true;
+	}
+
+	restart ();
+	return false;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool ccDemodulator :: feed (uint16_t pulse)
+{
+	if (_isComplete) restart ();
+
+	bool level	= pulseLevel (pulse);
+	uint16_t us	= pulseWidth (pulse);
+
+	if (level) {
+		_inMessage = true;
+	}
+	else if (!_inMessage) {
+		return false;												// Silence before the first pulse
+	}
+
+	switch (_params.modulation) {
+		case OOK_MC_ZEROBIT	: return feedManchesterZeroBit (level, us);
+		case OOK_PWM		: return feedPwm (level, us);
+		case OOK_PPM		: return feedPpm (level, us);
+	}
+	return false;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool ccDemodulator :: flush ()
+{
+	if (_isComplete) restart ();
+	if (!_inMessage) return false;
+
+	return endOfMessage ();
+}
+
+//========================================================================================================================
+// rtl_433 pulse_slicer_manchester_zerobit: a data edge is an edge more than 1.5 short widths after the previous one,
+// a falling edge (end of pulse) is a 1, a rising edge (end of gap) is a 0
+//========================================================================================================================
+bool ccDemodulator :: feedManchesterZeroBit (bool level, uint16_t us)
+{
+	if (!level && (us > _params.resetUs)) {
+		return endOfMessage ();
+	}
+
+	uint32_t elapsed = (uint32_t) _sinceLastBitUs + us;
+
+	if (elapsed > _halfBitLimit) {
+		_bits.addBit (level);
+		_sinceLastBitUs = 0;
+	}
+	else {
+		_sinceLastBitUs = elapsed;
+	}
+	return false;
+}
+
+//========================================================================================================================
+// rtl_433 pulse_slicer_pwm: the pulse width gives the bit, a sync pulse or a long gap starts a new row
+//========================================================================================================================
+bool ccDemodulator :: feedPwm (bool level, uint16_t us)
+{
+	if (level) {
+		if ((_params.syncUs > 0) && (_syncMin < us) && (us < _syncMax)) {
+			_bits.addSync ();
+		}
+		else if ((_shortMin < us) && (us < _shortMax)) {
+			_bits.addBit (1);
+		}
+		else if ((_longMin < us) && (us < _longMax)) {
+			_bits.addBit (0);
+		}
+		// Else spurious pulse: ignored
+		return false;
+	}
+
+	if (us > _params.resetUs) {
+		return endOfMessage ();
+	}
+	if ((_params.gapUs > 0) && (us > _params.gapUs)) {
+		_bits.addRow ();
+	}
+	return false;
+}
+
+//========================================================================================================================
+// rtl_433 pulse_slicer_ppm: the gap width gives the bit, the pulses only delimit the gaps
+//========================================================================================================================
+bool ccDemodulator :: feedPpm (bool level, uint16_t us)
+{
+	if (level) return false;
+
+	if ((_shortMin < us) && (us < _shortMax)) {
+		_bits.addBit (0);
+	}
+	else if ((_longMin < us) && (us < _longMax)) {
+		_bits.addBit (1);
+	}
+	else if (us > _params.resetUs) {
+		return endOfMessage ();
+	}
+	else if ((_params.gapUs == 0) || (us > _params.gapUs)) {
+		_bits.addRow ();
+	}
+	return false;
+}
+
+}
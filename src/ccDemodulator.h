@@ -0,0 +1,93 @@
+//************************************************************************************************************************
+// ccDemodulator.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include "ccPulse.h"
+#include "ccBitBuffer.h"
+
+
+namespace cc1101 {
+
+/**
+ * Modulations of the rtl_433 flex decoder
+ */
+enum CCMODULATION : uint8_t
+{
+	OOK_MC_ZEROBIT = 0,												// Manchester, a falling edge is a 1, a leading 0 is implied
+	OOK_PWM,														// Pulse width: short pulse = 1, long pulse = 0
+	OOK_PPM,														// Pulse position: short gap = 0, long gap = 1
+};
+
+
+/**
+ * Demodulation parameters in µs (rtl_433 -X 's=,l=,r=,g=,t=,y=' keys)
+ */
+struct CCDEMOD_PARAMS
+{
+	CCMODULATION	modulation		= OOK_MC_ZEROBIT;
+	uint16_t		shortUs			= 0;							// s= : short pulse (Manchester half bit)
+	uint16_t		longUs			= 0;							// l= : long pulse or gap (PWM / PPM)
+	uint16_t		resetUs			= 0;							// r= : gap ending a message
+	uint16_t		gapUs			= 0;							// g= : gap starting a new row (PWM / PPM, 0 = none)
+	uint16_t		toleranceUs		= 0;							// t= : width tolerance (PWM / PPM, 0 = long / 4)
+	uint16_t		syncUs			= 0;							// y= : sync pulse starting a new row (PWM only, 0 = none)
+};
+
+
+/**
+ * Class: ccDemodulator
+ *
+ * Description:
+ * Streaming OOK demodulator with the rtl_433 pulse slicer semantics. The pulses (ccPulse format) are fed one by one,
+ * as they are read from the capture ring buffer; all the thresholds are integers computed once so that each pulse
+ * costs a few comparisons. No allocation: the bits are accumulated in a preallocated ccBitBuffer.
+ */
+class ccDemodulator
+{
+private:
+
+	CCDEMOD_PARAMS	_params;
+
+	// Precomputed thresholds in µs
+	uint16_t		_halfBitLimit		= 0;						// Manchester: 1.5 x short
+	uint16_t		_shortMin			= 0;						// PWM windows (exclusive bounds)
+	uint16_t		_shortMax			= 0;
+	uint16_t		_longMin			= 0;
+	uint16_t		_longMax			= 0;
+	uint16_t		_syncMin			= 0;
+	uint16_t		_syncMax			= 0;
+
+	ccBitBuffer		_bits;
+	uint16_t		_sinceLastBitUs		= 0;						// Manchester: time since the last data edge
+	bool			_inMessage			= false;					// A pulse was seen since the last reset
+	bool			_isComplete			= false;					// _bits holds a complete message
+
+private:
+
+	void restart						();
+	bool endOfMessage					();
+
+	bool feedManchesterZeroBit			(bool level, uint16_t us);
+	bool feedPwm						(bool level, uint16_t us);
+	bool feedPpm						(bool level, uint16_t us);
+
+public:
+
+	ccDemodulator						(const CCDEMOD_PARAMS & params);
+
+	void setParams						(const CCDEMOD_PARAMS & params);
+	const CCDEMOD_PARAMS & getParams	() const					{ return _params; }
+
+	bool feed							(uint16_t pulse);			// True when a message is complete
+	bool flush							();							// End of stream (timeout) => true if a message is complete
+	void reset							();
+
+	// Valid until the next feed when feed or flush returned true
+	const ccBitBuffer & getBits			() const					{ return _bits; }
+};
+
+}
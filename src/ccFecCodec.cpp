@@ -0,0 +1,150 @@
+//************************************************************************************************************************
+// ccFecCodec.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include "ccFecCodec.h"
+
+
+namespace cc1101 {
+
+// Coded symbol (G1 G0) of the 3 previous bits (oldest first) followed by the input bit
+static const uint8_t fecEncodeTable [16] PROGMEM = {
+	0, 3, 1, 2,
+	3, 0, 2, 1,
+	3, 0, 2, 1,
+	0, 3, 1, 2
+};
+
+//========================================================================================================================
+//
+//========================================================================================================================
+size_t ccFecEncoder :: appendTerminator (uint8_t * data, size_t len, size_t size)
+{
+	size_t terminated = getTerminatedSize (len);
+	if (terminated > size) return 0;
+
+	while (len < terminated) data [len++] = CCFEC_TERMINATOR;
+	return terminated;
+}
+
+//========================================================================================================================
+// Each input byte (MSB first) gives 8 symbols = 2 coded bytes, the encoder state goes on from byte to byte
+//========================================================================================================================
+size_t ccFecEncoder :: encode (const uint8_t * in, size_t len, uint8_t * out, size_t size)
+{
+	if ((len % 2 != 0) || (len * 2 > size)) return 0;
+
+	uint16_t reg = 0;												// Bits 10..8: previous bits, 7..0: input byte
+	for (size_t i = 0; i < len; i++) {
+
+		reg = (reg & 0x700) | in [i];
+
+		uint16_t coded = 0;
+		for (uint8_t j = 0; j < 8; j++) {
+			coded = (coded << 2) | pgm_read_byte (fecEncodeTable + (reg >> 7));
+			reg = (reg << 1) & 0x7FF;
+		}
+
+		out [2 * i]		= coded >> 8;
+		out [2 * i + 1]	= coded & 0xFF;
+	}
+
+	for (size_t i = 0; i < len * 2; i += CCFEC_INTERLEAVE_BLOCK) {
+		interleave (out + i);
+	}
+
+	return len * 2;
+}
+
+//========================================================================================================================
+// DN504: the 16 symbols are read from the bytes 3, 2, 1, 0, 3, 2, .. starting with their least significant symbol (a
+// transposition on the anti-diagonal of the matrix, so deinterleaving is the same)
+//========================================================================================================================
+void ccFecEncoder :: interleave (uint8_t * block)
+{
+	uint32_t interleaved = 0;
+
+	for (uint8_t j = 0; j < 4 * CCFEC_INTERLEAVE_BLOCK; j++) {
+		interleaved = (interleaved << 2) | ((block [~j & 0x03] >> (2 * ((j & 0x0C) >> 2))) & 0x03);
+	}
+
+	block [0] = interleaved >> 24;
+	block [1] = interleaved >> 16;
+	block [2] = interleaved >> 8;
+	block [3] = interleaved;
+}
+
+//========================================================================================================================
+// State = 3 last input bits (oldest first). The predecessors of state s are (s >> 1) and (s >> 1) | 4, the input bit
+// is s & 1. The path metric is the Hamming distance to the received symbols.
+//========================================================================================================================
+size_t ccViterbiDecoder :: decode (const uint8_t * in, size_t len, uint8_t * out, size_t size)
+{
+	_nbCorrected = 0;
+
+	size_t nbBytes = len / 2;
+	if ((len % CCFEC_INTERLEAVE_BLOCK != 0) || (nbBytes > size) || (nbBytes > CCFEC_MAX_INPUT_LEN)) return 0;
+
+	uint16_t metrics [CCFEC_NB_STATES];
+	metrics [0] = 0;
+	for (uint8_t s = 1; s < CCFEC_NB_STATES; s++) metrics [s] = 0x1000;	// Unreachable: the encoder starts in state 0
+
+	uint8_t * survivor = _survivors;
+
+	for (size_t i = 0; i < len; i += CCFEC_INTERLEAVE_BLOCK) {
+
+		uint8_t block [CCFEC_INTERLEAVE_BLOCK];
+		memcpy (block, in + i, CCFEC_INTERLEAVE_BLOCK);
+		ccFecEncoder::interleave (block);
+
+		for (uint8_t j = 0; j < 8 * CCFEC_INTERLEAVE_BLOCK / 2; j++) {
+
+			uint8_t received = (block [j / 4] >> (6 - 2 * (j % 4))) & 0x03;
+			uint16_t next [CCFEC_NB_STATES];
+			uint8_t bits = 0;
+
+			for (uint8_t s = 0; s < CCFEC_NB_STATES; s++) {
+				uint8_t index0 = s;											// Predecessor (s >> 1), oldest bit 0
+				uint8_t index1 = s | 0x08;									// Predecessor (s >> 1) | 4
+				uint8_t dist0 = received ^ pgm_read_byte (fecEncodeTable + index0);
+				uint8_t dist1 = received ^ pgm_read_byte (fecEncodeTable + index1);
+				uint16_t m0 = metrics [s >> 1]			+ ((dist0 >> 1) + (dist0 & 1));
+				uint16_t m1 = metrics [(s >> 1) | 4]	+ ((dist1 >> 1) + (dist1 & 1));
+
+				if (m1 < m0) {
+					next [s] = m1;
+					bits |= 1 << s;
+				}
+				else {
+					next [s] = m0;
+				}
+			}
+
+			memcpy (metrics, next, sizeof (metrics));
+			*survivor++ = bits;
+		}
+	}
+
+	// Traceback from the best final state
+	uint8_t state = 0;
+	for (uint8_t s = 1; s < CCFEC_NB_STATES; s++) {
+		if (metrics [s] < metrics [state]) state = s;
+	}
+	_nbCorrected = metrics [state];
+
+	for (size_t i = nbBytes; i-- > 0; ) {
+		uint8_t c = 0;
+		for (uint8_t j = 0; j < 8; j++) {
+			uint8_t bits = *--survivor;
+			c |= (state & 1) << j;
+			state = (state >> 1) | (((bits >> state) & 1) << 2);
+		}
+		out [i] = c;
+	}
+
+	return nbBytes;
+}
+
+}
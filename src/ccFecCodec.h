@@ -0,0 +1,70 @@
+//************************************************************************************************************************
+// ccFecCodec.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include "ccPacket.h"
+
+
+namespace cc1101 {
+
+/**
+ * CC1101 forward error correction (datasheet 15.4, DN504), MDMCFG1.FEC_EN in fixed packet length mode:
+ * - convolutional code, rate 1/2, constraint length 4: G1 = 1 + D^2 + D^3, G0 = 1 + D + D^2 + D^3 (G1 bit sent first)
+ * - the (whitened) bytes are padded to an even count with the trellis terminator 0x0B (1 or 2 bytes)
+ * - interleaving: each block of 4 coded bytes is a 4 x 4 matrix of 2 bits symbols, sent transposed (anti-diagonal)
+ * The code doubles the airtime of everything after the sync word. Its free distance is 6: it corrects sparse bit errors,
+ * the interleaver spreads the short bursts.
+ */
+#define CCFEC_TERMINATOR				0x0B
+#define CCFEC_INTERLEAVE_BLOCK			4							// Coded bytes per interleaver matrix
+#define CCFEC_NB_STATES					8							// 2^(constraint length - 1)
+#define CCFEC_MAX_INPUT_LEN				(CCPACKET_DATA_LEN + 6)		// Length + address + data + CRC + terminator
+
+
+/**
+ * Class: ccFecEncoder
+ *
+ * Description:
+ * Software copy of the CC1101 FEC encoder + interleaver (no state kept between packets)
+ */
+class ccFecEncoder
+{
+public:
+
+	static size_t getTerminatedSize		(size_t len)			{ return (len / 2 + 1) * 2;				}	// Input padded with the terminator
+	static size_t getEncodedSize		(size_t len)			{ return getTerminatedSize (len) * 2;	}	// On air
+
+	static size_t appendTerminator		(uint8_t * data, size_t len, size_t size);						// 0 if too small
+	static size_t encode				(const uint8_t * in, size_t len, uint8_t * out, size_t size);	// len even, 0 if too small
+
+	static void interleave				(uint8_t * block);		// CCFEC_INTERLEAVE_BLOCK bytes in place, its own inverse
+};
+
+
+/**
+ * Class: ccViterbiDecoder
+ *
+ * Description:
+ * Hard decision Viterbi decoder of the CC1101 FEC (the chip uses soft decisions, its gain is a bit higher): the whole
+ * packet is decoded with one traceback from the best state. The survivors take one byte per decoded bit
+ * (CCFEC_MAX_INPUT_LEN * 8 bytes): the owner keeps it as a member or allocates it, never on the stack.
+ */
+class ccViterbiDecoder
+{
+private:
+
+	uint8_t		_survivors [CCFEC_MAX_INPUT_LEN * 8];				// Bit s: previous state of state s (its oldest bit)
+	uint16_t	_nbCorrected	= 0;
+
+public:
+
+	size_t decode						(const uint8_t * in, size_t len, uint8_t * out, size_t size);	// Terminated size, 0 on error
+
+	uint16_t getNbCorrected				() const				{ return _nbCorrected; }	// Coded bits corrected by the last decode
+};
+
+}
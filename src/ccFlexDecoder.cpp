@@ -0,0 +1,165 @@
+//************************************************************************************************************************
+// ccFlexDecoder.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <Common.h>
+
+#include "ccFlexDecoder.h"
+
+using namespace corex;
+
+
+namespace cc1101 {
+
+//========================================================================================================================
+// Comparison of a key or a value of the spec (not null terminated) with a string
+//========================================================================================================================
+static bool matches (const char * str, size_t len, const char * expected)
+{
+	return (strlen (expected) == len) && (strncmp (str, expected, len) == 0);
+}
+
+//========================================================================================================================
+// Width in µs, the decimals are truncated
+//========================================================================================================================
+static bool parseUs (const char * str, size_t len, uint16_t & us)
+{
+	uint32_t value = 0;
+	size_t i = 0;
+
+	for (; (i < len) && isdigit (str [i]); i++) {
+		value = value * 10 + (str [i] - '0');
+		if (value > 0xFFFF) return false;
+	}
+	if (i == 0) return false;
+
+	if ((i < len) && (str [i] == '.')) {
+		for (i++; (i < len) && isdigit (str [i]); i++);
+	}
+	if (i < len) return false;										// Trailing garbage, ex: "12.3abc"
+
+	us = value;
+	return true;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool ccFlexDecoder :: parseSpec (const char * spec, char (&name) [CCFLEX_NAME_LEN], CCDEMOD_PARAMS & params, Print & out)
+{
+	bool hasModulation = false;
+
+	params	= CCDEMOD_PARAMS ();
+	name [0] = '\0';
+
+	while (*spec) {
+
+		const char * key	= spec;
+		const char * end	= strchr (spec, ',');
+		if (end == nullptr) end = spec + strlen (spec);
+
+		const char * equal	= (const char *) memchr (key, '=', end - key);
+		if (equal == nullptr) {
+			out << F("Malformatted key=value! ABORTED!!") << LN;
+			return false;
+		}
+
+		size_t keyLen		= equal - key;
+		const char * value	= equal + 1;
+		size_t valueLen		= end - value;
+
+		bool isValid = true;
+
+		if (matches (key, keyLen, "n") || matches (key, keyLen, "name")) {
+			size_t len = (valueLen < CCFLEX_NAME_LEN - 1) ? valueLen : CCFLEX_NAME_LEN - 1;
+			memcpy (name, value, len);
+			name [len] = '\0';
+		}
+		else if (matches (key, keyLen, "m") || matches (key, keyLen, "modulation")) {
+			if		(matches (value, valueLen, "OOK_MC_ZEROBIT"))	params.modulation = OOK_MC_ZEROBIT;
+			else if (matches (value, valueLen, "OOK_PWM"))			params.modulation = OOK_PWM;
+			else if (matches (value, valueLen, "OOK_PPM"))			params.modulation = OOK_PPM;
+			else {
+				out << F("Unsupported modulation! ABORTED!!") << LN;
+				return false;
+			}
+			hasModulation = true;
+		}
+		else if (matches (key, keyLen, "s") || matches (key, keyLen, "short"))		isValid = parseUs (value, valueLen, params.shortUs);
+		else if (matches (key, keyLen, "l") || matches (key, keyLen, "long"))		isValid = parseUs (value, valueLen, params.longUs);
+		else if (matches (key, keyLen, "r") || matches (key, keyLen, "reset"))		isValid = parseUs (value, valueLen, params.resetUs);
+		else if (matches (key, keyLen, "g") || matches (key, keyLen, "gap"))		isValid = parseUs (value, valueLen, params.gapUs);
+		else if (matches (key, keyLen, "t") || matches (key, keyLen, "tolerance"))	isValid = parseUs (value, valueLen, params.toleranceUs);
+		else if (matches (key, keyLen, "y") || matches (key, keyLen, "sync"))		isValid = parseUs (value, valueLen, params.syncUs);
+		// Else rtl_433 key not used by the demodulation (bits, match, preamble, get..): ignored
+
+		if (!isValid) {
+			out << F("Invalid width! ABORTED!!") << LN;
+			return false;
+		}
+
+		spec = (*end) ? end + 1 : end;
+	}
+
+	if (!hasModulation || (params.shortUs == 0) || (params.resetUs == 0)) {
+		out << F("Missing m, s or r key! ABORTED!!") << LN;
+		return false;
+	}
+	if ((params.modulation != OOK_MC_ZEROBIT) && (params.longUs == 0)) {
+		out << F("Missing l key! ABORTED!!") << LN;
+		return false;
+	}
+	if (name [0] == '\0') {
+		strcpy (name, "flex");
+	}
+
+	return true;
+}
+
+//========================================================================================================================
+// An invalid spec leaves the decoder unchanged
+//========================================================================================================================
+bool ccFlexDecoder :: parse (const char * spec, Print & out)
+{
+	char name [CCFLEX_NAME_LEN];
+	CCDEMOD_PARAMS params;
+
+	if (!parseSpec (spec, name, params, out)) return false;
+
+	strcpy (_name, name);
+	_demodulator.setParams (params);
+	_nbMessages = 0;
+
+	return true;
+}
+
+//========================================================================================================================
+// Normalized spec
+//========================================================================================================================
+size_t ccFlexDecoder :: printSpec (Print & p, const char * name, const CCDEMOD_PARAMS & params)
+{
+	static const char * const MODULATIONS [] = { "OOK_MC_ZEROBIT", "OOK_PWM", "OOK_PPM" };
+
+	size_t n = 0;
+	n += p.print (F("n="));		n += p.print (name);
+	n += p.print (F(",m="));	n += p.print (MODULATIONS [params.modulation]);
+	n += p.print (F(",s="));	n += p.print ((unsigned) params.shortUs);
+	n += p.print (F(",l="));	n += p.print ((unsigned) params.longUs);
+	n += p.print (F(",r="));	n += p.print ((unsigned) params.resetUs);
+	n += p.print (F(",g="));	n += p.print ((unsigned) params.gapUs);
+	n += p.print (F(",t="));	n += p.print ((unsigned) params.toleranceUs);
+	n += p.print (F(",y="));	n += p.print ((unsigned) params.syncUs);
+	return n;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+size_t ccFlexDecoder :: printTo (Print & p) const
+{
+	return printSpec (p, _name, getParams ());
+}
+
+}
@@ -0,0 +1,53 @@
+//************************************************************************************************************************
+// ccFlexDecoder.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include "ccDemodulator.h"
+
+
+namespace cc1101 {
+
+#define CCFLEX_NAME_LEN					16
+
+
+/**
+ * Class: ccFlexDecoder
+ *
+ * Description:
+ * Runtime decoder configured by a rtl_433 flex decoder specification, ex: "n=name,m=OOK_MC_ZEROBIT,s=844,l=0,r=1656"
+ * Supported keys: n (name), m (OOK_MC_ZEROBIT, OOK_PWM or OOK_PPM), s, l, r, g, t, y (µs). The other rtl_433 keys
+ * are ignored.
+ */
+class ccFlexDecoder : public Printable
+{
+private:
+
+	char			_name [CCFLEX_NAME_LEN]	= {0};
+	ccDemodulator	_demodulator;
+	uint32_t		_nbMessages				= 0;
+
+public:
+
+	ccFlexDecoder						() : _demodulator (CCDEMOD_PARAMS ()) {}
+
+	static bool parseSpec				(const char * spec, char (&name) [CCFLEX_NAME_LEN], CCDEMOD_PARAMS & params, Print & out);
+	bool parse							(const char * spec, Print & out);
+	static size_t printSpec				(Print & p, const char * name, const CCDEMOD_PARAMS & params);
+
+	const char * getName				() const					{ return _name;							}
+	const CCDEMOD_PARAMS & getParams	() const					{ return _demodulator.getParams ();		}
+	uint32_t getNbMessages				() const					{ return _nbMessages;					}
+	const ccBitBuffer & getBits			() const					{ return _demodulator.getBits ();		}
+
+	bool feed							(uint16_t pulse)			{ return count (_demodulator.feed (pulse));	}
+	bool flush							()							{ return count (_demodulator.flush ());		}
+	bool count							(bool isComplete)			{ if (isComplete) _nbMessages++; return isComplete; }
+
+	virtual size_t printTo				(Print & p) const override;	// Spec
+};
+
+}
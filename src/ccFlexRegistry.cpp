@@ -0,0 +1,158 @@
+//************************************************************************************************************************
+// ccFlexRegistry.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include "ccFlexRegistry.h"
+
+using namespace corex;
+
+
+namespace cc1101 {
+
+//========================================================================================================================
+// A decoder with the same name is replaced
+//========================================================================================================================
+bool ccFlexRegistry :: add (const char * spec, Print & out)
+{
+	char name [CCFLEX_NAME_LEN];
+	CCDEMOD_PARAMS params;
+
+	if (!ccFlexDecoder::parseSpec (spec, name, params, out)) return false;
+
+	uint8_t i = 0;
+	while ((i < _nbDecoders) && (strcmp (_decoders [i].getName (), name) != 0)) i++;
+
+	if (i >= CCFLEX_MAX_DECODERS) {
+		out << F("Too many decoders! ABORTED!!") << LN;
+		return false;
+	}
+
+	_decoders [i].parse (spec, out);
+	if (i == _nbDecoders) _nbDecoders++;
+
+	if (_lastDecoder == i) _lastDecoder = -1;
+
+	out << F("Decoder ") << _decoders [i] << F(" added") << LN;
+	return true;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool ccFlexRegistry :: remove (const char * name)
+{
+	for (uint8_t i = 0; i < _nbDecoders; i++) {
+		if (strcmp (_decoders [i].getName (), name) == 0) {
+			for (uint8_t j = i + 1; j < _nbDecoders; j++) {
+				_decoders [j - 1] = _decoders [j];
+			}
+			_nbDecoders--;
+			_lastDecoder = -1;
+			return true;
+		}
+	}
+	return false;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccFlexRegistry :: clear ()
+{
+	_nbDecoders		= 0;
+	_lastDecoder	= -1;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccFlexRegistry :: onDecoded (uint8_t i)
+{
+	_lastBits		= _decoders [i].getBits ();
+	_lastDecoder	= i;
+
+	notifyDecoded (_decoders [i], _decoders [i].getBits ());
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccFlexRegistry :: feed (uint16_t pulse)
+{
+	_isPending = true;
+
+	for (uint8_t i = 0; i < _nbDecoders; i++) {
+		if (_decoders [i].feed (pulse)) onDecoded (i);
+	}
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccFlexRegistry :: flush ()
+{
+	_isPending = false;
+
+	for (uint8_t i = 0; i < _nbDecoders; i++) {
+		if (_decoders [i].flush ()) onDecoded (i);
+	}
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccFlexRegistry :: attach (CC1101OokCapture * capture)
+{
+	_pollTicker.detach ();
+	_capture = capture;
+
+	if (_capture == nullptr) return;
+
+	if (!_capture->isCapturing ()) _capture->startReceivePacket ();
+
+	_lastPulseMs = millis ();
+	_pollTicker.attach_ms (CCFLEX_POLL_MS, std::bind (&ccFlexRegistry::poll, this));
+}
+
+//========================================================================================================================
+// Drain the capture ring buffer, a silence longer than CCFLEX_IDLE_FLUSH_MS ends the pending messages
+//========================================================================================================================
+void ccFlexRegistry :: poll ()
+{
+	uint16_t pulse;
+	uint32_t now = millis ();
+
+	if (_capture->available () > 0) {
+		_lastPulseMs = now;
+		while (_capture->readPulse (pulse)) {
+			feed (pulse);
+		}
+	}
+	else if (_isPending && (now - _lastPulseMs > CCFLEX_IDLE_FLUSH_MS)) {
+		flush ();
+	}
+}
+
+//========================================================================================================================
+// One "spec messages" line per decoder then the last decoded message
+//========================================================================================================================
+size_t ccFlexRegistry :: printTo (Print & p) const
+{
+	size_t n = 0;
+	for (uint8_t i = 0; i < _nbDecoders; i++) {
+		n += p.print (_decoders [i]);
+		n += p.print (' ');
+		n += p.print (_decoders [i].getNbMessages ());
+		n += p.print ('\n');
+	}
+	if (_lastDecoder >= 0) {
+		n += p.print (_decoders [_lastDecoder].getName ());
+		n += p.print (F(":\n"));
+		n += p.print (_lastBits);
+	}
+	return n;
+}
+
+}
@@ -0,0 +1,73 @@
+//************************************************************************************************************************
+// ccFlexRegistry.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include <Ticker.h>
+
+#include <Common.h>
+
+#include "cc1101OokCapture.h"
+#include "ccFlexDecoder.h"
+
+
+namespace cc1101 {
+
+#define CCFLEX_MAX_DECODERS				4
+#define CCFLEX_POLL_MS					10							// Capture ring buffer polling period
+#define CCFLEX_IDLE_FLUSH_MS			50							// Silence ending the pending messages
+
+
+/**
+ * Class: ccFlexRegistry
+ *
+ * Description:
+ * Set of flex decoders running in parallel over one pulse stream. The pulses are fed by the application or polled
+ * from an OOK capture radio; each complete message is notified with the decoder that found it and the last one is
+ * kept for printing.
+ */
+class ccFlexRegistry : public Printable
+{
+private:
+
+	ccFlexDecoder			_decoders [CCFLEX_MAX_DECODERS];
+	uint8_t					_nbDecoders		= 0;
+
+	CC1101OokCapture *		_capture		= nullptr;
+	uint32_t				_lastPulseMs	= 0;
+	bool					_isPending		= false;				// Pulses fed since the last flush
+	Ticker					_pollTicker;
+
+	ccBitBuffer				_lastBits;								// Last decoded message
+	int8_t					_lastDecoder	= -1;
+
+private:
+
+	void poll							();
+	void onDecoded						(uint8_t i);
+
+public:
+
+	corex::Signal <const ccFlexDecoder &, const ccBitBuffer &>	notifyDecoded;
+
+public:
+
+	bool add							(const char * spec, Print & out);
+	bool remove							(const char * name);
+	void clear							();
+
+	void feed							(uint16_t pulse);
+	void flush							();
+
+	void attach							(CC1101OokCapture * capture);		// Live decoding (nullptr => detach)
+
+	uint8_t size						() const					{ return _nbDecoders;	}
+	const ccFlexDecoder & operator[]	(uint8_t i) const			{ return _decoders [i];	}
+
+	virtual size_t printTo				(Print & p) const override;
+};
+
+}
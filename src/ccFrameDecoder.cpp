@@ -0,0 +1,59 @@
+//************************************************************************************************************************
+// ccFrameDecoder.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include "ccFrameDecoder.h"
+
+
+namespace cc1101 {
+
+//========================================================================================================================
+// The length byte is only readable before the decoding when it is neither whitened nor FEC encoded
+//========================================================================================================================
+bool ccFrameDecoder :: acceptsFirstByte (uint8_t firstByte) const
+{
+	if (!_format.isVariableLength || _format.isWhitening || _format.isFec) return true;
+
+	uint8_t addressLen = _format.isAddressCheck ? 1 : 0;			// The length byte counts the address byte
+	return (firstByte >= addressLen) && (firstByte - addressLen <= CCPACKET_DATA_LEN);
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool ccFrameDecoder :: acceptsLength (uint8_t length) const
+{
+	if (_format.isVariableLength) return length >= ccPacketEngine::getFrameSize (0, _format);
+
+	return length == ccPacketEngine::getFrameSize (_format.length, _format);
+}
+
+//========================================================================================================================
+// Clear length byte: the frame must hold the whole announced payload
+//========================================================================================================================
+bool ccFrameDecoder :: matches (const CCPACKET & packet) const
+{
+	if (!_format.isVariableLength || _format.isWhitening || _format.isFec) return true;
+
+	return packet.length >= ccPacketEngine::getFrameSize (packet.data [0] - (_format.isAddressCheck ? 1 : 0), _format);
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+const ccDecodedEvent * ccFrameDecoder :: decode (const CCPACKET & packet)
+{
+	if (_format.isFec && !_viterbiDecoder) _viterbiDecoder.reset (new ccViterbiDecoder ());
+
+	if (!ccPacketEngine::decode (packet.data, packet.length, _format, _event.packet, _viterbiDecoder.get ())) return nullptr;
+
+	if (_format.isCrc && !_event.packet.crc_ok) {
+		_nbCrcErrors++;
+		return nullptr;
+	}
+	return &_event;
+}
+
+}
@@ -0,0 +1,69 @@
+//************************************************************************************************************************
+// ccFrameDecoder.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include <memory>
+
+#include "ccPacketEngine.h"
+#include "ccProtocolDecoder.h"
+
+
+namespace cc1101 {
+
+/**
+ * Packet of our own GFSK framing, checked by the software packet engine
+ */
+struct FRAME_EVENT : public ccDecodedEvent
+{
+	static constexpr uint8_t TYPE = CCEVENT_FRAME;
+
+	CCPACKET	packet;
+
+	FRAME_EVENT							() : ccDecodedEvent (TYPE) {}
+
+	virtual size_t printTo				(Print & p) const override	{ return packet.printTo (p); }
+};
+
+
+/**
+ * Class: ccFrameDecoder
+ *
+ * Description:
+ * GFSK framing module of the ccDecoderRegistry: the received bytes are a raw frame (hardware packet handling off,
+ * infinite length mode) which is de-whitened, FEC decoded and CRC checked by ccPacketEngine with the given format.
+ * The index predicates come from the format: frame size, length byte range when it is sent in clear.
+ * The Viterbi decoder is only allocated on the first FEC frame.
+ */
+class ccFrameDecoder : public ccProtocolDecoder
+{
+private:
+
+	const char *	_name;
+	CCFRAME_FORMAT	_format;
+	FRAME_EVENT		_event;
+	uint32_t		_nbCrcErrors		= 0;
+
+	std::unique_ptr <ccViterbiDecoder>	_viterbiDecoder;
+
+public:
+
+	ccFrameDecoder						(const char * name, const CCFRAME_FORMAT & format) : _name (name), _format (format) {}
+
+	const CCFRAME_FORMAT & getFormat	() const					{ return _format;		}
+	uint32_t getNbCrcErrors				() const					{ return _nbCrcErrors;	}
+	uint16_t getNbCorrected				() const					{ return _viterbiDecoder ? _viterbiDecoder->getNbCorrected () : 0; }	// Coded bits corrected in the last FEC frame
+
+	// ccProtocolDecoder
+	virtual const char * getName		() const override			{ return _name;			}
+	virtual bool acceptsFirstByte		(uint8_t firstByte) const override;
+	virtual bool acceptsLength			(uint8_t length) const override;
+	virtual bool matches				(const CCPACKET & packet) const override;
+
+	virtual const ccDecodedEvent * decode	(const CCPACKET & packet) override;
+};
+
+}
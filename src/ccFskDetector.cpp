@@ -0,0 +1,386 @@
+//************************************************************************************************************************
+// ccFskDetector.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <Common.h>
+
+#include "ccFskDetector.h"
+
+using namespace corex;
+
+
+namespace cc1101 {
+
+// Common data rates (fastest first) and deviations (SmartRF Studio values)
+static const uint32_t detectDataRates [] PROGMEM	= { 100000, 76800, 38400, 19200, 9600, 4800, 2400, 1200 };
+static const uint32_t detectDeviations [] PROGMEM	= { 2400, 5200, 12700, 20600, 47600 };
+
+#define NB_DETECT_DATA_RATES	(sizeof (detectDataRates) / sizeof (detectDataRates [0]))
+#define NB_DETECT_DEVIATIONS	(sizeof (detectDeviations) / sizeof (detectDeviations [0]))
+
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void FSK_SYNC_VOTES :: add (uint16_t syncWord)
+{
+	uint8_t lowest = 0;
+	for (uint8_t i = 0; i < nbSyncWords; i++) {
+		if (syncWords [i] == syncWord) {
+			counts [i]++;
+			return;
+		}
+		if (counts [i] < counts [lowest]) lowest = i;
+	}
+
+	// Table full => the least voted word is replaced
+	uint8_t i = (nbSyncWords < CCDETECT_MAX_SYNCS) ? nbSyncWords++ : lowest;
+	syncWords [i]	= syncWord;
+	counts [i]		= 1;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+uint8_t FSK_SYNC_VOTES :: getBest () const
+{
+	uint8_t best = 0;
+	for (uint8_t i = 1; i < nbSyncWords; i++) {
+		if (counts [i] > counts [best]) best = i;
+	}
+	return best;
+}
+
+//========================================================================================================================
+// DRATE_E / DRATE_M of a data rate: baud = (256 + M) * 2^E * f_xosc / 2^28, returns the real data rate
+//========================================================================================================================
+uint32_t ccFskDetector :: computeDataRate (uint32_t baud, uint8_t & drateE, uint8_t & drateM)
+{
+	uint64_t target = ((uint64_t) baud << 28) / CRYSTAL_FREQUENCY;		// (256 + M) << E
+
+	uint8_t e = 0;
+	while ((e < 15) && (target >= (512ULL << e))) e++;
+
+	uint64_t m = (target + ((1ULL << e) >> 1)) >> e;
+	if (m >= 512)	{ m = 256; if (e < 15) e++; }
+	if (m < 256)	m = 256;
+
+	drateE = e;
+	drateM = m - 256;
+
+	return (uint32_t) (((m << e) * CRYSTAL_FREQUENCY) >> 28);
+}
+
+//========================================================================================================================
+// DEVIATN closest to a deviation: dev = (8 + M) * 2^E * f_xosc / 2^17, returns the real deviation
+//========================================================================================================================
+uint32_t ccFskDetector :: computeDeviation (uint32_t deviationHz, uint8_t & deviatn)
+{
+	uint32_t best = 0;
+	deviatn = 0;
+
+	for (uint8_t e = 0; e < 8; e++) {
+		for (uint8_t m = 0; m < 8; m++) {
+			uint32_t dev = (uint32_t) ((((uint64_t) (8 + m) << e) * CRYSTAL_FREQUENCY) >> 17);
+			if ((best == 0) || (abs ((int32_t) dev - (int32_t) deviationHz) < abs ((int32_t) best - (int32_t) deviationHz))) {
+				best	= dev;
+				deviatn	= (e << 4) | m;
+			}
+		}
+	}
+	return best;
+}
+
+//========================================================================================================================
+// CHANBW_E / CHANBW_M (MDMCFG4 high nibble) of the narrowest filter wider than bandwidthHz:
+// bw = f_xosc / (8 * (4 + M) * 2^E), returns the real bandwidth
+//========================================================================================================================
+uint32_t ccFskDetector :: computeChannelBw (uint32_t bandwidthHz, uint8_t & chanBw)
+{
+	for (int8_t e = 3; e >= 0; e--) {
+		for (int8_t m = 3; m >= 0; m--) {
+			uint32_t bw = CRYSTAL_FREQUENCY / ((8UL * (4 + m)) << e);
+			if ((bw >= bandwidthHz) || ((e == 0) && (m == 0))) {
+				chanBw = (e << 6) | (m << 4);
+				return bw;
+			}
+		}
+	}
+	return 0;
+}
+
+//========================================================================================================================
+// Build the candidates list in scan order (see the class description)
+//========================================================================================================================
+void ccFskDetector :: schedule ()
+{
+	_nbCandidates	= 0;
+	_best			= -1;
+
+	for (uint8_t i = 0; i < NB_DETECT_DATA_RATES; i++) {
+
+		uint32_t baud	= pgm_read_dword (&detectDataRates [i]);
+		uint8_t first	= _nbCandidates;
+
+		for (uint8_t j = 0; (j < NB_DETECT_DEVIATIONS) && (_nbCandidates < CCDETECT_MAX_CANDIDATES); j++) {
+
+			uint32_t deviationHz = pgm_read_dword (&detectDeviations [j]);
+			if ((4 * deviationHz < baud) || (deviationHz > CCDETECT_MAX_MOD_INDEX * baud)) continue;
+
+			// Insertion by modulation index distance to 1 (2 x deviation = baud)
+			uint32_t distance = abs ((int32_t) (2 * deviationHz) - (int32_t) baud);
+			uint8_t k = _nbCandidates++;
+			while ((k > first) && (abs ((int32_t) (2 * _candidates [k - 1].deviationHz) - (int32_t) baud) > (int32_t) distance)) {
+				_candidates [k] = _candidates [k - 1];
+				k--;
+			}
+
+			FSK_CANDIDATE & candidate = _candidates [k];
+			candidate				= FSK_CANDIDATE ();
+			candidate.deviationHz	= deviationHz;
+			candidate.baud			= baud;
+		}
+
+		for (uint8_t k = first; k < _nbCandidates; k++) {
+
+			FSK_CANDIDATE & candidate = _candidates [k];
+			uint8_t drateE, drateM, chanBw;
+
+			candidate.baud			= computeDataRate	(candidate.baud, drateE, drateM);
+			candidate.deviationHz	= computeDeviation	(candidate.deviationHz, candidate.deviatn);
+			computeChannelBw		(candidate.baud + 2 * candidate.deviationHz, chanBw);
+
+			candidate.mdmcfg4		= chanBw | drateE;
+			candidate.mdmcfg3		= drateM;
+		}
+	}
+}
+
+//========================================================================================================================
+// Search the bits for an alternating run followed by 16 bits (MSB first, as received)
+//========================================================================================================================
+void ccFskDetector :: findSyncWords (const uint8_t * data, uint16_t nbBits, FSK_SYNC_VOTES & votes)
+{
+	auto bitAt = [data] (uint16_t i) -> uint8_t { return (data [i >> 3] >> (7 - (i & 7))) & 1; };
+
+	uint16_t run = 1;
+	for (uint16_t i = 1; i < nbBits; i++) {
+
+		if (bitAt (i) != bitAt (i - 1)) {
+			run++;
+			continue;
+		}
+
+		if (run >= CCDETECT_MIN_PREAMBLE_BITS) {
+
+			// The preamble ends with a 0 => a 1 before the break already belongs to the sync word
+			uint16_t start = bitAt (i - 1) ? i - 1 : i;
+
+			if (start + 16 <= nbBits) {
+				uint16_t syncWord = 0;
+				for (uint8_t b = 0; b < 16; b++) {
+					syncWord = (syncWord << 1) | bitAt (start + b);
+				}
+				votes.add (syncWord);
+				votes.nbPreambles++;
+			}
+		}
+		run = 1;
+	}
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccFskDetector :: analyzeCapture (FSK_CANDIDATE & candidate)
+{
+	findSyncWords (_capture, _captureLen * 8, _votes);
+	_captureLen = 0;
+
+	candidate.nbPreambles = _votes.nbPreambles;
+	if (_votes.nbSyncWords > 0) {
+		uint8_t best = _votes.getBest ();
+		candidate.syncWord	= _votes.syncWords [best];
+		candidate.nbMatches	= _votes.counts [best];
+	}
+}
+
+// Registers changed by the sweep
+static const uint8_t detectRegs [CCDETECT_NB_SAVED_REGS] PROGMEM = { CC1101_MDMCFG4, CC1101_MDMCFG3, CC1101_MDMCFG2, CC1101_DEVIATN, CC1101_PKTCTRL1, CC1101_PKTCTRL0 };
+
+//========================================================================================================================
+// Listening time of a candidate: at least the time of CCDETECT_MIN_MATCHES preambles + sync words
+//========================================================================================================================
+void ccFskDetector :: startCandidate (uint8_t i)
+{
+	FSK_CANDIDATE & candidate = _candidates [i];
+
+	_current			= i;
+	_candidateMs		= millis ();
+	_candidateListenMs	= (CCDETECT_MIN_MATCHES * CC1101_SYNC_DETECT_BITS * 1000UL) / candidate.baud + 1;
+	if (_candidateListenMs < _listenMs) _candidateListenMs = _listenMs;
+
+	_captureLen = 0;
+	_votes.clear ();
+
+	_radio.cmdStrobeFast	(CC1101_SIDLE);
+	_radio.writeRegFast		(CC1101_MDMCFG4,	candidate.mdmcfg4);
+	_radio.writeRegFast		(CC1101_MDMCFG3,	candidate.mdmcfg3);
+	_radio.writeRegFast		(CC1101_DEVIATN,	candidate.deviatn);
+	_radio.cmdStrobeFast	(CC1101_SFRX);
+	_radio.cmdStrobeFast	(CC1101_SRX);
+}
+
+//========================================================================================================================
+// Drain the RX FIFO once
+//========================================================================================================================
+bool ccFskDetector :: poll (FSK_CANDIDATE & candidate)
+{
+	if ((millis () - _candidateMs >= _candidateListenMs) || (candidate.nbMatches >= CCDETECT_MIN_MATCHES)) {
+		analyzeCapture (candidate);
+		candidate.isScanned = true;
+		return true;
+	}
+
+	uint8_t rxBytes = _radio.readStatusRegFast (CC1101_RXBYTES);
+
+	if (rxBytes & CCDETECT_RXFIFO_OVERFLOW) {
+		analyzeCapture			(candidate);						// The bit stream is broken
+		_radio.cmdStrobeFast	(CC1101_SIDLE);
+		_radio.cmdStrobeFast	(CC1101_SFRX);
+		_radio.cmdStrobeFast	(CC1101_SRX);
+		return false;
+	}
+
+	uint8_t nbBytes = rxBytes & CC1101_BYTES_IN_FIFO;
+	if (nbBytes <= 1) return false;									// The last byte is never read while receiving
+
+	nbBytes = MIN (nbBytes - 1, CCDETECT_CAPTURE_LEN - _captureLen);
+	_radio.readRxFifoFast (_capture + _captureLen, nbBytes);
+	_captureLen			+= nbBytes;
+	candidate.nbBytes	+= nbBytes;
+
+	if (_captureLen >= CCDETECT_CAPTURE_LEN) {
+		analyzeCapture (candidate);
+	}
+	return false;
+}
+
+//========================================================================================================================
+// Starts the sweep (listenMs per candidate at most), the sweep runs in loop ()
+//========================================================================================================================
+bool ccFskDetector :: start (uint32_t listenMs /*= CCDETECT_DEFAULT_LISTEN_MS*/)
+{
+	if (isRunning ()) return false;
+
+	schedule ();
+	if (_nbCandidates == 0) return false;
+
+	_radio.stopReceivePacket ();
+
+	for (uint8_t i = 0; i < sizeof (detectRegs); i++) {
+		_savedRegs [i] = _radio.readConfigRegister (pgm_read_byte (&detectRegs [i]));
+	}
+
+	// One calibration for the whole sweep
+	uint8_t fscal [CC1101_FSCAL_LEN];
+	_savedMcsm0 = _radio.setManualCalibration ();
+	if (!_radio.calibrateChannel (_radio.getChannel (), fscal)) {
+		_radio.writeRegFast			(CC1101_MCSM0, _savedMcsm0);
+		_radio.startReceivePacket	(0);
+		return false;
+	}
+
+	Logln (F("FSK detection: ") << _nbCandidates << F(" candidates, ") << listenMs << F("ms each"));
+
+	_radio.writeRegFast (CC1101_MDMCFG2,	CCDETECT_MDMCFG2);
+	_radio.writeRegFast (CC1101_PKTCTRL1,	CCDETECT_PKTCTRL1);
+	_radio.writeRegFast (CC1101_PKTCTRL0,	CCDETECT_PKTCTRL0);
+
+	_listenMs	= listenMs;
+	_startMs	= millis ();
+	startCandidate (0);
+
+	return true;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool ccFskDetector :: loop ()
+{
+	if (!isRunning ()) return false;
+
+	FSK_CANDIDATE & candidate = _candidates [_current];
+	if (!poll (candidate)) return true;
+
+	if ((candidate.nbMatches > 0) && ((_best < 0) || (candidate.nbMatches > _candidates [_best].nbMatches))) {
+		_best = _current;
+	}
+
+	if ((candidate.nbMatches >= CCDETECT_MIN_MATCHES) || (_current + 1 >= _nbCandidates)) {
+		finish ();
+		return false;
+	}
+
+	startCandidate (_current + 1);
+	return true;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccFskDetector :: stop ()
+{
+	if (isRunning ()) finish ();
+}
+
+//========================================================================================================================
+// Restores the configuration and the reception
+//========================================================================================================================
+void ccFskDetector :: finish ()
+{
+	_current	= -1;
+	_scanMs		= millis () - _startMs;
+
+	_radio.cmdStrobeFast	(CC1101_SIDLE);
+	_radio.cmdStrobeFast	(CC1101_SFRX);
+	for (uint8_t i = 0; i < sizeof (detectRegs); i++) {
+		_radio.writeRegFast (pgm_read_byte (&detectRegs [i]), _savedRegs [i]);
+	}
+	_radio.writeRegFast		(CC1101_MCSM0,		_savedMcsm0);
+	_radio.startReceivePacket (0);							// Calibrates again on the working channel
+
+	if (isDetected ()) {
+		Logln (F("FSK detected in ") << _scanMs << F("ms: ") << _candidates [_best].baud << F(" baud, ")
+			<< _candidates [_best].deviationHz << F("Hz deviation, sync word ") << String (_candidates [_best].syncWord, HEX));
+	}
+	else {
+		Logln (F("No FSK transmitter detected in ") << _scanMs << F("ms"));
+	}
+}
+
+//========================================================================================================================
+// One "baud deviationHz bytes preambles syncword matches" line per scanned candidate
+//========================================================================================================================
+size_t ccFskDetector :: printTo (Print & p) const
+{
+	size_t n = 0;
+	for (uint8_t i = 0; i < _nbCandidates; i++) {
+
+		const FSK_CANDIDATE & candidate = _candidates [i];
+		if (!candidate.isScanned) continue;
+
+		n += p.print (candidate.baud);				n += p.print (' ');
+		n += p.print (candidate.deviationHz);		n += p.print (' ');
+		n += p.print (candidate.nbBytes);			n += p.print (' ');
+		n += p.print (candidate.nbPreambles);		n += p.print (' ');
+		n += p.print (candidate.syncWord, HEX);		n += p.print (' ');
+		n += p.print (candidate.nbMatches);			n += p.print ('\n');
+	}
+	return n;
+}
+
+}
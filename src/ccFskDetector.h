@@ -0,0 +1,138 @@
+//************************************************************************************************************************
+// ccFskDetector.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include "cc1101.h"
+
+
+namespace cc1101 {
+
+#define CCDETECT_MAX_CANDIDATES			40							// Data rate x deviation pairs
+#define CCDETECT_MAX_SYNCS				8							// Sync word vote table size
+#define CCDETECT_CAPTURE_LEN			128							// Raw bytes analyzed at once
+#define CCDETECT_MIN_PREAMBLE_BITS		16							// Shortest alternating run taken as a preamble
+#define CCDETECT_MIN_MATCHES			3							// Same sync word seen n times => detected
+#define CCDETECT_MAX_MOD_INDEX			16							// Deviations above baud x n are skipped
+#define CCDETECT_DEFAULT_LISTEN_MS		500							// Listening time per candidate
+
+#define CCDETECT_MDMCFG2				0x04						// 2-FSK, no preamble / sync word, carrier sense
+#define CCDETECT_PKTCTRL1				0x00						// No status bytes, no address check
+#define CCDETECT_PKTCTRL0				0x02						// No whitening, no CRC, infinite packet length
+#define CCDETECT_RXFIFO_OVERFLOW		0x80						// RXBYTES overflow flag
+#define CCDETECT_NB_SAVED_REGS			6							// Registers changed by the sweep
+
+
+/**
+ * One modem configuration of the sweep and what was heard with it
+ */
+struct FSK_CANDIDATE
+{
+	uint32_t	baud			= 0;
+	uint32_t	deviationHz		= 0;
+	uint8_t		mdmcfg4			= 0;								// CHANBW_E | CHANBW_M | DRATE_E
+	uint8_t		mdmcfg3			= 0;								// DRATE_M
+	uint8_t		deviatn			= 0;
+	uint32_t	nbBytes			= 0;								// Raw bytes received (carrier sensed)
+	uint16_t	nbPreambles		= 0;								// Alternating runs found
+	uint16_t	syncWord		= 0;								// Most frequent 16 bits after a preamble
+	uint16_t	nbMatches		= 0;								// Number of times syncWord was seen
+	bool		isScanned		= false;
+};
+
+
+/**
+ * Sync word votes collected while listening with one candidate
+ */
+struct FSK_SYNC_VOTES
+{
+	uint16_t	syncWords [CCDETECT_MAX_SYNCS];
+	uint16_t	counts [CCDETECT_MAX_SYNCS];
+	uint8_t		nbSyncWords		= 0;
+	uint16_t	nbPreambles		= 0;
+
+	void add					(uint16_t syncWord);
+	uint8_t getBest				() const;
+	void clear					()		{ nbSyncWords = 0; nbPreambles = 0; }
+};
+
+
+/**
+ * Class: ccFskDetector
+ *
+ * Description:
+ * Finds the data rate, the deviation and the sync word of an unknown 2-FSK transmitter. The receiver is put in
+ * carrier sense mode (MDMCFG2.SYNC_MODE = 4, infinite packet length) so that every byte demodulated while a signal is
+ * present reaches the RX FIFO, then the raw bytes are searched for an alternating preamble followed by the same 16 bits
+ * several times. The preamble is assumed to end with a 0 bit (0xAA..., the CC1101 default) and the sync word must not
+ * begin with the preamble pattern.
+ *
+ * Scheduling: the data rates are visited from the fastest (a packet is heard sooner) to the slowest, the deviations of
+ * a data rate from the modulation index closest to 1; deviations below baud / 4 (not demodulated) or above
+ * baud x CCDETECT_MAX_MOD_INDEX are skipped. The synthesizer is calibrated once for the whole sweep and the sweep stops
+ * as soon as a sync word is confirmed. The reception is suspended and the configuration restored afterwards.
+ *
+ * The sweep takes up to listenMs per candidate (about 20s with the defaults): start () only configures the radio, then
+ * each loop () call drains the RX FIFO once and moves to the next candidate when the listening time is over, so the
+ * application loop (WiFi, web server) keeps running. The 64 bytes RX FIFO holds 5ms at 100 kbaud: a slower loop only
+ * loses bits (the overflow restarts the bit stream).
+ */
+class ccFskDetector : public Printable
+{
+private:
+
+	CC1101 &		_radio;
+
+	FSK_CANDIDATE	_candidates [CCDETECT_MAX_CANDIDATES];
+	uint8_t			_nbCandidates	= 0;
+	int8_t			_best			= -1;
+	uint32_t		_scanMs			= 0;							// Duration of the last sweep
+
+	uint8_t			_capture [CCDETECT_CAPTURE_LEN];
+	uint8_t			_captureLen		= 0;
+	FSK_SYNC_VOTES	_votes;
+
+	// Sweep in progress
+	int8_t			_current		= -1;							// Candidate listened to, -1 => no sweep
+	uint32_t		_listenMs		= 0;
+	uint32_t		_startMs		= 0;
+	uint32_t		_candidateMs	= 0;							// Start of the current candidate
+	uint32_t		_candidateListenMs = 0;
+	uint8_t			_savedRegs [CCDETECT_NB_SAVED_REGS];			// Configuration to restore
+	uint8_t			_savedMcsm0		= 0;
+
+private:
+
+	void schedule					();
+	void startCandidate				(uint8_t i);
+	bool poll						(FSK_CANDIDATE & candidate);	// True when the candidate is done
+	void finish						();
+	void analyzeCapture				(FSK_CANDIDATE & candidate);
+
+public:
+
+	ccFskDetector					(CC1101 & radio) : _radio (radio) {}
+
+	bool start						(uint32_t listenMs = CCDETECT_DEFAULT_LISTEN_MS);	// False if a sweep is running
+	bool loop						();							// One step, false when the sweep is over
+	void stop						();							// Aborts the sweep, restores the configuration
+
+	bool isRunning					() const	{ return _current >= 0; }
+	bool isDetected					() const	{ return (_best >= 0) && (_candidates [_best].nbMatches >= CCDETECT_MIN_MATCHES); }
+
+	const FSK_CANDIDATE * getBest	() const	{ return (_best < 0) ? nullptr : &_candidates [_best]; }
+	uint32_t getScanDurationMs		() const	{ return _scanMs; }
+
+	static void findSyncWords		(const uint8_t * data, uint16_t nbBits, FSK_SYNC_VOTES & votes);
+
+	static uint32_t computeDataRate	(uint32_t baud, uint8_t & drateE, uint8_t & drateM);
+	static uint32_t computeDeviation	(uint32_t deviationHz, uint8_t & deviatn);
+	static uint32_t computeChannelBw	(uint32_t bandwidthHz, uint8_t & chanBw);
+
+	virtual size_t printTo			(Print & p) const override;
+};
+
+}
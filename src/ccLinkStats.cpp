@@ -0,0 +1,81 @@
+//************************************************************************************************************************
+// ccLinkStats.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include "ccLinkStats.h"
+
+
+namespace cc1101 {
+
+//========================================================================================================================
+// avg += (sample - avg) / 2^CCLINKSTATS_EWMA_SHIFT, sample and avg in fixed point
+//========================================================================================================================
+template <typename T>
+static inline T ewma (T avg, int32_t sample)
+{
+	return avg + (T) ((sample - (int32_t) avg) >> CCLINKSTATS_EWMA_SHIFT);
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+const LINK_STATS * ccLinkStats :: find (uint8_t address) const
+{
+	for (uint8_t i = 0; i < _nbSenders; i++) {
+		if (_senders [i].address == address) return &_senders [i];
+	}
+	return nullptr;
+}
+
+//========================================================================================================================
+// Update the statistics of the packet sender
+//========================================================================================================================
+void ccLinkStats :: update (const CCPACKET & packet, int16_t rssiDbm, uint32_t nowMs)
+{
+	if (!packet.crc_ok) {
+		_nbCrcErrors++;												// Unknown sender
+		return;
+	}
+
+	LINK_STATS * stats = const_cast <LINK_STATS *> (find (packet.address));
+
+	if (stats == nullptr) {
+
+		if (_nbSenders < CCLINKSTATS_MAX_SENDERS) {
+			stats = &_senders [_nbSenders++];
+		}
+		else {
+			// Table full => replace the least recently heard sender
+			stats = &_senders [0];
+			for (uint8_t i = 1; i < _nbSenders; i++) {
+				if (nowMs - _senders [i].lastArrivalMs > nowMs - stats->lastArrivalMs) stats = &_senders [i];
+			}
+		}
+
+		*stats = LINK_STATS ();
+		stats->address		= packet.address;
+		stats->rssiAvg		= rssiDbm * (1 << CCLINKSTATS_FIXED_SHIFT);
+		stats->lqiAvg		= packet.lqi << CCLINKSTATS_FIXED_SHIFT;
+	}
+	else {
+		stats->rssiAvg		= ewma (stats->rssiAvg,		rssiDbm * (1 << CCLINKSTATS_FIXED_SHIFT));
+		stats->lqiAvg		= ewma (stats->lqiAvg,		packet.lqi << CCLINKSTATS_FIXED_SHIFT);
+
+		int32_t interval = (nowMs - stats->lastArrivalMs) << CCLINKSTATS_FIXED_SHIFT;
+		if (stats->nbPackets == 1) {
+			stats->intervalAvgMs = interval;
+		}
+		else {
+			int32_t deviation = interval - (int32_t) stats->intervalAvgMs;
+			stats->jitterAvgMs	 = ewma (stats->jitterAvgMs,	(deviation < 0) ? -deviation : deviation);
+			stats->intervalAvgMs = ewma (stats->intervalAvgMs,	interval);
+		}
+	}
+
+	stats->nbPackets++;
+	stats->lastArrivalMs = nowMs;
+}
+
+}
@@ -0,0 +1,68 @@
+//************************************************************************************************************************
+// ccLinkStats.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include "ccPacket.h"
+
+
+namespace cc1101 {
+
+#define CCLINKSTATS_MAX_SENDERS			8							// Bounded table, the least recently heard sender is evicted
+#define CCLINKSTATS_EWMA_SHIFT			3							// EWMA weight = 1/8
+#define CCLINKSTATS_FIXED_SHIFT			4							// Averages are stored in 1/16th of unit
+
+
+/**
+ * Link quality statistics of one sender
+ */
+struct LINK_STATS
+{
+	uint8_t		address			= 0;
+	uint32_t	nbPackets		= 0;
+	uint32_t	lastArrivalMs	= 0;
+
+	int16_t		rssiAvg			= 0;								// EWMA of the RSSI in dBm (fixed point)
+	uint16_t	lqiAvg			= 0;								// EWMA of the LQI (fixed point, the lower the better)
+	uint32_t	intervalAvgMs	= 0;								// EWMA of the inter-arrival time (fixed point)
+	uint32_t	jitterAvgMs		= 0;								// EWMA of the inter-arrival time deviation (fixed point)
+
+	int16_t  getRssiDbm			() const	{ return rssiAvg >> CCLINKSTATS_FIXED_SHIFT;		}
+	uint8_t  getLqi				() const	{ return lqiAvg >> CCLINKSTATS_FIXED_SHIFT;			}
+	uint32_t getIntervalMs		() const	{ return intervalAvgMs >> CCLINKSTATS_FIXED_SHIFT;	}
+	uint32_t getJitterMs		() const	{ return jitterAvgMs >> CCLINKSTATS_FIXED_SHIFT;	}
+};
+
+
+/**
+ * Class: ccLinkStats
+ *
+ * Description:
+ * Per sender address link quality table (no allocation), updated with each received packet so that the application
+ * can adapt its TX power or data rate. The address of a frame with a bad CRC can't be trusted: such frames are only
+ * counted, apart from the senders
+ */
+class ccLinkStats
+{
+private:
+
+	LINK_STATS	_senders [CCLINKSTATS_MAX_SENDERS];
+	uint8_t		_nbSenders		= 0;
+	uint32_t	_nbCrcErrors	= 0;
+
+public:
+
+	void update						(const CCPACKET & packet, int16_t rssiDbm, uint32_t nowMs);
+	void reset						()								{ _nbSenders = 0; _nbCrcErrors = 0; }
+
+	const LINK_STATS * find			(uint8_t address) const;
+
+	uint8_t size					() const						{ return _nbSenders;		}
+	uint32_t getNbCrcErrors			() const						{ return _nbCrcErrors;		}
+	const LINK_STATS & operator[]	(uint8_t i) const				{ return _senders [i];		}
+};
+
+}
@@ -0,0 +1,82 @@
+//************************************************************************************************************************
+// ccOokRowDecoder.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include "ccOokRowDecoder.h"
+
+
+namespace cc1101 {
+
+//========================================================================================================================
+//
+//========================================================================================================================
+size_t OOK_ROW_EVENT :: printTo (Print & p) const
+{
+	static const char hex [] = "0123456789abcdef";
+
+	size_t n = 0;
+	n += p.print (name);
+	n += p.print (F(" {"));
+	n += p.print ((int) nbBits);
+	n += p.print ('}');
+	for (uint16_t i = 0; i < (nbBits + 7) / 8; i++) {
+		n += p.print (' ');
+		n += p.print (hex [row [i] >> 4]);
+		n += p.print (hex [row [i] & 0x0F]);
+	}
+	n += p.print (F(" x"));
+	n += p.print ((int) nbRepeats);
+	return n;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool ccOokRowDecoder :: isValid (const ccBitBuffer & bits, uint8_t row) const
+{
+	uint16_t nbBits = bits.getNbBits (row);
+
+	if ((nbBits < _params.minBits) || (nbBits > _params.maxBits) || (nbBits < _params.prefixBits)) return false;
+
+	for (uint8_t i = 0; i < _params.prefixBits; i++) {
+		bool expected = (_params.prefix [i >> 3] >> (7 - (i & 7))) & 1;
+		if (bits.getBit (row, i) != expected) return false;
+	}
+	return true;
+}
+
+//========================================================================================================================
+// Most repeated valid row (the first one on equality)
+//========================================================================================================================
+const ccDecodedEvent * ccOokRowDecoder :: decode (const ccBitBuffer & bits)
+{
+	int8_t best			= -1;
+	uint8_t bestRepeats	= 0;
+
+	for (uint8_t i = 0; i < bits.getNbRows (); i++) {
+		if (!isValid (bits, i)) continue;
+
+		uint8_t nbRepeats = 0;
+		for (uint8_t j = 0; j < bits.getNbRows (); j++) {
+			if ((bits.getNbBits (j) == bits.getNbBits (i)) &&
+				(memcmp (bits.getRow (j), bits.getRow (i), (bits.getNbBits (i) + 7) / 8) == 0)) nbRepeats++;
+		}
+		if (nbRepeats > bestRepeats) {
+			best		= i;
+			bestRepeats	= nbRepeats;
+		}
+	}
+
+	if ((best < 0) || (bestRepeats < _params.minRepeats)) return nullptr;
+
+	_event.name			= _name;
+	_event.nbBits		= bits.getNbBits (best);
+	_event.nbRepeats	= bestRepeats;
+	memcpy (_event.row, bits.getRow (best), (_event.nbBits + 7) / 8);
+
+	return &_event;
+}
+
+}
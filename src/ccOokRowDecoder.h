@@ -0,0 +1,82 @@
+//************************************************************************************************************************
+// ccOokRowDecoder.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include "ccProtocolDecoder.h"
+
+
+namespace cc1101 {
+
+#define CCOOKROW_PREFIX_LEN				4							// Prefix bytes (32 bits max)
+
+
+/**
+ * Row filter of a generic OOK sensor (rtl_433 flex keys bits>=, bits<=, repeats>= and a match on the first bits)
+ */
+struct CCOOKROW_PARAMS
+{
+	uint16_t	minBits							= 1;
+	uint16_t	maxBits							= CCBITS_ROW_BYTES * 8;
+	uint8_t		minRepeats						= 1;				// Identical rows of the message
+	uint8_t		prefix [CCOOKROW_PREFIX_LEN]	= {0};				// First bits of the row, MSB first (sensor id, preamble)
+	uint8_t		prefixBits						= 0;
+};
+
+
+/**
+ * Row of a generic OOK sensor
+ */
+struct OOK_ROW_EVENT : public ccDecodedEvent
+{
+	static constexpr uint8_t TYPE = CCEVENT_OOK_ROW;
+
+	const char *	name						= nullptr;
+	uint8_t			row [CCBITS_ROW_BYTES]		= {0};
+	uint16_t		nbBits						= 0;
+	uint8_t			nbRepeats					= 0;
+
+	OOK_ROW_EVENT						() : ccDecodedEvent (TYPE) {}
+
+	virtual size_t printTo				(Print & p) const override;	// "name {nbBits} hex xN"
+};
+
+
+/**
+ * Class: ccOokRowDecoder
+ *
+ * Description:
+ * Generic OOK sensor module of the ccDecoderRegistry: the rows demodulated by the flex decoders are filtered by bit
+ * count and prefix, the most repeated valid row is notified. No packet decoding (acceptsLength is always false).
+ */
+class ccOokRowDecoder : public ccProtocolDecoder
+{
+private:
+
+	const char *	_name;
+	CCOOKROW_PARAMS	_params;
+	OOK_ROW_EVENT	_event;
+
+private:
+
+	bool isValid						(const ccBitBuffer & bits, uint8_t row) const;
+
+public:
+
+	ccOokRowDecoder						(const char * name, const CCOOKROW_PARAMS & params) : _name (name), _params (params) {}
+
+	const CCOOKROW_PARAMS & getParams	() const					{ return _params;	}
+
+	// ccProtocolDecoder
+	virtual const char * getName		() const override			{ return _name;		}
+	virtual bool acceptsLength			(uint8_t) const override	{ return false;	}
+	virtual bool acceptsBits			() const override			{ return true;		}
+
+	virtual const ccDecodedEvent * decode	(const CCPACKET &) override	{ return nullptr; }
+	virtual const ccDecodedEvent * decode	(const ccBitBuffer & bits) override;
+};
+
+}
@@ -9,71 +9,20 @@
 
 #include <Common.h>
 
-#include "ccPacket.h"
+#include "ccBasicPacket.h"
+#include "ccPacketParser.h"
 
 using namespace corex;
 
 
 namespace cc1101 {
 
-//========================================================================================================================
-//
-//========================================================================================================================
-bool CCPACKET :: _printTo (Print & p) const {
-
-	bool isValid = (0 < length) && (length <= CCPACKET_DATA_LEN);
-
-	if (isValid) {
-
-		p << F(PRINT_CCPACKET_DATALEN) << length << F(PRINT_CCPACKET_SEPARATOR);
-		p << F(PRINT_CCPACKET_ADDRESS) << n2hexstr (address) << F(PRINT_CCPACKET_SEPARATOR);
-
-		p << F(PRINT_CCPACKET_DATA_BEGIN) << n2hexstr (data[0]);
-		for (int i = 1; i < length; i++) {
-			p << F(PRINT_CCPACKET_SEPARATOR) << n2hexstr (data[i]);
-		}
-		p << F(PRINT_CCPACKET_DATA_END) << F(PRINT_CCPACKET_SEPARATOR);
-
-		p << (crc_ok ? F(PRINT_CCPACKET_CRC_OK) : F(PRINT_CCPACKET_CRC_NOK)) << F(PRINT_CCPACKET_SEPARATOR);
-
-		p << F(PRINT_CCPACKET_SIGNAL_STRENGTH) << n2hexstr (rssi) << F(PRINT_CCPACKET_SEPARATOR);
-		p << F(PRINT_CCPACKET_SIGNAL_QUALITY) << n2hexstr (lqi);
-	}
-
-	return isValid;
-}
-
-//========================================================================================================================
-//
-//========================================================================================================================
-size_t CCPACKET :: _printSize () const {
-
-	class PrintCounter : public Print {
-	public:
-		size_t _counter = 0;
-		virtual size_t write (uint8_t) override {
-			_counter++;
-			return _counter;
-		}
-	};
-
-	PrintCounter printCounter;
-	if (_printTo (printCounter)) {
-		return printCounter._counter;
-	}
-	return 0;
-}
-
 //========================================================================================================================
 //
 //========================================================================================================================
 size_t CCPACKET :: printTo (Print & p) const {
 
-	if (!_printTo (p)) {
-		Logln(F("WARNING !!! => No signal or Packet buffer is too small!!"));
-	}
-
-	return _printSize ();
+	return ccPacketPrinter (*this).printTo (p);
 }
 
 //========================================================================================================================
@@ -81,107 +30,28 @@ size_t CCPACKET :: printTo (Print & p) const {
 //========================================================================================================================
 bool CCPACKET :: parse (Stream & stream, Print & out) {
 
-	if (!StreamParser::checkNextStrInStream (stream, PRINT_CCPACKET_DATALEN))
-	{
-		out << F("Malformatted data length begin! ABORTED!!") << LN;
-		return false;
-	}
-	length = (uint8_t) stream.parseInt();
-
-	if (!StreamParser::checkNextStrInStream (stream, PRINT_CCPACKET_SEPARATOR))
-	{
-		out << F("Malformatted marks spaces! ABORTED!!") << LN;
-		goto ERROR;
-	}
-
-	if (!StreamParser::checkNextStrInStream (stream, PRINT_CCPACKET_ADDRESS))
-	{
-		out << F("Malformatted address begin! ABORTED!!") << LN;
-		return false;
-	}
-	address = StreamParser::hexstr2Int (stream);
-
-	if ((length < 1) || (CCPACKET_DATA_LEN < length))
-	{
-		out << F("Buffer length error! ABORTED!!") << LN;
-		goto ERROR;
-	}
-
-	if (!StreamParser::checkNextStrInStream (stream, PRINT_CCPACKET_SEPARATOR))
-	{
-		out << F("Malformatted marks spaces! ABORTED!!") << LN;
-		goto ERROR;
-	}
-
-	if (!StreamParser::checkNextStrInStream (stream, PRINT_CCPACKET_DATA_BEGIN))
-	{
-		out << F("Malformatted data begin! ABORTED!!") << LN;
-		return false;
-	}
+	// Reads what is available, without waiting: the stream must hold the whole text
+	ccPacketParser parser (*this);
 
-	data[0] = StreamParser::hexstr2Int (stream);
-	for (int i = 1; i < length ; i++) {
+	while (parser.getStatus () == CCPARSE_MORE) {
 
-		if (!StreamParser::checkNextStrInStream (stream, PRINT_CCPACKET_SEPARATOR))
-		{
-			out << F("Malformatted separator! ABORTED!!") << LN;
-			goto ERROR;
+		int c = stream.peek ();
+		if (c < 0) {
+			parser.flush ();
+			break;
 		}
 
-		data[i] = StreamParser::hexstr2Int (stream);
-	}
-
-	if (!StreamParser::checkNextStrInStream (stream, PRINT_CCPACKET_DATA_END))
-	{
-		out << F("Malformatted data end! ABORTED!!") << LN;
-		return false;
-	}
-
-	if (!StreamParser::checkNextStrInStream (stream, PRINT_CCPACKET_SEPARATOR))
-	{
-		out << F("Malformatted separator! ABORTED!!") << LN;
-		goto ERROR;
+		uint8_t b = c;
+		if (parser.feed (&b, 1) == 1) {
+			stream.read ();
+		}
 	}
 
-	if (!StreamParser::checkNextStrInStream (stream, PRINT_CCPACKET_CRC_OK) && !StreamParser::checkNextStrInStream (stream, PRINT_CCPACKET_CRC_NOK))
-	{
-		out << F("Malformatted CRC! ABORTED!!") << LN;
+	if (parser.getStatus () != CCPARSE_DONE) {
+		out << parser << LN;
 		return false;
 	}
-
-	if (!StreamParser::checkNextStrInStream (stream, PRINT_CCPACKET_SEPARATOR))
-	{
-		out << F("Malformatted separator! ABORTED!!") << LN;
-		goto ERROR;
-	}
-
-	if (!StreamParser::checkNextStrInStream (stream, PRINT_CCPACKET_SIGNAL_STRENGTH))
-	{
-		out << F("Malformatted signal strength! ABORTED!!") << LN;
-		goto ERROR;
-	}
-
-	rssi = StreamParser::hexstr2Int (stream);
-
-	if (!StreamParser::checkNextStrInStream (stream, PRINT_CCPACKET_SEPARATOR))
-	{
-		out << F("Malformatted separator! ABORTED!!") << LN;
-		goto ERROR;
-	}
-
-	if (!StreamParser::checkNextStrInStream (stream, PRINT_CCPACKET_SIGNAL_QUALITY))
-	{
-		out << F("Malformatted signal quality! ABORTED!!") << LN;
-		goto ERROR;
-	}
-
-	lqi = StreamParser::hexstr2Int (stream);
-
 	return true;
-
-ERROR:
-	length = 0;
-	return false;
 }
 
 //========================================================================================================================
@@ -196,6 +66,7 @@ CCPACKET & CCPACKET :: operator=(const CCPACKET & other) // copy assignment
 		crc_ok 	= other.crc_ok;
 		rssi	= other.rssi;
 		lqi		= other.lqi;
+		channel	= other.channel;
 
 		std::copy (other.data, other.data + other.length, data);
 	}
@@ -212,6 +83,7 @@ void CCPACKET :: reset ()
 	crc_ok 	= false;
 	rssi	= 0;
 	lqi		= 0;
+	channel	= 0;
 
 	memset (data, 0, CCPACKET_DATA_LEN * sizeof(uint8_t));
 }
@@ -54,10 +54,7 @@ class CCPACKET : public Printable
 	bool	crc_ok							= false;		// CRC OK flag
 	uint8_t rssi							= 0;			// Received Strength Signal Indication
 	uint8_t lqi								= 0;			// Link Quality Index
-
-private:
-	bool _printTo 			(Print & p) const;
-	size_t _printSize		() const;
+	uint8_t channel							= 0;			// Channel number (CHANNR) the packet was received on
 
  public:
 
@@ -0,0 +1,205 @@
+//************************************************************************************************************************
+// ccPacketCodec.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include "ccPacketCodec.h"
+
+
+namespace cc1101 {
+
+//========================================================================================================================
+//
+//========================================================================================================================
+static uint8_t * putTlv (uint8_t * p, uint8_t tag, uint32_t value, uint8_t len)
+{
+	*p++ = tag;
+	*p++ = len;
+	for (uint8_t i = 0; i < len; i++) {
+		*p++ = value >> (8 * i);
+	}
+	return p;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+static uint32_t getLittleEndian (const uint8_t * p, uint8_t len)
+{
+	uint32_t value = 0;
+	for (uint8_t i = 0; (i < len) && (i < 4); i++) {
+		value |= (uint32_t) p [i] << (8 * i);
+	}
+	return value;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+static uint8_t getTlvLen (const CCPACKET_META * meta)
+{
+	if (meta == nullptr) return 0;
+
+	return	((meta->timestampMs	> 0) ? 2 + 4 : 0) +
+			((meta->frequencyHz	> 0) ? 2 + 4 : 0) +
+			((meta->profile		> 0) ? 2 + 1 : 0) +
+			((meta->id			> 0) ? 2 + 1 : 0);
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+size_t ccPacketCodec :: getEncodedSize (const CCPACKET & packet, const CCPACKET_META * meta /*= nullptr*/)
+{
+	return CCCODEC_HEADER_LEN + packet.length + CCCODEC_STATUS_LEN + getTlvLen (meta);
+}
+
+//========================================================================================================================
+// Returns the record size (0 if the buffer is too small or the packet invalid)
+//========================================================================================================================
+size_t ccPacketCodec :: encode (const CCPACKET & packet, const CCPACKET_META * meta, uint8_t * buffer, size_t size)
+{
+	if ((packet.length > CCPACKET_DATA_LEN) || (getEncodedSize (packet, meta) > size)) return 0;
+
+	uint8_t * p = buffer;
+
+	*p++ = CCCODEC_VERSION;
+	*p++ = CCCODEC_FLAG_STATUS;
+	*p++ = packet.length;
+	*p++ = packet.address;
+	*p++ = getTlvLen (meta);
+
+	memcpy (p, packet.data, packet.length);
+	p += packet.length;
+
+	*p++ = packet.rssi;
+	*p++ = (packet.lqi & 0x7F) | (packet.crc_ok ? 0x80 : 0);
+	*p++ = packet.channel;
+
+	if (meta != nullptr) {
+		if (meta->timestampMs	> 0) p = putTlv (p, CCCODEC_TAG_TIMESTAMP,	meta->timestampMs,	4);
+		if (meta->frequencyHz	> 0) p = putTlv (p, CCCODEC_TAG_FREQUENCY,	meta->frequencyHz,	4);
+		if (meta->profile		> 0) p = putTlv (p, CCCODEC_TAG_PROFILE,	meta->profile,		1);
+		if (meta->id			> 0) p = putTlv (p, CCCODEC_TAG_ID,			meta->id,			1);
+	}
+
+	return p - buffer;
+}
+
+//========================================================================================================================
+// Returns the record size (0 if the record is invalid or truncated, the packet is then left unchanged)
+//========================================================================================================================
+size_t ccPacketCodec :: decode (const uint8_t * buffer, size_t size, CCPACKET & packet, CCPACKET_META * meta /*= nullptr*/)
+{
+	if ((size < CCCODEC_HEADER_LEN) || !isRecord (buffer, size)) return 0;
+
+	uint8_t flags	= buffer [1];
+	uint8_t length	= buffer [2];
+	uint8_t tlvLen	= buffer [4];
+	size_t statusLen = (flags & CCCODEC_FLAG_STATUS) ? CCCODEC_STATUS_LEN : 0;
+	size_t recordLen = CCCODEC_HEADER_LEN + length + statusLen + tlvLen;
+
+	if ((flags & ~CCCODEC_FLAG_STATUS) || (length > CCPACKET_DATA_LEN) || (recordLen > size)) return 0;
+
+	// Check the TLV chain before touching the packet
+	const uint8_t * tlv		= buffer + CCCODEC_HEADER_LEN + length + statusLen;
+	const uint8_t * tlvEnd	= tlv + tlvLen;
+	for (const uint8_t * t = tlv; t < tlvEnd; t += 2 + t [1]) {
+		if ((t + 2 > tlvEnd) || (t + 2 + t [1] > tlvEnd)) return 0;
+	}
+
+	const uint8_t * p = buffer + CCCODEC_HEADER_LEN;
+
+	packet.length	= length;
+	packet.address	= buffer [3];
+	memcpy (packet.data, p, length);
+	p += length;
+
+	if (statusLen > 0) {
+		packet.rssi		= p [0];
+		packet.lqi		= p [1] & 0x7F;
+		packet.crc_ok	= (p [1] & 0x80) != 0;
+		packet.channel	= p [2];
+	}
+	else {
+		packet.rssi		= 0;
+		packet.lqi		= 0;
+		packet.crc_ok	= false;
+		packet.channel	= 0;
+	}
+
+	if (meta != nullptr) {
+
+		*meta = CCPACKET_META ();
+
+		for (const uint8_t * t = tlv; t < tlvEnd; t += 2 + t [1]) {
+			switch (t [0]) {
+				case CCCODEC_TAG_TIMESTAMP:	meta->timestampMs	= getLittleEndian (t + 2, t [1]);	break;
+				case CCCODEC_TAG_FREQUENCY:	meta->frequencyHz	= getLittleEndian (t + 2, t [1]);	break;
+				case CCCODEC_TAG_PROFILE:	meta->profile		= getLittleEndian (t + 2, t [1]);	break;
+				case CCCODEC_TAG_ID:		meta->id			= getLittleEndian (t + 2, t [1]);	break;
+				default:					break;										// Newer revision
+			}
+		}
+	}
+
+	return recordLen;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+ccPacketBatchWriter :: ccPacketBatchWriter (uint8_t * buffer, size_t size)
+	: _buffer (buffer), _size (size)
+{
+	if (_size >= CCCODEC_BATCH_HEADER_LEN) {
+		_buffer [_pos++] = CCCODEC_BATCH_MAGIC;
+		_buffer [_pos++] = CCCODEC_VERSION;
+	}
+}
+
+//========================================================================================================================
+// False if the buffer is full
+//========================================================================================================================
+bool ccPacketBatchWriter :: add (const CCPACKET & packet, const CCPACKET_META * meta /*= nullptr*/)
+{
+	if (_pos < CCCODEC_BATCH_HEADER_LEN) return false;
+
+	size_t len = ccPacketCodec::encode (packet, meta, _buffer + _pos, _size - _pos);
+	if (len == 0) return false;
+
+	_pos += len;
+	_count++;
+	return true;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+ccPacketBatchReader :: ccPacketBatchReader (const uint8_t * buffer, size_t size)
+	: _buffer (buffer), _size (size)
+{
+	_isValid = (_size >= CCCODEC_BATCH_HEADER_LEN) && (_buffer [0] == CCCODEC_BATCH_MAGIC) &&
+			   ((_buffer [1] & CCCODEC_FORMAT_MASK) == (CCCODEC_VERSION & CCCODEC_FORMAT_MASK));
+	_pos = _isValid ? CCCODEC_BATCH_HEADER_LEN : _size;
+}
+
+//========================================================================================================================
+// False at the end of the batch or on an invalid record (isValid () is then false, getOffset () gives its position)
+//========================================================================================================================
+bool ccPacketBatchReader :: next (CCPACKET & packet, CCPACKET_META * meta /*= nullptr*/)
+{
+	if (!_isValid || isEnd ()) return false;
+
+	size_t len = ccPacketCodec::decode (_buffer + _pos, _size - _pos, packet, meta);
+	if (len == 0) {
+		_isValid = false;
+		return false;
+	}
+
+	_pos += len;
+	return true;
+}
+
+}
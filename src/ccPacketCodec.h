@@ -0,0 +1,128 @@
+//************************************************************************************************************************
+// ccPacketCodec.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include "ccPacket.h"
+
+
+namespace cc1101 {
+
+/**
+ * Binary packet record:
+ *
+ *   [version] [flags] [length] [address] [tlvLen] [data x length] ([rssi] [lqi | crc << 7] [channel]) [TLV x tlvLen]
+ *
+ * - version: CCCODEC_VERSION, above CCPACKET_DATA_LEN so that it never matches the length byte of the legacy
+ *   [length] [address] [data] files. The high nibble identifies the format, the low nibble is the revision: new
+ *   revisions may only add TLV tags (the unknown tags are skipped)
+ * - flags: CCCODEC_FLAG_STATUS => fixed radio status after the data, read at fixed offsets (fast path)
+ * - TLV: [tag] [len] [value, little endian], only for the metadata which are set
+ *
+ * Batch: [CCCODEC_BATCH_MAGIC] [version] followed by records up to the end of the buffer (streamable, no count)
+ */
+#define CCCODEC_VERSION					0xC1
+#define CCCODEC_FORMAT_MASK				0xF0
+#define CCCODEC_BATCH_MAGIC				0xCB
+#define CCCODEC_HEADER_LEN				5
+#define CCCODEC_BATCH_HEADER_LEN		2
+#define CCCODEC_STATUS_LEN				3
+
+#define CCCODEC_FLAG_STATUS				0x01
+
+#define CCCODEC_TAG_TIMESTAMP			0x01						// uint32 ms
+#define CCCODEC_TAG_FREQUENCY			0x02						// uint32 Hz
+#define CCCODEC_TAG_PROFILE				0x03						// uint8 radio profile (transceiver type)
+#define CCCODEC_TAG_ID					0x04						// uint8 storage id
+
+#define CCCODEC_MAX_TLV_LEN				(3 * (2 + 4) + (2 + 1))
+#define CCCODEC_MAX_RECORD_LEN			(CCCODEC_HEADER_LEN + CCPACKET_DATA_LEN + CCCODEC_STATUS_LEN + CCCODEC_MAX_TLV_LEN)
+
+
+/**
+ * Packet metadata not held by CCPACKET (0 => not set, not encoded)
+ */
+struct CCPACKET_META
+{
+	uint32_t	timestampMs		= 0;								// Reception time
+	uint32_t	frequencyHz		= 0;								// Carrier frequency
+	uint8_t		profile			= 0;								// Radio profile the packet was received with
+	uint8_t		id				= 0;								// Storage id
+};
+
+
+/**
+ * Class: ccPacketCodec
+ *
+ * Description:
+ * Versioned binary encoding of a packet, its radio status and its metadata (see the format above)
+ */
+class ccPacketCodec
+{
+public:
+
+	static size_t getEncodedSize		(const CCPACKET & packet, const CCPACKET_META * meta = nullptr);
+
+	static size_t encode				(const CCPACKET & packet, const CCPACKET_META * meta, uint8_t * buffer, size_t size);
+	static size_t decode				(const uint8_t * buffer, size_t size, CCPACKET & packet, CCPACKET_META * meta = nullptr);
+
+	static bool isRecord				(const uint8_t * buffer, size_t size)	{ return (size > 0) && ((buffer [0] & CCCODEC_FORMAT_MASK) == (CCCODEC_VERSION & CCCODEC_FORMAT_MASK)); }
+};
+
+
+/**
+ * Class: ccPacketBatchWriter
+ *
+ * Description:
+ * Encodes many packets one after the other in a caller buffer
+ */
+class ccPacketBatchWriter
+{
+private:
+
+	uint8_t *		_buffer;
+	size_t			_size;
+	size_t			_pos			= 0;
+	uint16_t		_count			= 0;
+
+public:
+
+	ccPacketBatchWriter					(uint8_t * buffer, size_t size);
+
+	bool add							(const CCPACKET & packet, const CCPACKET_META * meta = nullptr);
+
+	uint16_t count						() const		{ return _count;	}
+	size_t size							() const		{ return _pos;		}
+};
+
+
+/**
+ * Class: ccPacketBatchReader
+ *
+ * Description:
+ * Decodes the packets of a batch one by one, without copying the batch
+ */
+class ccPacketBatchReader
+{
+private:
+
+	const uint8_t *	_buffer;
+	size_t			_size;
+	size_t			_pos			= 0;
+	bool			_isValid		= false;
+
+public:
+
+	ccPacketBatchReader					(const uint8_t * buffer, size_t size);
+
+	bool next							(CCPACKET & packet, CCPACKET_META * meta = nullptr);
+
+	bool isValid						() const		{ return _isValid;					}
+	bool isEnd							() const		{ return _pos >= _size;				}
+	size_t getOffset					() const		{ return _pos;						}	// Of the next record (or of the error)
+};
+
+}
@@ -0,0 +1,256 @@
+//************************************************************************************************************************
+// ccPacketCompressor.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include "ccPacketCompressor.h"
+
+
+namespace cc1101 {
+
+#define CCLZ_NO_POS						0xFF
+
+//========================================================================================================================
+//
+//========================================================================================================================
+static inline uint8_t hash3 (const uint8_t * p)
+{
+	return ((p [0] << 4) ^ (p [1] << 2) ^ p [2] ^ (p [0] >> 3)) & (CCLZ_HASH_SIZE - 1);
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool ccLzDecoder :: copyMatch (size_t offset, size_t length)
+{
+	if ((offset > _len) || (length > _capacity - _len)) {
+		_isError = true;
+		return false;
+	}
+
+	// Byte by byte: the source may overlap the destination (runs)
+	const uint8_t * src = _out + _len - offset;
+	uint8_t * dest = _out + _len;
+	for (size_t i = 0; i < length; i++) {
+		dest [i] = src [i];
+	}
+	_len += length;
+	return true;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool ccLzDecoder :: feed (uint8_t c)
+{
+	if (_isError) return false;
+
+	if (_nbTokens == 0) {											// Control byte
+		_flags		= c;
+		_nbTokens	= 8;
+		return true;
+	}
+
+	if ((_flags & 1) == 0) {										// Literal
+		if (_len >= _capacity) {
+			_isError = true;
+			return false;
+		}
+		_out [_len++] = c;
+	}
+	else if (_hasLongMatch) {
+		_hasLongMatch = false;
+		if (!copyMatch (_longMatch + 1, c + CCLZ_MIN_MATCH)) return false;
+	}
+	else if (c & CCLZ_SHORT_MATCH_FLAG) {
+		if (!copyMatch (((c >> 3) & 0x0F) + 1, (c & 0x07) + CCLZ_MIN_MATCH)) return false;
+	}
+	else {
+		_longMatch		= c;
+		_hasLongMatch	= true;
+		return true;												// Same token
+	}
+
+	_flags >>= 1;
+	_nbTokens--;
+	return true;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool ccLzDecoder :: feed (const uint8_t * data, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		if (!feed (data [i])) return false;
+	}
+	return true;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+size_t ccLzDecoder :: finish ()
+{
+	if (_hasLongMatch) _isError = true;								// Truncated match
+	return _isError ? 0 : _len;
+}
+
+//========================================================================================================================
+// Greedy parse: at each position the longest match of the hash chain (the nearest one on equal length), positions
+// inside a match are still chained
+//========================================================================================================================
+size_t ccPacketCompressor :: compress (const uint8_t * in, size_t len, uint8_t * out, size_t size)
+{
+	if ((len < CCLZ_MIN_MATCH) || (CCLZ_MAX_INPUT_LEN < len)) return 0;
+	if (size >= len) size = len - 1;								// Must be shorter
+
+	uint8_t head [CCLZ_HASH_SIZE];
+	uint8_t prev [CCLZ_MAX_INPUT_LEN];
+	memset (head, CCLZ_NO_POS, sizeof (head));
+
+	size_t pos		= 0;
+	size_t control	= 0;											// Index of the current control byte
+	uint8_t nbTokens	= 8;										// => a control byte is needed
+
+	size_t i = 0;
+	while (i < len) {
+
+		// Longest match in the chain
+		size_t bestLen = 0, bestOffset = 0;
+		if (i + CCLZ_MIN_MATCH <= len) {
+
+			size_t maxLen = len - i;
+			if (maxLen > CCLZ_LONG_MAX_MATCH) maxLen = CCLZ_LONG_MAX_MATCH;
+
+			uint8_t h = hash3 (in + i);
+			uint8_t candidate = head [h];
+			for (uint8_t depth = 0; (candidate != CCLZ_NO_POS) && (depth < CCLZ_MAX_CHAIN); depth++) {
+
+				size_t offset = i - candidate;
+				if (offset > CCLZ_LONG_MAX_OFFSET) break;			// Older candidates are even further
+
+				size_t n = 0;
+				while ((n < maxLen) && (in [candidate + n] == in [i + n])) n++;
+				if (n > bestLen) {
+					bestLen		= n;
+					bestOffset	= offset;
+					if (n == maxLen) break;
+				}
+				candidate = prev [candidate];
+			}
+		}
+
+		if (nbTokens == 8) {										// New group
+			if (pos >= size) return 0;
+			control		= pos;
+			out [pos++]	= 0;
+			nbTokens	= 0;
+		}
+
+		size_t step = 1;
+		if (bestLen >= CCLZ_MIN_MATCH) {
+
+			out [control] |= (1 << nbTokens);
+
+			if ((bestOffset <= CCLZ_SHORT_MAX_OFFSET) && (bestLen <= CCLZ_SHORT_MAX_MATCH)) {
+				if (pos + 1 > size) return 0;
+				out [pos++] = CCLZ_SHORT_MATCH_FLAG | ((bestOffset - 1) << 3) | (bestLen - CCLZ_MIN_MATCH);
+			}
+			else {
+				if (pos + 2 > size) return 0;
+				out [pos++] = bestOffset - 1;
+				out [pos++] = bestLen - CCLZ_MIN_MATCH;
+			}
+			step = bestLen;
+		}
+		else {
+			if (pos + 1 > size) return 0;
+			out [pos++] = in [i];
+		}
+		nbTokens++;
+
+		// Chain the positions covered by the token
+		for (size_t end = i + step; i < end; i++) {
+			if (i + CCLZ_MIN_MATCH <= len) {
+				uint8_t h = hash3 (in + i);
+				prev [i] = head [h];
+				head [h] = i;
+			}
+		}
+	}
+
+	return pos;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+size_t ccPacketCompressor :: decompress (const uint8_t * in, size_t len, uint8_t * out, size_t size)
+{
+	ccLzDecoder decoder (out, size);
+	decoder.feed (in, len);
+	return decoder.finish ();
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool ccPacketCompressor :: pack (const ccPacketView & packet, CCPACKET & packed)
+{
+	packed.reset ();
+	packed.address = packet.address;
+
+	// The payload is read in RAM once (it may be in flash)
+	uint8_t payload [CCPACKET_DATA_LEN];
+	if (packet.length > sizeof (payload)) return false;
+	packet.copyTo (payload, 0, packet.length);
+
+	size_t len = compress (payload, packet.length, packed.data + CCLZ_HEADER_LEN, CCPACKET_DATA_LEN - CCLZ_HEADER_LEN);
+	if (len > 0) {
+		packed.data [0]	= CCLZ_HEADER_COMPRESSED;
+		packed.length	= CCLZ_HEADER_LEN + len;
+		return true;
+	}
+
+	if (packet.length + CCLZ_HEADER_LEN > CCPACKET_DATA_LEN) return false;
+
+	packed.data [0] = CCLZ_HEADER_RAW;
+	memcpy (packed.data + CCLZ_HEADER_LEN, payload, packet.length);
+	packed.length = CCLZ_HEADER_LEN + packet.length;
+	return true;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool ccPacketCompressor :: unpack (CCPACKET & packet)
+{
+	if (packet.length < CCLZ_HEADER_LEN) return false;
+
+	const uint8_t * payload	= packet.data + CCLZ_HEADER_LEN;
+	size_t len				= packet.length - CCLZ_HEADER_LEN;
+
+	switch (packet.data [0]) {
+
+		case CCLZ_HEADER_RAW:
+			memmove (packet.data, payload, len);
+			packet.length = len;
+			return true;
+
+		case CCLZ_HEADER_COMPRESSED: {
+			uint8_t buffer [CCPACKET_DATA_LEN];
+			size_t n = decompress (payload, len, buffer, sizeof (buffer));
+			if (n == 0) break;
+			memcpy (packet.data, buffer, n);
+			packet.length = n;
+			return true;
+		}
+	}
+
+	packet.length = 0;												// Unknown header or malformatted
+	return false;
+}
+
+}
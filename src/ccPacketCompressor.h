@@ -0,0 +1,101 @@
+//************************************************************************************************************************
+// ccPacketCompressor.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include "ccBasicPacket.h"
+
+
+namespace cc1101 {
+
+/**
+ * Compressed payload (LZSS, byte aligned):
+ *
+ *   [control] [token x 8] [control] [token x 8] ...
+ *
+ * - control: one bit per token, LSB first: 0 => literal byte, 1 => match (copy of previous output bytes)
+ * - short match: 1oooolll       => offset 1..16, length 3..10 (1 byte)
+ * - long match:  0ooooooo llllllll => offset 1..128, length 3..258 (2 bytes)
+ *
+ * The window is the packet itself (the last 128 bytes): decompressing only needs the output buffer.
+ *
+ * Packet header: first payload byte when the compression is enabled, so that compressed and uncompressed packets can be
+ * mixed (a packet is sent uncompressed when the compression doesn't make it shorter)
+ */
+#define CCLZ_HEADER_RAW					0x00
+#define CCLZ_HEADER_COMPRESSED			0x01
+#define CCLZ_HEADER_LEN					1
+
+#define CCLZ_MIN_MATCH					3
+#define CCLZ_SHORT_MAX_OFFSET			16
+#define CCLZ_SHORT_MAX_MATCH			(CCLZ_MIN_MATCH + 7)
+#define CCLZ_LONG_MAX_OFFSET			128
+#define CCLZ_LONG_MAX_MATCH				(CCLZ_MIN_MATCH + 255)
+#define CCLZ_SHORT_MATCH_FLAG			0x80
+
+#define CCLZ_MAX_INPUT_LEN				254							// Positions are bytes (0xFF = none)
+#define CCLZ_HASH_SIZE					64							// Hash chain heads (3 bytes hash)
+#define CCLZ_MAX_CHAIN					8							// Candidates tried per position
+
+
+/**
+ * Class: ccLzDecoder
+ *
+ * Description:
+ * Streaming decompression: the compressed bytes are fed in any number of chunks, the output is written in a caller
+ * buffer of bounded capacity (no other memory). A malformatted stream (offset before the output start, output above
+ * the capacity) is an error, never an overflow.
+ */
+class ccLzDecoder
+{
+private:
+
+	uint8_t *		_out;
+	size_t			_capacity;
+	size_t			_len			= 0;
+
+	uint8_t			_flags			= 0;							// Control bits of the current group
+	uint8_t			_nbTokens		= 0;							// Tokens left in the current group
+	uint8_t			_longMatch		= 0;							// 1st byte of a long match
+	bool			_hasLongMatch	= false;
+	bool			_isError		= false;
+
+private:
+
+	bool copyMatch					(size_t offset, size_t length);
+
+public:
+
+	ccLzDecoder						(uint8_t * out, size_t capacity) : _out (out), _capacity (capacity) {}
+
+	bool feed						(uint8_t c);
+	bool feed						(const uint8_t * data, size_t len);
+	size_t finish					();							// Output length, 0 on error
+
+	size_t size						() const		{ return _len;		}
+	bool isError					() const		{ return _isError;	}
+};
+
+
+/**
+ * Class: ccPacketCompressor
+ *
+ * Description:
+ * Lightweight compression of the variable length packets payloads, to cut their airtime. Greedy LZSS with 3 bytes hash
+ * chains: a few hundred bytes of stack, no allocation.
+ */
+class ccPacketCompressor
+{
+public:
+
+	static size_t compress			(const uint8_t * in, size_t len, uint8_t * out, size_t size);	// 0 if not shorter
+	static size_t decompress		(const uint8_t * in, size_t len, uint8_t * out, size_t size);	// 0 on error
+
+	static bool pack				(const ccPacketView & packet, CCPACKET & packed);	// Header + payload (compressed if shorter)
+	static bool unpack				(CCPACKET & packet);								// In place, false if malformatted
+};
+
+}
@@ -0,0 +1,80 @@
+//************************************************************************************************************************
+// ccPacketDeduplicator.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include "ccPacketDeduplicator.h"
+
+
+namespace cc1101 {
+
+//========================================================================================================================
+// FNV-1a hash of the address, length and payload of the packet (never 0, reserved for empty slots)
+//========================================================================================================================
+uint32_t ccPacketDeduplicator :: hash (const CCPACKET & packet)
+{
+	uint32_t h = 2166136261UL;
+
+	h = (h ^ packet.address) * 16777619UL;
+	h = (h ^ packet.length) * 16777619UL;
+	for (int i = 0; i < packet.length; i++) {
+		h = (h ^ packet.data[i]) * 16777619UL;
+	}
+
+	return (h == 0) ? 1 : h;
+}
+
+//========================================================================================================================
+// Returns the number of copies of this packet received since its first copy, within the time window: 1 means it is a
+// new packet (the window isn't extended by the copies, only the repeat counter is)
+//========================================================================================================================
+uint8_t ccPacketDeduplicator :: filter (const CCPACKET & packet, uint32_t nowMs)
+{
+	if (_windowMs == 0) return 1;									// Filter disabled
+
+	uint32_t h = hash (packet);
+	uint8_t slot = h & (CCPACKET_DEDUP_SLOTS - 1);
+
+	Entry * victim = nullptr;
+
+	for (uint8_t probe = 0; probe < CCPACKET_DEDUP_MAX_PROBES; probe++) {
+
+		Entry & entry = _entries [(slot + probe) & (CCPACKET_DEDUP_SLOTS - 1)];
+
+		if (isExpired (entry, nowMs)) {
+			if (victim == nullptr) victim = &entry;					// First free slot
+		}
+		else if (entry.hash == h) {
+			if (entry.repeats < 0xFF) entry.repeats++;
+			return entry.repeats;
+		}
+	}
+
+	if (victim == nullptr) {
+		// No free slot in the probe sequence => evict the oldest entry
+		victim = &_entries [slot];
+		for (uint8_t probe = 1; probe < CCPACKET_DEDUP_MAX_PROBES; probe++) {
+			Entry & entry = _entries [(slot + probe) & (CCPACKET_DEDUP_SLOTS - 1)];
+			if (nowMs - entry.firstSeenMs > nowMs - victim->firstSeenMs) victim = &entry;
+		}
+	}
+
+	victim->hash		= h;
+	victim->firstSeenMs	= nowMs;
+	victim->repeats		= 1;
+
+	return 1;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccPacketDeduplicator :: reset ()
+{
+	for (Entry & entry : _entries) {
+		entry = Entry ();
+	}
+}
+
+}
@@ -0,0 +1,58 @@
+//************************************************************************************************************************
+// ccPacketDeduplicator.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include "ccPacket.h"
+
+
+namespace cc1101 {
+
+#define CCPACKET_DEDUP_SLOTS			16							// Hash set size (must be a power of 2)
+#define CCPACKET_DEDUP_MAX_PROBES		4							// Bounded linear probing => O(1) per packet
+#define CCPACKET_DEDUP_WINDOW_MS		1000						// Suggested time window of a burst of copies (the filter is off by default)
+
+
+/**
+ * Class: ccPacketDeduplicator
+ *
+ * Description:
+ * Remotes (like the Delta Dore Tybox) send each command several times in a row. This fixed size hash set of
+ * (address, payload hash) keys recognizes the copies received within a time window measured from the first copy, so that
+ * consumers get each logical command only once along with its repeat count (a sensor repeating the same payload at a
+ * slower pace than the window is reported each time). No allocation, bounded probing.
+ */
+class ccPacketDeduplicator
+{
+private:
+
+	struct Entry {
+		uint32_t	hash		= 0;								// Address + payload hash (0 = empty slot)
+		uint32_t	firstSeenMs	= 0;								// Time of the first copy received (start of the window)
+		uint8_t		repeats		= 0;								// Number of copies received in the window
+	};
+
+	Entry		_entries [CCPACKET_DEDUP_SLOTS];
+	uint32_t	_windowMs;									// 0 = disabled
+
+private:
+
+	static uint32_t hash	(const CCPACKET & packet);
+
+	bool isExpired			(const Entry & entry, uint32_t nowMs) const	{ return (entry.hash == 0) || (nowMs - entry.firstSeenMs > _windowMs); }
+
+public:
+
+	ccPacketDeduplicator	(uint32_t windowMs = 0) : _windowMs (windowMs) {}
+
+	uint32_t getWindow		() const									{ return _windowMs; }
+	void setWindow			(uint32_t windowMs)							{ _windowMs = windowMs; }
+
+	uint8_t filter			(const CCPACKET & packet, uint32_t nowMs);
+	void reset				();
+};
+
+}
@@ -0,0 +1,422 @@
+//************************************************************************************************************************
+// ccPacketEngine.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include "ccPacketEngine.h"
+
+
+namespace cc1101 {
+
+// crcTable [k][v] = CRC (init 0) of the byte v followed by k zero bytes
+static const uint16_t crcTable [CCCRC16_SLICES][256] PROGMEM = {
+	{
+		0x0000, 0x8005, 0x800F, 0x000A, 0x801B, 0x001E, 0x0014, 0x8011,
+		0x8033, 0x0036, 0x003C, 0x8039, 0x0028, 0x802D, 0x8027, 0x0022,
+		0x8063, 0x0066, 0x006C, 0x8069, 0x0078, 0x807D, 0x8077, 0x0072,
+		0x0050, 0x8055, 0x805F, 0x005A, 0x804B, 0x004E, 0x0044, 0x8041,
+		0x80C3, 0x00C6, 0x00CC, 0x80C9, 0x00D8, 0x80DD, 0x80D7, 0x00D2,
+		0x00F0, 0x80F5, 0x80FF, 0x00FA, 0x80EB, 0x00EE, 0x00E4, 0x80E1,
+		0x00A0, 0x80A5, 0x80AF, 0x00AA, 0x80BB, 0x00BE, 0x00B4, 0x80B1,
+		0x8093, 0x0096, 0x009C, 0x8099, 0x0088, 0x808D, 0x8087, 0x0082,
+		0x8183, 0x0186, 0x018C, 0x8189, 0x0198, 0x819D, 0x8197, 0x0192,
+		0x01B0, 0x81B5, 0x81BF, 0x01BA, 0x81AB, 0x01AE, 0x01A4, 0x81A1,
+		0x01E0, 0x81E5, 0x81EF, 0x01EA, 0x81FB, 0x01FE, 0x01F4, 0x81F1,
+		0x81D3, 0x01D6, 0x01DC, 0x81D9, 0x01C8, 0x81CD, 0x81C7, 0x01C2,
+		0x0140, 0x8145, 0x814F, 0x014A, 0x815B, 0x015E, 0x0154, 0x8151,
+		0x8173, 0x0176, 0x017C, 0x8179, 0x0168, 0x816D, 0x8167, 0x0162,
+		0x8123, 0x0126, 0x012C, 0x8129, 0x0138, 0x813D, 0x8137, 0x0132,
+		0x0110, 0x8115, 0x811F, 0x011A, 0x810B, 0x010E, 0x0104, 0x8101,
+		0x8303, 0x0306, 0x030C, 0x8309, 0x0318, 0x831D, 0x8317, 0x0312,
+		0x0330, 0x8335, 0x833F, 0x033A, 0x832B, 0x032E, 0x0324, 0x8321,
+		0x0360, 0x8365, 0x836F, 0x036A, 0x837B, 0x037E, 0x0374, 0x8371,
+		0x8353, 0x0356, 0x035C, 0x8359, 0x0348, 0x834D, 0x8347, 0x0342,
+		0x03C0, 0x83C5, 0x83CF, 0x03CA, 0x83DB, 0x03DE, 0x03D4, 0x83D1,
+		0x83F3, 0x03F6, 0x03FC, 0x83F9, 0x03E8, 0x83ED, 0x83E7, 0x03E2,
+		0x83A3, 0x03A6, 0x03AC, 0x83A9, 0x03B8, 0x83BD, 0x83B7, 0x03B2,
+		0x0390, 0x8395, 0x839F, 0x039A, 0x838B, 0x038E, 0x0384, 0x8381,
+		0x0280, 0x8285, 0x828F, 0x028A, 0x829B, 0x029E, 0x0294, 0x8291,
+		0x82B3, 0x02B6, 0x02BC, 0x82B9, 0x02A8, 0x82AD, 0x82A7, 0x02A2,
+		0x82E3, 0x02E6, 0x02EC, 0x82E9, 0x02F8, 0x82FD, 0x82F7, 0x02F2,
+		0x02D0, 0x82D5, 0x82DF, 0x02DA, 0x82CB, 0x02CE, 0x02C4, 0x82C1,
+		0x8243, 0x0246, 0x024C, 0x8249, 0x0258, 0x825D, 0x8257, 0x0252,
+		0x0270, 0x8275, 0x827F, 0x027A, 0x826B, 0x026E, 0x0264, 0x8261,
+		0x0220, 0x8225, 0x822F, 0x022A, 0x823B, 0x023E, 0x0234, 0x8231,
+		0x8213, 0x0216, 0x021C, 0x8219, 0x0208, 0x820D, 0x8207, 0x0202,
+	},
+	{
+		0x0000, 0x8603, 0x8C03, 0x0A00, 0x9803, 0x1E00, 0x1400, 0x9203,
+		0xB003, 0x3600, 0x3C00, 0xBA03, 0x2800, 0xAE03, 0xA403, 0x2200,
+		0xE003, 0x6600, 0x6C00, 0xEA03, 0x7800, 0xFE03, 0xF403, 0x7200,
+		0x5000, 0xD603, 0xDC03, 0x5A00, 0xC803, 0x4E00, 0x4400, 0xC203,
+		0x4003, 0xC600, 0xCC00, 0x4A03, 0xD800, 0x5E03, 0x5403, 0xD200,
+		0xF000, 0x7603, 0x7C03, 0xFA00, 0x6803, 0xEE00, 0xE400, 0x6203,
+		0xA000, 0x2603, 0x2C03, 0xAA00, 0x3803, 0xBE00, 0xB400, 0x3203,
+		0x1003, 0x9600, 0x9C00, 0x1A03, 0x8800, 0x0E03, 0x0403, 0x8200,
+		0x8006, 0x0605, 0x0C05, 0x8A06, 0x1805, 0x9E06, 0x9406, 0x1205,
+		0x3005, 0xB606, 0xBC06, 0x3A05, 0xA806, 0x2E05, 0x2405, 0xA206,
+		0x6005, 0xE606, 0xEC06, 0x6A05, 0xF806, 0x7E05, 0x7405, 0xF206,
+		0xD006, 0x5605, 0x5C05, 0xDA06, 0x4805, 0xCE06, 0xC406, 0x4205,
+		0xC005, 0x4606, 0x4C06, 0xCA05, 0x5806, 0xDE05, 0xD405, 0x5206,
+		0x7006, 0xF605, 0xFC05, 0x7A06, 0xE805, 0x6E06, 0x6406, 0xE205,
+		0x2006, 0xA605, 0xAC05, 0x2A06, 0xB805, 0x3E06, 0x3406, 0xB205,
+		0x9005, 0x1606, 0x1C06, 0x9A05, 0x0806, 0x8E05, 0x8405, 0x0206,
+		0x8009, 0x060A, 0x0C0A, 0x8A09, 0x180A, 0x9E09, 0x9409, 0x120A,
+		0x300A, 0xB609, 0xBC09, 0x3A0A, 0xA809, 0x2E0A, 0x240A, 0xA209,
+		0x600A, 0xE609, 0xEC09, 0x6A0A, 0xF809, 0x7E0A, 0x740A, 0xF209,
+		0xD009, 0x560A, 0x5C0A, 0xDA09, 0x480A, 0xCE09, 0xC409, 0x420A,
+		0xC00A, 0x4609, 0x4C09, 0xCA0A, 0x5809, 0xDE0A, 0xD40A, 0x5209,
+		0x7009, 0xF60A, 0xFC0A, 0x7A09, 0xE80A, 0x6E09, 0x6409, 0xE20A,
+		0x2009, 0xA60A, 0xAC0A, 0x2A09, 0xB80A, 0x3E09, 0x3409, 0xB20A,
+		0x900A, 0x1609, 0x1C09, 0x9A0A, 0x0809, 0x8E0A, 0x840A, 0x0209,
+		0x000F, 0x860C, 0x8C0C, 0x0A0F, 0x980C, 0x1E0F, 0x140F, 0x920C,
+		0xB00C, 0x360F, 0x3C0F, 0xBA0C, 0x280F, 0xAE0C, 0xA40C, 0x220F,
+		0xE00C, 0x660F, 0x6C0F, 0xEA0C, 0x780F, 0xFE0C, 0xF40C, 0x720F,
+		0x500F, 0xD60C, 0xDC0C, 0x5A0F, 0xC80C, 0x4E0F, 0x440F, 0xC20C,
+		0x400C, 0xC60F, 0xCC0F, 0x4A0C, 0xD80F, 0x5E0C, 0x540C, 0xD20F,
+		0xF00F, 0x760C, 0x7C0C, 0xFA0F, 0x680C, 0xEE0F, 0xE40F, 0x620C,
+		0xA00F, 0x260C, 0x2C0C, 0xAA0F, 0x380C, 0xBE0F, 0xB40F, 0x320C,
+		0x100C, 0x960F, 0x9C0F, 0x1A0C, 0x880F, 0x0E0C, 0x040C, 0x820F,
+	},
+	{
+		0x0000, 0x8017, 0x802B, 0x003C, 0x8053, 0x0044, 0x0078, 0x806F,
+		0x80A3, 0x00B4, 0x0088, 0x809F, 0x00F0, 0x80E7, 0x80DB, 0x00CC,
+		0x8143, 0x0154, 0x0168, 0x817F, 0x0110, 0x8107, 0x813B, 0x012C,
+		0x01E0, 0x81F7, 0x81CB, 0x01DC, 0x81B3, 0x01A4, 0x0198, 0x818F,
+		0x8283, 0x0294, 0x02A8, 0x82BF, 0x02D0, 0x82C7, 0x82FB, 0x02EC,
+		0x0220, 0x8237, 0x820B, 0x021C, 0x8273, 0x0264, 0x0258, 0x824F,
+		0x03C0, 0x83D7, 0x83EB, 0x03FC, 0x8393, 0x0384, 0x03B8, 0x83AF,
+		0x8363, 0x0374, 0x0348, 0x835F, 0x0330, 0x8327, 0x831B, 0x030C,
+		0x8503, 0x0514, 0x0528, 0x853F, 0x0550, 0x8547, 0x857B, 0x056C,
+		0x05A0, 0x85B7, 0x858B, 0x059C, 0x85F3, 0x05E4, 0x05D8, 0x85CF,
+		0x0440, 0x8457, 0x846B, 0x047C, 0x8413, 0x0404, 0x0438, 0x842F,
+		0x84E3, 0x04F4, 0x04C8, 0x84DF, 0x04B0, 0x84A7, 0x849B, 0x048C,
+		0x0780, 0x8797, 0x87AB, 0x07BC, 0x87D3, 0x07C4, 0x07F8, 0x87EF,
+		0x8723, 0x0734, 0x0708, 0x871F, 0x0770, 0x8767, 0x875B, 0x074C,
+		0x86C3, 0x06D4, 0x06E8, 0x86FF, 0x0690, 0x8687, 0x86BB, 0x06AC,
+		0x0660, 0x8677, 0x864B, 0x065C, 0x8633, 0x0624, 0x0618, 0x860F,
+		0x8A03, 0x0A14, 0x0A28, 0x8A3F, 0x0A50, 0x8A47, 0x8A7B, 0x0A6C,
+		0x0AA0, 0x8AB7, 0x8A8B, 0x0A9C, 0x8AF3, 0x0AE4, 0x0AD8, 0x8ACF,
+		0x0B40, 0x8B57, 0x8B6B, 0x0B7C, 0x8B13, 0x0B04, 0x0B38, 0x8B2F,
+		0x8BE3, 0x0BF4, 0x0BC8, 0x8BDF, 0x0BB0, 0x8BA7, 0x8B9B, 0x0B8C,
+		0x0880, 0x8897, 0x88AB, 0x08BC, 0x88D3, 0x08C4, 0x08F8, 0x88EF,
+		0x8823, 0x0834, 0x0808, 0x881F, 0x0870, 0x8867, 0x885B, 0x084C,
+		0x89C3, 0x09D4, 0x09E8, 0x89FF, 0x0990, 0x8987, 0x89BB, 0x09AC,
+		0x0960, 0x8977, 0x894B, 0x095C, 0x8933, 0x0924, 0x0918, 0x890F,
+		0x0F00, 0x8F17, 0x8F2B, 0x0F3C, 0x8F53, 0x0F44, 0x0F78, 0x8F6F,
+		0x8FA3, 0x0FB4, 0x0F88, 0x8F9F, 0x0FF0, 0x8FE7, 0x8FDB, 0x0FCC,
+		0x8E43, 0x0E54, 0x0E68, 0x8E7F, 0x0E10, 0x8E07, 0x8E3B, 0x0E2C,
+		0x0EE0, 0x8EF7, 0x8ECB, 0x0EDC, 0x8EB3, 0x0EA4, 0x0E98, 0x8E8F,
+		0x8D83, 0x0D94, 0x0DA8, 0x8DBF, 0x0DD0, 0x8DC7, 0x8DFB, 0x0DEC,
+		0x0D20, 0x8D37, 0x8D0B, 0x0D1C, 0x8D73, 0x0D64, 0x0D58, 0x8D4F,
+		0x0CC0, 0x8CD7, 0x8CEB, 0x0CFC, 0x8C93, 0x0C84, 0x0CB8, 0x8CAF,
+		0x8C63, 0x0C74, 0x0C48, 0x8C5F, 0x0C30, 0x8C27, 0x8C1B, 0x0C0C,
+	},
+	{
+		0x0000, 0x9403, 0xA803, 0x3C00, 0xD003, 0x4400, 0x7800, 0xEC03,
+		0x2003, 0xB400, 0x8800, 0x1C03, 0xF000, 0x6403, 0x5803, 0xCC00,
+		0x4006, 0xD405, 0xE805, 0x7C06, 0x9005, 0x0406, 0x3806, 0xAC05,
+		0x6005, 0xF406, 0xC806, 0x5C05, 0xB006, 0x2405, 0x1805, 0x8C06,
+		0x800C, 0x140F, 0x280F, 0xBC0C, 0x500F, 0xC40C, 0xF80C, 0x6C0F,
+		0xA00F, 0x340C, 0x080C, 0x9C0F, 0x700C, 0xE40F, 0xD80F, 0x4C0C,
+		0xC00A, 0x5409, 0x6809, 0xFC0A, 0x1009, 0x840A, 0xB80A, 0x2C09,
+		0xE009, 0x740A, 0x480A, 0xDC09, 0x300A, 0xA409, 0x9809, 0x0C0A,
+		0x801D, 0x141E, 0x281E, 0xBC1D, 0x501E, 0xC41D, 0xF81D, 0x6C1E,
+		0xA01E, 0x341D, 0x081D, 0x9C1E, 0x701D, 0xE41E, 0xD81E, 0x4C1D,
+		0xC01B, 0x5418, 0x6818, 0xFC1B, 0x1018, 0x841B, 0xB81B, 0x2C18,
+		0xE018, 0x741B, 0x481B, 0xDC18, 0x301B, 0xA418, 0x9818, 0x0C1B,
+		0x0011, 0x9412, 0xA812, 0x3C11, 0xD012, 0x4411, 0x7811, 0xEC12,
+		0x2012, 0xB411, 0x8811, 0x1C12, 0xF011, 0x6412, 0x5812, 0xCC11,
+		0x4017, 0xD414, 0xE814, 0x7C17, 0x9014, 0x0417, 0x3817, 0xAC14,
+		0x6014, 0xF417, 0xC817, 0x5C14, 0xB017, 0x2414, 0x1814, 0x8C17,
+		0x803F, 0x143C, 0x283C, 0xBC3F, 0x503C, 0xC43F, 0xF83F, 0x6C3C,
+		0xA03C, 0x343F, 0x083F, 0x9C3C, 0x703F, 0xE43C, 0xD83C, 0x4C3F,
+		0xC039, 0x543A, 0x683A, 0xFC39, 0x103A, 0x8439, 0xB839, 0x2C3A,
+		0xE03A, 0x7439, 0x4839, 0xDC3A, 0x3039, 0xA43A, 0x983A, 0x0C39,
+		0x0033, 0x9430, 0xA830, 0x3C33, 0xD030, 0x4433, 0x7833, 0xEC30,
+		0x2030, 0xB433, 0x8833, 0x1C30, 0xF033, 0x6430, 0x5830, 0xCC33,
+		0x4035, 0xD436, 0xE836, 0x7C35, 0x9036, 0x0435, 0x3835, 0xAC36,
+		0x6036, 0xF435, 0xC835, 0x5C36, 0xB035, 0x2436, 0x1836, 0x8C35,
+		0x0022, 0x9421, 0xA821, 0x3C22, 0xD021, 0x4422, 0x7822, 0xEC21,
+		0x2021, 0xB422, 0x8822, 0x1C21, 0xF022, 0x6421, 0x5821, 0xCC22,
+		0x4024, 0xD427, 0xE827, 0x7C24, 0x9027, 0x0424, 0x3824, 0xAC27,
+		0x6027, 0xF424, 0xC824, 0x5C27, 0xB024, 0x2427, 0x1827, 0x8C24,
+		0x802E, 0x142D, 0x282D, 0xBC2E, 0x502D, 0xC42E, 0xF82E, 0x6C2D,
+		0xA02D, 0x342E, 0x082E, 0x9C2D, 0x702E, 0xE42D, 0xD82D, 0x4C2E,
+		0xC028, 0x542B, 0x682B, 0xFC28, 0x102B, 0x8428, 0xB828, 0x2C2B,
+		0xE02B, 0x7428, 0x4828, 0xDC2B, 0x3028, 0xA42B, 0x982B, 0x0C28,
+	},
+};
+
+// PN9 whitening bytes, from the all ones state
+static const uint8_t pn9Table [CCPN9_PERIOD] PROGMEM = {
+	0xFF, 0xE1, 0x1D, 0x9A, 0xED, 0x85, 0x33, 0x24, 0xEA, 0x7A, 0xD2, 0x39, 0x70, 0x97, 0x57, 0x0A,
+	0x54, 0x7D, 0x2D, 0xD8, 0x6D, 0x0D, 0xBA, 0x8F, 0x67, 0x59, 0xC7, 0xA2, 0xBF, 0x34, 0xCA, 0x18,
+	0x30, 0x53, 0x93, 0xDF, 0x92, 0xEC, 0xA7, 0x15, 0x8A, 0xDC, 0xF4, 0x86, 0x55, 0x4E, 0x18, 0x21,
+	0x40, 0xC4, 0xC4, 0xD5, 0xC6, 0x91, 0x8A, 0xCD, 0xE7, 0xD1, 0x4E, 0x09, 0x32, 0x17, 0xDF, 0x83,
+	0xFF, 0xF0, 0x0E, 0xCD, 0xF6, 0xC2, 0x19, 0x12, 0x75, 0x3D, 0xE9, 0x1C, 0xB8, 0xCB, 0x2B, 0x05,
+	0xAA, 0xBE, 0x16, 0xEC, 0xB6, 0x06, 0xDD, 0xC7, 0xB3, 0xAC, 0x63, 0xD1, 0x5F, 0x1A, 0x65, 0x0C,
+	0x98, 0xA9, 0xC9, 0x6F, 0x49, 0xF6, 0xD3, 0x0A, 0x45, 0x6E, 0x7A, 0xC3, 0x2A, 0x27, 0x8C, 0x10,
+	0x20, 0x62, 0xE2, 0x6A, 0xE3, 0x48, 0xC5, 0xE6, 0xF3, 0x68, 0xA7, 0x04, 0x99, 0x8B, 0xEF, 0xC1,
+	0x7F, 0x78, 0x87, 0x66, 0x7B, 0xE1, 0x0C, 0x89, 0xBA, 0x9E, 0x74, 0x0E, 0xDC, 0xE5, 0x95, 0x02,
+	0x55, 0x5F, 0x0B, 0x76, 0x5B, 0x83, 0xEE, 0xE3, 0x59, 0xD6, 0xB1, 0xE8, 0x2F, 0x8D, 0x32, 0x06,
+	0xCC, 0xD4, 0xE4, 0xB7, 0x24, 0xFB, 0x69, 0x85, 0x22, 0x37, 0xBD, 0x61, 0x95, 0x13, 0x46, 0x08,
+	0x10, 0x31, 0x71, 0xB5, 0x71, 0xA4, 0x62, 0xF3, 0x79, 0xB4, 0x53, 0x82, 0xCC, 0xC5, 0xF7, 0xE0,
+	0x3F, 0xBC, 0x43, 0xB3, 0xBD, 0x70, 0x86, 0x44, 0x5D, 0x4F, 0x3A, 0x07, 0xEE, 0xF2, 0x4A, 0x81,
+	0xAA, 0xAF, 0x05, 0xBB, 0xAD, 0x41, 0xF7, 0xF1, 0x2C, 0xEB, 0x58, 0xF4, 0x97, 0x46, 0x19, 0x03,
+	0x66, 0x6A, 0xF2, 0x5B, 0x92, 0xFD, 0xB4, 0x42, 0x91, 0x9B, 0xDE, 0xB0, 0xCA, 0x09, 0x23, 0x04,
+	0x88, 0x98, 0xB8, 0xDA, 0x38, 0x52, 0xB1, 0xF9, 0x3C, 0xDA, 0x29, 0x41, 0xE6, 0xE2, 0x7B, 0xF0,
+	0x1F, 0xDE, 0xA1, 0xD9, 0x5E, 0x38, 0x43, 0xA2, 0xAE, 0x27, 0x9D, 0x03, 0x77, 0x79, 0xA5, 0x40,
+	0xD5, 0xD7, 0x82, 0xDD, 0xD6, 0xA0, 0xFB, 0x78, 0x96, 0x75, 0x2C, 0xFA, 0x4B, 0xA3, 0x8C, 0x01,
+	0x33, 0x35, 0xF9, 0x2D, 0xC9, 0x7E, 0x5A, 0xA1, 0xC8, 0x4D, 0x6F, 0x58, 0xE5, 0x84, 0x11, 0x02,
+	0x44, 0x4C, 0x5C, 0x6D, 0x1C, 0xA9, 0xD8, 0x7C, 0x1E, 0xED, 0x94, 0x20, 0x73, 0xF1, 0x3D, 0xF8,
+	0x0F, 0xEF, 0xD0, 0x6C, 0x2F, 0x9C, 0x21, 0x51, 0xD7, 0x93, 0xCE, 0x81, 0xBB, 0xBC, 0x52, 0xA0,
+	0xEA, 0x6B, 0xC1, 0x6E, 0x6B, 0xD0, 0x7D, 0x3C, 0xCB, 0x3A, 0x16, 0xFD, 0xA5, 0x51, 0xC6, 0x80,
+	0x99, 0x9A, 0xFC, 0x96, 0x64, 0x3F, 0xAD, 0x50, 0xE4, 0xA6, 0x37, 0xAC, 0x72, 0xC2, 0x08, 0x01,
+	0x22, 0x26, 0xAE, 0x36, 0x8E, 0x54, 0x6C, 0x3E, 0x8F, 0x76, 0x4A, 0x90, 0xB9, 0xF8, 0x1E, 0xFC,
+	0x87, 0x77, 0x68, 0xB6, 0x17, 0xCE, 0x90, 0xA8, 0xEB, 0x49, 0xE7, 0xC0, 0x5D, 0x5E, 0x29, 0x50,
+	0xF5, 0xB5, 0x60, 0xB7, 0x35, 0xE8, 0x3E, 0x9E, 0x65, 0x1D, 0x8B, 0xFE, 0xD2, 0x28, 0x63, 0xC0,
+	0x4C, 0x4D, 0x7E, 0x4B, 0xB2, 0x9F, 0x56, 0x28, 0x72, 0xD3, 0x1B, 0x56, 0x39, 0x61, 0x84, 0x00,
+	0x11, 0x13, 0x57, 0x1B, 0x47, 0x2A, 0x36, 0x9F, 0x47, 0x3B, 0x25, 0xC8, 0x5C, 0x7C, 0x0F, 0xFE,
+	0xC3, 0x3B, 0x34, 0xDB, 0x0B, 0x67, 0x48, 0xD4, 0xF5, 0xA4, 0x73, 0xE0, 0x2E, 0xAF, 0x14, 0xA8,
+	0xFA, 0x5A, 0xB0, 0xDB, 0x1A, 0x74, 0x1F, 0xCF, 0xB2, 0x8E, 0x45, 0x7F, 0x69, 0x94, 0x31, 0x60,
+	0xA6, 0x26, 0xBF, 0x25, 0xD9, 0x4F, 0x2B, 0x14, 0xB9, 0xE9, 0x0D, 0xAB, 0x9C, 0x30, 0x42, 0x80,
+	0x88, 0x89, 0xAB, 0x8D, 0x23, 0x15, 0x9B, 0xCF, 0xA3, 0x9D, 0x12, 0x64, 0x2E, 0xBE, 0x07,
+};
+
+//========================================================================================================================
+//
+//========================================================================================================================
+static inline uint16_t crcLookup (uint8_t slice, uint8_t index)
+{
+	return pgm_read_word (&crcTable [slice][index]);
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccCrc16 :: update (uint8_t c)
+{
+	_crc = (_crc << 8) ^ crcLookup (0, (_crc >> 8) ^ c);
+}
+
+//========================================================================================================================
+// Slicing-by-4: the CRC is XORed in the first 2 bytes, then the 4 bytes are reduced with one lookup each
+//========================================================================================================================
+void ccCrc16 :: update (const uint8_t * data, size_t len)
+{
+	uint16_t crc = _crc;
+
+	while (len >= CCCRC16_SLICES) {
+		crc = crcLookup (3, data [0] ^ (crc >> 8))
+			^ crcLookup (2, data [1] ^ (crc & 0xFF))
+			^ crcLookup (1, data [2])
+			^ crcLookup (0, data [3]);
+		data	+= CCCRC16_SLICES;
+		len		-= CCCRC16_SLICES;
+	}
+
+	while (len-- > 0) {
+		crc = (crc << 8) ^ crcLookup (0, (crc >> 8) ^ *data++);
+	}
+
+	_crc = crc;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+uint16_t ccCrc16 :: compute (const uint8_t * data, size_t len)
+{
+	ccCrc16 crc;
+	crc.update (data, len);
+	return crc.get ();
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+uint16_t ccCrc16 :: updateBitwise (uint16_t crc, uint8_t c)
+{
+	for (uint8_t i = 0; i < 8; i++) {
+		if (((crc & 0x8000) >> 8) ^ (c & 0x80))	crc = (crc << 1) ^ CCCRC16_POLY;
+		else									crc = (crc << 1);
+		c <<= 1;
+	}
+	return crc;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+uint8_t ccPn9Whitening :: next ()
+{
+	uint8_t c = pgm_read_byte (pn9Table + _index);
+	if (++_index == CCPN9_PERIOD) _index = 0;
+	return c;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccPn9Whitening :: apply (uint8_t * data, size_t len)
+{
+	while (len > 0) {
+
+		// Up to the end of the period in one run
+		size_t n = CCPN9_PERIOD - _index;
+		if (n > len) n = len;
+
+		const uint8_t * pn9 = pn9Table + _index;
+		for (size_t i = 0; i < n; i++) {
+			data [i] ^= pgm_read_byte (pn9 + i);
+		}
+
+		data	+= n;
+		len		-= n;
+		_index	+= n;
+		if (_index == CCPN9_PERIOD) _index = 0;
+	}
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+uint8_t ccPn9Whitening :: stepBitwise (uint16_t & state)
+{
+	uint8_t c = state & 0xFF;
+	for (uint8_t i = 0; i < 8; i++) {
+		uint16_t bit = (state ^ (state >> 5)) & 1;
+		state = (state >> 1) | (bit << 8);
+	}
+	return c;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+size_t ccPacketEngine :: getFrameSize (uint8_t length, const CCFRAME_FORMAT & format)
+{
+	size_t len = (format.isVariableLength ? 1 : 0) + (format.isAddressCheck ? 1 : 0) + length + (format.isCrc ? CCCRC16_LEN : 0);
+	return format.isFec ? ccFecEncoder::getEncodedSize (len) : len;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+uint32_t ccPacketEngine :: getAirtimeUs (uint8_t length, const CCFRAME_FORMAT & format, uint32_t baud)
+{
+	if (baud == 0) return 0;
+
+	uint32_t nbBits = (CCFRAME_PREAMBLE_LEN + CCFRAME_SYNC_LEN + getFrameSize (length, format)) * 8;
+	return ((uint64_t) nbBits * 1000000UL + baud - 1) / baud;
+}
+
+//========================================================================================================================
+// Same order as the radio: CRC, whitening, FEC
+//========================================================================================================================
+size_t ccPacketEngine :: encode (const ccPacketView & packet, const CCFRAME_FORMAT & format, uint8_t * out, size_t size)
+{
+	size_t frameSize = getFrameSize (packet.length, format);
+	if ((frameSize > size) || (packet.length + (format.isAddressCheck ? 1 : 0) > 0xFF)) return 0;
+
+	uint8_t plain [CCFEC_MAX_INPUT_LEN];
+	uint8_t * frame = out;
+	if (format.isFec) {
+		if (packet.length > CCPACKET_DATA_LEN) return 0;
+		frame = plain;
+	}
+
+	size_t pos = 0;
+	if (format.isVariableLength)	frame [pos++] = packet.length + (format.isAddressCheck ? 1 : 0);
+	if (format.isAddressCheck)		frame [pos++] = packet.address;
+
+	packet.copyTo (frame + pos, 0, packet.length);
+	pos += packet.length;
+
+	if (format.isCrc) {
+		uint16_t crc = ccCrc16::compute (frame, pos);
+		frame [pos++] = crc >> 8;									// MSB first
+		frame [pos++] = crc & 0xFF;
+	}
+
+	if (format.isFec) {
+		pos = ccFecEncoder::appendTerminator (frame, pos, sizeof (plain));
+	}
+
+	if (format.isWhitening) {
+		ccPn9Whitening whitening;
+		whitening.apply (frame, pos);
+	}
+
+	if (format.isFec) {
+		pos = ccFecEncoder::encode (frame, pos, out, size);
+	}
+
+	return pos;
+}
+
+//========================================================================================================================
+// The frame is read only: the whitened bytes are de-whitened on the fly (after the FEC decoding in a local buffer).
+// A FEC frame needs the decoder of the caller (its survivors are too big for the stack)
+//========================================================================================================================
+bool ccPacketEngine :: decode (const uint8_t * frame, size_t len, const CCFRAME_FORMAT & format, CCPACKET & packet, ccViterbiDecoder * viterbiDecoder)
+{
+	packet.reset ();
+
+	uint8_t plain [CCFEC_MAX_INPUT_LEN];
+	if (format.isFec) {
+		if (viterbiDecoder == nullptr) return false;
+		if (!format.isVariableLength && (format.length == 0)) return false;	// The terminator length is unknown
+		len = viterbiDecoder->decode (frame, len, plain, sizeof (plain));
+		if (len == 0) return false;
+		frame = plain;
+	}
+
+	ccPn9Whitening whitening;
+	ccCrc16 crc;
+	size_t pos = 0;
+
+	auto read = [&] () -> uint8_t {
+		uint8_t c = frame [pos++];
+		return format.isWhitening ? (c ^ whitening.next ()) : c;
+	};
+
+	size_t headerLen	= (format.isVariableLength ? 1 : 0) + (format.isAddressCheck ? 1 : 0);
+	size_t crcLen		= format.isCrc ? CCCRC16_LEN : 0;
+	if (len < headerLen + crcLen) return false;
+
+	size_t dataLen = (format.length > 0) ? format.length : len - headerLen - crcLen;
+	if (format.isVariableLength) {
+		uint8_t c = read ();
+		crc.update (c);
+		if (c < (format.isAddressCheck ? 1 : 0)) return false;
+		dataLen = c - (format.isAddressCheck ? 1 : 0);
+	}
+	if ((headerLen + dataLen + crcLen > len) || (dataLen > CCPACKET_DATA_LEN)) return false;	// Truncated
+
+	if (format.isAddressCheck) {
+		packet.address = read ();
+		crc.update (packet.address);
+	}
+
+	for (size_t i = 0; i < dataLen; i++) {
+		packet.data [i] = read ();
+	}
+	crc.update (packet.data, dataLen);
+	packet.length = dataLen;
+
+	if (format.isCrc) {
+		uint16_t received = read () << 8;
+		received |= read ();
+		packet.crc_ok = (received == crc.get ());
+	}
+	else {
+		packet.crc_ok = true;
+	}
+
+	return true;
+}
+
+}
@@ -0,0 +1,118 @@
+//************************************************************************************************************************
+// ccPacketEngine.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include "ccBasicPacket.h"
+#include "ccFecCodec.h"
+
+
+namespace cc1101 {
+
+/**
+ * CC1101 packet engine algorithms (datasheet 15.1 and 15.3, DN502):
+ * - CRC-16: polynomial x^16 + x^15 + x^2 + 1 (0x8005), initialized to 0xFFFF, MSB first, no final XOR, computed over the
+ *   length byte, the address byte and the payload (check value of "123456789" = 0xAEE7)
+ * - Whitening: XOR with the PN9 sequence (x^9 + x^5 + 1, initialized to all ones, 8 LSBs used then 8 shifts), over
+ *   everything after the sync word, CRC included (the CRC is computed before whitening)
+ */
+#define CCCRC16_POLY					0x8005
+#define CCCRC16_INIT					0xFFFF
+#define CCCRC16_LEN						2
+#define CCCRC16_SLICES					4							// Slicing-by-4 tables (2 KB in flash)
+
+#define CCPN9_INIT						0x1FF
+#define CCPN9_PERIOD					511							// Bytes of the PN9 sequence before it repeats
+
+#define CCFRAME_PREAMBLE_LEN			4							// MDMCFG1.NUM_PREAMBLE of the transceiver profiles
+#define CCFRAME_SYNC_LEN				4							// 30/32 sync word bits: the 16 bits sync word sent twice
+
+
+/**
+ * Class: ccCrc16
+ *
+ * Description:
+ * Incremental CC1101 CRC-16: one table lookup per byte, 4 bytes per step with the slicing-by-4 tables (the bytes can be
+ * given in any number of chunks)
+ */
+class ccCrc16
+{
+private:
+
+	uint16_t	_crc			= CCCRC16_INIT;
+
+public:
+
+	void reset						()						{ _crc = CCCRC16_INIT; }
+
+	void update						(uint8_t c);
+	void update						(const uint8_t * data, size_t len);
+
+	uint16_t get					() const				{ return _crc; }
+
+	static uint16_t compute			(const uint8_t * data, size_t len);
+	static uint16_t updateBitwise	(uint16_t crc, uint8_t c);		// Reference algorithm of DN502 (no table)
+};
+
+
+/**
+ * Class: ccPn9Whitening
+ *
+ * Description:
+ * Incremental CC1101 data whitening: the 511 bytes period of the PN9 sequence is a table, whitening and de-whitening
+ * are the same XOR
+ */
+class ccPn9Whitening
+{
+private:
+
+	uint16_t	_index			= 0;								// Position in the PN9 byte sequence
+
+public:
+
+	void reset						()						{ _index = 0; }
+
+	uint8_t next					();
+	void apply						(uint8_t * data, size_t len);
+
+	static uint8_t stepBitwise		(uint16_t & state);				// Reference LFSR: 8 LSBs, then 8 shifts
+};
+
+
+/**
+ * On-air format of the bytes after the sync word (PKTCTRL0 / PKTCTRL1)
+ */
+struct CCFRAME_FORMAT
+{
+	bool		isVariableLength	= true;							// Length byte first
+	bool		isAddressCheck		= false;						// Address byte before the payload
+	bool		isCrc				= true;							// 2 CRC bytes after the payload
+	bool		isWhitening			= false;
+	bool		isFec				= false;						// FEC + interleaving, after the whitening
+	uint8_t		length				= 0;							// Fixed length payload (PKTLEN without the address), 0 = frame size
+};
+
+
+/**
+ * Class: ccPacketEngine
+ *
+ * Description:
+ * Software copy of the CC1101 packet handling: builds the bytes the radio sends after the sync word and checks received
+ * ones, for simulation, raw captures and the infinite packet length mode where the hardware can't help
+ */
+class ccPacketEngine
+{
+public:
+
+	static size_t getFrameSize		(uint8_t length, const CCFRAME_FORMAT & format);				// On air, after the sync word
+	static uint32_t getAirtimeUs	(uint8_t length, const CCFRAME_FORMAT & format, uint32_t baud);	// Preamble and sync word included
+
+	static size_t encode			(const ccPacketView & packet, const CCFRAME_FORMAT & format, uint8_t * out, size_t size);	// 0 if too small
+	static bool decode				(const uint8_t * frame, size_t len, const CCFRAME_FORMAT & format, CCPACKET & packet,
+									 ccViterbiDecoder * viterbiDecoder = nullptr);	// crc_ok set, false for a FEC frame without decoder
+};
+
+}
@@ -0,0 +1,493 @@
+//************************************************************************************************************************
+// ccPacketParser.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <Common.h>
+
+#include "ccPacketParser.h"
+
+
+namespace cc1101 {
+
+/**
+ * Parser steps, in the text order
+ */
+enum : uint8_t
+{
+	STEP_DATALEN_BEGIN = 0,
+	STEP_DATALEN,
+	STEP_ADDRESS_BEGIN,
+	STEP_ADDRESS,
+	STEP_DATA_BEGIN,
+	STEP_DATA,
+	STEP_DATA_END,
+	STEP_CRC,
+	STEP_SIGNAL_STRENGTH_BEGIN,
+	STEP_SIGNAL_STRENGTH,
+	STEP_SIGNAL_QUALITY_BEGIN,
+	STEP_SIGNAL_QUALITY,
+	STEP_DONE,
+	STEP_ERROR,
+};
+
+/**
+ * Batch parser states
+ */
+enum : uint8_t
+{
+	BATCH_LINE_BEGIN = 0,
+	BATCH_ID,
+	BATCH_PACKET,
+	BATCH_LINE_END,
+	BATCH_SKIP_LINE,
+};
+
+#define CCPARSE_NOT_A_DIGIT				0xFF
+
+// Character => digit value (hex and decimal), CCPARSE_NOT_A_DIGIT otherwise
+static const uint8_t digitTable [256] PROGMEM = {
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+static const char literalDatalenBegin	[] PROGMEM = PRINT_CCPACKET_DATALEN;
+static const char literalAddressBegin	[] PROGMEM = PRINT_CCPACKET_SEPARATOR PRINT_CCPACKET_ADDRESS;
+static const char literalDataBegin		[] PROGMEM = PRINT_CCPACKET_SEPARATOR PRINT_CCPACKET_DATA_BEGIN;
+static const char literalDataEnd		[] PROGMEM = PRINT_CCPACKET_DATA_END PRINT_CCPACKET_SEPARATOR;
+static const char literalCrcOk			[] PROGMEM = PRINT_CCPACKET_CRC_OK;
+static const char literalCrcNok			[] PROGMEM = PRINT_CCPACKET_CRC_NOK;
+static const char literalStrengthBegin	[] PROGMEM = PRINT_CCPACKET_SEPARATOR PRINT_CCPACKET_SIGNAL_STRENGTH;
+static const char literalQualityBegin	[] PROGMEM = PRINT_CCPACKET_SEPARATOR PRINT_CCPACKET_SIGNAL_QUALITY;
+
+//========================================================================================================================
+//
+//========================================================================================================================
+static inline uint8_t digitValue (uint8_t c)
+{
+	return pgm_read_byte (digitTable + c);
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+static inline bool isBlank (uint8_t c)
+{
+	return (c == ' ') || (c == '\t') || (c == '\r') || (c == '\n');
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccPacketParser :: reset ()
+{
+	_length			= 0;
+	_index			= 0;
+	_needSeparator	= false;
+	_offset			= 0;
+	_error			= CCPARSE_ERR_NONE;
+	_packet.length	= 0;
+
+	setStep (STEP_DATALEN_BEGIN);
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccPacketParser :: setStep (uint8_t step)
+{
+	_step		= step;
+	_matched	= 0;
+	_value		= 0;
+	_digits		= 0;
+
+	switch (step) {
+		case STEP_DATALEN_BEGIN:			_literal = literalDatalenBegin;		break;
+		case STEP_ADDRESS_BEGIN:			_literal = literalAddressBegin;		break;
+		case STEP_DATA_BEGIN:				_literal = literalDataBegin;		break;
+		case STEP_DATA_END:					_literal = literalDataEnd;			break;
+		case STEP_SIGNAL_STRENGTH_BEGIN:	_literal = literalStrengthBegin;	break;
+		case STEP_SIGNAL_QUALITY_BEGIN:		_literal = literalQualityBegin;		break;
+		default:							_literal = nullptr;					break;	// STEP_CRC: chosen on its first character
+	}
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool ccPacketParser :: fail (CCPARSE_ERRCODE error)
+{
+	_error			= error;
+	_step			= STEP_ERROR;
+	_packet.length	= 0;
+	return false;
+}
+
+//========================================================================================================================
+// Returns true when the character is consumed
+//========================================================================================================================
+bool ccPacketParser :: matchLiteral (uint8_t c, CCPARSE_ERRCODE error)
+{
+	if (c != (uint8_t) pgm_read_byte (_literal + _matched)) {
+		return fail (error);
+	}
+	if (pgm_read_byte (_literal + (++_matched)) == '\0') {
+		setStep (_step + 1);
+	}
+	return true;
+}
+
+//========================================================================================================================
+// Address, signal strength and signal quality
+//========================================================================================================================
+bool ccPacketParser :: parseHexField (uint8_t c, CCPARSE_ERRCODE error)
+{
+	uint8_t digit = digitValue (c);
+
+	if (digit == CCPARSE_NOT_A_DIGIT) {
+		if (_digits == 0) return fail (error);
+		endField ();
+		return false;												// The next step reads this character
+	}
+
+	_value = (_value << 4) | digit;
+	if (++_digits == CCPARSE_MAX_HEX_DIGITS) {
+		endField ();
+	}
+	return true;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccPacketParser :: endField ()
+{
+	switch (_step) {
+		case STEP_ADDRESS:			_packet.address	= _value;	break;
+		case STEP_SIGNAL_STRENGTH:	_packet.rssi	= _value;	break;
+		case STEP_SIGNAL_QUALITY:
+			_packet.lqi		= _value;
+			_packet.length	= _length;								// Complete
+			break;
+	}
+	setStep (_step + 1);
+}
+
+//========================================================================================================================
+// Hex bytes separated by PRINT_CCPACKET_SEPARATOR
+//========================================================================================================================
+bool ccPacketParser :: parseData (uint8_t c)
+{
+	if (_needSeparator) {
+		if (c != PRINT_CCPACKET_SEPARATOR [0]) return fail (CCPARSE_ERR_SEPARATOR);
+		_needSeparator = false;
+		return true;
+	}
+
+	uint8_t digit = digitValue (c);
+	bool consumed = (digit != CCPARSE_NOT_A_DIGIT);
+
+	if (consumed) {
+		_value = (_value << 4) | digit;
+		_digits++;
+	}
+	else if (_digits == 0) {
+		return fail (CCPARSE_ERR_DATA);
+	}
+
+	if (!consumed || (_digits == CCPARSE_MAX_HEX_DIGITS)) {
+
+		_packet.data [_index++] = _value;
+		_value	= 0;
+		_digits	= 0;
+
+		if (_index == _length) {
+			setStep (STEP_DATA_END);
+		}
+		else {
+			_needSeparator = true;
+			if (!consumed) return parseData (c);					// 1 digit byte: c is the separator
+		}
+	}
+	return consumed;
+}
+
+//========================================================================================================================
+// Returns true when the character is consumed
+//========================================================================================================================
+bool ccPacketParser :: step (uint8_t c)
+{
+	switch (_step) {
+
+		case STEP_DATALEN_BEGIN:
+			if ((_matched == 0) && isBlank (c)) return true;
+			return matchLiteral (c, CCPARSE_ERR_DATALEN_BEGIN);
+
+		case STEP_DATALEN: {
+			uint8_t digit = digitValue (c);
+			if (digit < 10) {
+				if (++_digits > CCPARSE_MAX_DATALEN_DIGITS) return fail (CCPARSE_ERR_DATALEN);
+				_value = _value * 10 + digit;
+				return true;
+			}
+			if ((_value < 1) || (CCPACKET_DATA_LEN < _value)) return fail (CCPARSE_ERR_DATALEN);
+			_length = _value;
+			setStep (STEP_ADDRESS_BEGIN);
+			return false;
+		}
+
+		case STEP_ADDRESS_BEGIN:			return matchLiteral (c, CCPARSE_ERR_ADDRESS_BEGIN);
+		case STEP_ADDRESS:					return parseHexField (c, CCPARSE_ERR_ADDRESS);
+		case STEP_DATA_BEGIN:				return matchLiteral (c, CCPARSE_ERR_DATA_BEGIN);
+		case STEP_DATA:						return parseData (c);
+		case STEP_DATA_END:					return matchLiteral (c, CCPARSE_ERR_DATA_END);
+
+		case STEP_CRC:
+			if (_matched == 0) {
+				_packet.crc_ok = (c == PRINT_CCPACKET_CRC_OK [0]);
+				_literal = _packet.crc_ok ? literalCrcOk : literalCrcNok;
+			}
+			return matchLiteral (c, CCPARSE_ERR_CRC);
+
+		case STEP_SIGNAL_STRENGTH_BEGIN:	return matchLiteral (c, CCPARSE_ERR_SIGNAL_STRENGTH);
+		case STEP_SIGNAL_STRENGTH:			return parseHexField (c, CCPARSE_ERR_SIGNAL_STRENGTH);
+		case STEP_SIGNAL_QUALITY_BEGIN:		return matchLiteral (c, CCPARSE_ERR_SIGNAL_QUALITY);
+		case STEP_SIGNAL_QUALITY:			return parseHexField (c, CCPARSE_ERR_SIGNAL_QUALITY);
+	}
+	return false;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+size_t ccPacketParser :: feed (const uint8_t * data, size_t len)
+{
+	size_t i = 0;
+	while ((i < len) && (_step < STEP_DONE)) {
+		if (step (data [i])) {
+			i++;
+			_offset++;
+		}
+	}
+	return i;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+CCPARSE_STATUS ccPacketParser :: flush ()
+{
+	if (_step == STEP_SIGNAL_QUALITY && _digits > 0) {
+		endField ();
+	}
+	else if (_step < STEP_DONE) {
+		fail (CCPARSE_ERR_TRUNCATED);
+	}
+	return getStatus ();
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+CCPARSE_STATUS ccPacketParser :: getStatus () const
+{
+	if (_step == STEP_DONE)		return CCPARSE_DONE;
+	if (_step == STEP_ERROR)	return CCPARSE_ERROR;
+	return CCPARSE_MORE;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+const __FlashStringHelper * ccPacketParser :: getErrorMessage (CCPARSE_ERRCODE error)
+{
+	switch (error) {
+		case CCPARSE_ERR_DATALEN_BEGIN:		return F("Malformatted data length begin");
+		case CCPARSE_ERR_DATALEN:			return F("Buffer length error");
+		case CCPARSE_ERR_ADDRESS_BEGIN:		return F("Malformatted address begin");
+		case CCPARSE_ERR_ADDRESS:			return F("Malformatted address");
+		case CCPARSE_ERR_DATA_BEGIN:		return F("Malformatted data begin");
+		case CCPARSE_ERR_DATA:				return F("Malformatted data");
+		case CCPARSE_ERR_SEPARATOR:			return F("Malformatted separator");
+		case CCPARSE_ERR_DATA_END:			return F("Malformatted data end");
+		case CCPARSE_ERR_CRC:				return F("Malformatted CRC");
+		case CCPARSE_ERR_SIGNAL_STRENGTH:	return F("Malformatted signal strength");
+		case CCPARSE_ERR_SIGNAL_QUALITY:	return F("Malformatted signal quality");
+		case CCPARSE_ERR_TRUNCATED:			return F("Truncated packet");
+		case CCPARSE_ERR_ID:				return F("Malformatted id");
+		case CCPARSE_ERR_LINE_END:			return F("Malformatted line end");
+		default:							return F("No error");
+	}
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+size_t ccPacketParser :: printTo (Print & p) const
+{
+	if (_error == CCPARSE_ERR_NONE) return 0;
+
+	size_t n = p.print (getErrorMessage (_error));
+	n += p.print (F(" at offset "));
+	n += p.print (_offset);
+	n += p.print (F("! ABORTED!!"));
+	return n;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccPacketBatchParser :: reset ()
+{
+	_state		= BATCH_LINE_BEGIN;
+	_id			= 0;
+	_idDigits	= 0;
+	_line		= 1;
+	_column		= 0;
+	_hasItem	= false;
+	_itemError	= CCPARSE_ERR_NONE;
+	_nbItems	= 0;
+	_nbErrors	= 0;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccPacketBatchParser :: setItem (CCPARSE_ERRCODE error)
+{
+	_hasItem	= true;
+	_itemError	= error;
+	_itemLine	= _line;
+	_itemColumn	= _column;
+
+	_nbItems++;
+	if (error != CCPARSE_ERR_NONE) {
+		_nbErrors++;
+		_packet.length = 0;
+		_state = BATCH_SKIP_LINE;
+	}
+	else {
+		_state = BATCH_LINE_BEGIN;
+	}
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccPacketBatchParser :: advance (const uint8_t * data, size_t n)
+{
+	for (size_t i = 0; i < n; i++) {
+		if (data [i] == '\n') {
+			_line++;
+			_column = 0;
+		}
+		else {
+			_column++;
+		}
+	}
+}
+
+//========================================================================================================================
+// Returns true when the character is consumed (the packet text is consumed by feed)
+//========================================================================================================================
+bool ccPacketBatchParser :: step (uint8_t c)
+{
+	switch (_state) {
+
+		case BATCH_LINE_BEGIN:
+			if (isBlank (c)) return true;
+			_id			= 0;
+			_idDigits	= 0;
+			_state		= BATCH_ID;
+			return false;
+
+		case BATCH_ID: {
+			uint8_t digit = digitValue (c);
+			if (digit < 10) {
+				if (++_idDigits > CCPARSE_MAX_ID_DIGITS) break;
+				_id = _id * 10 + digit;
+				return true;
+			}
+			if ((_idDigits == 0) || (_id < 1) || (255 < _id) || ((c != ' ') && (c != '\t'))) break;
+			_parser.reset ();
+			_state = BATCH_PACKET;
+			return true;
+		}
+
+		case BATCH_LINE_END:
+			if (c == '\n') {
+				setItem (CCPARSE_ERR_NONE);
+				return true;
+			}
+			if (isBlank (c)) return true;
+			setItem (CCPARSE_ERR_LINE_END);
+			return false;
+
+		case BATCH_SKIP_LINE:
+			if (c == '\n') _state = BATCH_LINE_BEGIN;
+			return true;
+	}
+
+	setItem (CCPARSE_ERR_ID);
+	return false;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+size_t ccPacketBatchParser :: feed (const uint8_t * data, size_t len)
+{
+	_hasItem = false;
+
+	size_t i = 0;
+	while ((i < len) && !_hasItem) {
+
+		size_t n;
+		if (_state == BATCH_PACKET)	n = _parser.feed (data + i, len - i);
+		else						n = step (data [i]) ? 1 : 0;
+
+		advance (data + i, n);
+		i += n;
+
+		if (_state == BATCH_PACKET) {
+			switch (_parser.getStatus ()) {
+				case CCPARSE_DONE:	_state = BATCH_LINE_END;		break;
+				case CCPARSE_ERROR:	setItem (_parser.getError ());	break;
+				default:											break;
+			}
+		}
+	}
+	return i;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccPacketBatchParser :: flush ()
+{
+	_hasItem = false;
+
+	switch (_state) {
+		case BATCH_ID:			setItem (CCPARSE_ERR_TRUNCATED);						break;
+		case BATCH_PACKET:		setItem ((_parser.flush () == CCPARSE_DONE) ? CCPARSE_ERR_NONE : _parser.getError ());	break;
+		case BATCH_LINE_END:	setItem (CCPARSE_ERR_NONE);								break;
+	}
+	_state = BATCH_LINE_BEGIN;
+}
+
+}
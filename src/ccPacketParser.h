@@ -0,0 +1,171 @@
+//************************************************************************************************************************
+// ccPacketParser.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include "ccPacket.h"
+
+
+namespace cc1101 {
+
+#define CCPARSE_MAX_DATALEN_DIGITS		3							// Decimal digits of the data length
+#define CCPARSE_MAX_HEX_DIGITS			2							// Hex digits of a byte
+#define CCPARSE_MAX_ID_DIGITS			3							// Decimal digits of a storage id (1 to 255)
+
+
+/**
+ * Parser status
+ */
+enum CCPARSE_STATUS : uint8_t
+{
+	CCPARSE_MORE = 0,												// Waiting for more characters
+	CCPARSE_DONE,													// A packet was parsed
+	CCPARSE_ERROR,													// Malformatted text, see getError and getErrorOffset
+};
+
+
+/**
+ * Parser errors
+ */
+enum CCPARSE_ERRCODE : uint8_t
+{
+	CCPARSE_ERR_NONE = 0,
+	CCPARSE_ERR_DATALEN_BEGIN,
+	CCPARSE_ERR_DATALEN,
+	CCPARSE_ERR_ADDRESS_BEGIN,
+	CCPARSE_ERR_ADDRESS,
+	CCPARSE_ERR_DATA_BEGIN,
+	CCPARSE_ERR_DATA,
+	CCPARSE_ERR_SEPARATOR,
+	CCPARSE_ERR_DATA_END,
+	CCPARSE_ERR_CRC,
+	CCPARSE_ERR_SIGNAL_STRENGTH,
+	CCPARSE_ERR_SIGNAL_QUALITY,
+	CCPARSE_ERR_TRUNCATED,
+	CCPARSE_ERR_ID,
+	CCPARSE_ERR_LINE_END,
+};
+
+
+/**
+ * Class: ccPacketParser
+ *
+ * Description:
+ * Resumable push parser of the CCPACKET text format: L-$len A-$addr [$data] (N)OK S-$rssi Q-$lqi
+ * The text is fed in chunks of any size (e.g. as an HTTP body is received), one character at a time through a small
+ * state machine: no buffering of the whole text, no stream timeout, hex and decimal digits decoded with a lookup table.
+ * Leading blanks are skipped, the hex bytes have 1 or 2 digits (any case). The packet ends after the 2nd digit of the
+ * signal quality, on the first character which isn't a digit (not consumed) or on flush.
+ *
+ * The target packet length stays 0 until the packet is complete, and is reset to 0 on error: a half parsed packet is
+ * never valid. On error the offset of the faulty character (from the last reset) is kept.
+ */
+class ccPacketParser : public Printable
+{
+private:
+
+	CCPACKET &		_packet;
+
+	uint8_t			_step			= 0;
+	PGM_P			_literal		= nullptr;						// Text expected by the current step
+	uint8_t			_matched		= 0;							// Characters of _literal already matched
+	uint16_t		_value			= 0;							// Number being decoded
+	uint8_t			_digits			= 0;							// Digits of _value
+	uint8_t			_length			= 0;							// Data length announced
+	uint8_t			_index			= 0;							// Data bytes decoded
+	bool			_needSeparator	= false;						// A separator must precede the next data byte
+
+	uint32_t		_offset			= 0;							// Characters consumed since the last reset
+	CCPARSE_ERRCODE	_error			= CCPARSE_ERR_NONE;
+
+private:
+
+	void setStep					(uint8_t step);
+	bool fail						(CCPARSE_ERRCODE error);
+	bool step						(uint8_t c);
+
+	bool matchLiteral				(uint8_t c, CCPARSE_ERRCODE error);
+	bool parseHexField				(uint8_t c, CCPARSE_ERRCODE error);
+	bool parseData					(uint8_t c);
+	void endField					();
+
+public:
+
+	ccPacketParser					(CCPACKET & packet) : _packet (packet) { reset (); }
+
+	void reset						();
+
+	size_t feed						(const uint8_t * data, size_t len);		// Returns the number of characters consumed
+	CCPARSE_STATUS flush			();										// End of the text
+
+	CCPARSE_STATUS getStatus		() const;
+	CCPARSE_ERRCODE getError		() const	{ return _error;	}
+	uint32_t getErrorOffset			() const	{ return _offset;	}		// Offset of the faulty character
+	uint32_t getOffset				() const	{ return _offset;	}
+
+	static const __FlashStringHelper * getErrorMessage (CCPARSE_ERRCODE error);
+
+	virtual size_t printTo			(Print & p) const override;				// Error message (nothing when no error)
+};
+
+
+
+/**
+ * Class: ccPacketBatchParser
+ *
+ * Description:
+ * Resumable push parser of many packets with their storage ids, one per line: $id L-$len A-$addr [$data] ...
+ * Blank lines are skipped. feed stops after each item (a packet or a malformatted line): the caller reads it with
+ * hasItem / getId / getPacket / getError, then feeds the rest. A malformatted line is reported once and skipped up to
+ * its end, the next lines are still parsed.
+ */
+class ccPacketBatchParser
+{
+private:
+
+	CCPACKET		_packet;
+	ccPacketParser	_parser;
+
+	uint8_t			_state			= 0;
+	uint16_t		_id				= 0;
+	uint8_t			_idDigits		= 0;
+	uint16_t		_line			= 1;							// Current line (from 1)
+	uint16_t		_column			= 0;							// Characters of the current line consumed
+
+	bool			_hasItem		= false;
+	uint16_t		_itemLine		= 0;
+	CCPARSE_ERRCODE	_itemError		= CCPARSE_ERR_NONE;
+	uint16_t		_itemColumn		= 0;
+	uint16_t		_nbItems		= 0;
+	uint16_t		_nbErrors		= 0;
+
+private:
+
+	void setItem					(CCPARSE_ERRCODE error);
+	void advance					(const uint8_t * data, size_t n);
+	bool step						(uint8_t c);
+
+public:
+
+	ccPacketBatchParser				() : _parser (_packet) {}
+
+	void reset						();
+
+	size_t feed						(const uint8_t * data, size_t len);		// Returns the number of characters consumed
+	void flush						();										// End of the text (may set a last item)
+
+	bool hasItem					() const	{ return _hasItem;					}
+	uint8_t getId					() const	{ return _id;						}
+	const CCPACKET & getPacket		() const	{ return _packet;					}	// Valid when getError is CCPARSE_ERR_NONE
+	CCPARSE_ERRCODE getError		() const	{ return _itemError;				}
+	uint16_t getLine				() const	{ return _itemLine;					}
+	uint16_t getColumn				() const	{ return _itemColumn;				}	// Of the faulty character
+
+	uint16_t getNbItems				() const	{ return _nbItems;					}
+	uint16_t getNbErrors			() const	{ return _nbErrors;					}
+};
+
+}
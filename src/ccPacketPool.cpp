@@ -0,0 +1,113 @@
+//************************************************************************************************************************
+// ccPacketPool.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include "ccPacketPool.h"
+
+using namespace corex;
+
+
+namespace cc1101 {
+
+
+SINGLETON_IMPL (ccPacketPool)
+
+
+//========================================================================================================================
+//
+//========================================================================================================================
+ccPacketHandle ccPacketPool :: acquire ()
+{
+	uint8_t index;
+
+	if (_freeHead != CCPACKET_POOL_NONE) {
+		index		= _freeHead;
+		_freeHead	= _nextFree [index];
+	}
+	else if (_nbNeverUsed > 0) {
+		index		= CCPACKET_POOL_SIZE - _nbNeverUsed;
+		_nbNeverUsed--;
+	}
+	else {
+		_stats.nbExhausted++;
+		Logln(F("WARNING : Packet pool exhausted!"));
+		return ccPacketHandle ();
+	}
+
+	_refCounts [index] = 1;
+	_packets [index].reset ();
+
+	_stats.nbAcquired++;
+	if (++_stats.nbUsed > _stats.highWater) {
+		_stats.highWater = _stats.nbUsed;
+	}
+
+	return ccPacketHandle (index);
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccPacketPool :: release (uint8_t index)
+{
+	if (--_refCounts [index] > 0) return;
+
+	_nextFree [index]	= _freeHead;
+	_freeHead			= index;
+	_stats.nbUsed--;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+size_t ccPacketPool :: printTo (Print & p) const
+{
+	size_t n = 0;
+	n += p.print (F("size "));			n += p.print (_stats.size);			n += p.print ('\n');
+	n += p.print (F("used "));			n += p.print (_stats.nbUsed);		n += p.print ('\n');
+	n += p.print (F("highWater "));		n += p.print (_stats.highWater);	n += p.print ('\n');
+	n += p.print (F("acquired "));		n += p.print (_stats.nbAcquired);	n += p.print ('\n');
+	n += p.print (F("exhausted "));		n += p.print (_stats.nbExhausted);	n += p.print ('\n');
+	return n;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+ccPacketHandle & ccPacketHandle :: operator= (const ccPacketHandle & other)
+{
+	if (this != &other) {
+		if (other.isValid ()) I(ccPacketPool).addRef (other._index);	// Before release: other may share the packet
+		release ();
+		_index = other._index;
+	}
+	return *this;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+ccPacketHandle & ccPacketHandle :: operator= (ccPacketHandle && other)
+{
+	if (this != &other) {
+		release ();
+		_index			= other._index;
+		other._index	= CCPACKET_POOL_NONE;
+	}
+	return *this;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccPacketHandle :: release ()
+{
+	if (isValid ()) {
+		I(ccPacketPool).release (_index);
+		_index = CCPACKET_POOL_NONE;
+	}
+}
+
+}
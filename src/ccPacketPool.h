@@ -0,0 +1,172 @@
+//************************************************************************************************************************
+// ccPacketPool.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include <utility>
+
+#include <Common.h>
+
+#include "ccPacket.h"
+
+
+namespace cc1101 {
+
+#ifndef CCPACKET_POOL_SIZE
+#	define CCPACKET_POOL_SIZE			8							// Packets shared by the RX / TX queues, the storage and the replay
+#endif
+#define CCPACKET_POOL_NONE				0xFF						// No packet (empty handle, end of the free list)
+
+static_assert (CCPACKET_POOL_SIZE < CCPACKET_POOL_NONE, "The pool index must fit in a byte");
+
+
+/**
+ * Pool usage
+ */
+struct CCPACKET_POOL_STATS
+{
+	uint8_t		size			= CCPACKET_POOL_SIZE;
+	uint8_t		nbUsed			= 0;								// Packets currently acquired
+	uint8_t		highWater		= 0;								// Max of nbUsed since the start
+	uint32_t	nbAcquired		= 0;
+	uint32_t	nbExhausted		= 0;								// Acquisitions failed, the pool was empty
+};
+
+
+class ccPacketHandle;
+
+
+/**
+ * Class: ccPacketPool
+ *
+ * Description:
+ * Fixed number of packets allocated once (no heap, no fragmentation over weeks of uptime). acquire and release are
+ * O(1): the free packets are chained in a list of indexes, the packets never used yet are taken in order. The packets
+ * are reference counted by ccPacketHandle and go back to the pool with their last handle.
+ * Not interrupt safe: acquire and release from the loop or a timer callback only.
+ */
+// WARNING : SINGLETON !!!!
+class ccPacketPool : public Printable
+{
+	SINGLETON_CLASS (ccPacketPool)
+
+	friend class ccPacketHandle;
+
+private:
+
+	CCPACKET			_packets	[CCPACKET_POOL_SIZE];
+	uint16_t			_refCounts	[CCPACKET_POOL_SIZE]	= {};	// 16 bits: 65535 handles (1 byte each) don't fit in the RAM
+	uint8_t				_nextFree	[CCPACKET_POOL_SIZE];
+	uint8_t				_freeHead				= CCPACKET_POOL_NONE;
+	uint8_t				_nbNeverUsed			= CCPACKET_POOL_SIZE;
+	CCPACKET_POOL_STATS	_stats;
+
+private:
+
+	void addRef							(uint8_t index)			{ _refCounts [index]++; }
+	void release						(uint8_t index);
+
+public:
+
+	ccPacketHandle acquire				();							// Empty handle if the pool is exhausted
+
+	const CCPACKET_POOL_STATS & getStats () const				{ return _stats; }
+	uint8_t getNbFree					() const				{ return _stats.size - _stats.nbUsed; }
+
+	virtual size_t printTo				(Print & p) const override;
+};
+
+
+/**
+ * Class: ccPacketHandle
+ *
+ * Description:
+ * Shared ownership of a pool packet: copying a handle adds a reference, the packet is released with the last handle.
+ * An empty handle (pool exhausted) is false.
+ */
+class ccPacketHandle
+{
+	friend class ccPacketPool;
+
+private:
+
+	uint8_t		_index			= CCPACKET_POOL_NONE;
+
+	explicit ccPacketHandle				(uint8_t index) : _index (index) {}		// Takes the reference of acquire
+
+public:
+
+	ccPacketHandle						() {}
+	ccPacketHandle						(const ccPacketHandle & other) : _index (other._index)	{ if (isValid ()) I(ccPacketPool).addRef (_index); }
+	ccPacketHandle						(ccPacketHandle && other) : _index (other._index)		{ other._index = CCPACKET_POOL_NONE; }
+	~ccPacketHandle						()						{ release (); }
+
+	ccPacketHandle & operator=			(const ccPacketHandle & other);
+	ccPacketHandle & operator=			(ccPacketHandle && other);
+
+	void release						();
+
+	bool isValid						() const				{ return _index != CCPACKET_POOL_NONE; }
+	explicit operator bool				() const				{ return isValid (); }
+	uint16_t useCount					() const				{ return isValid () ? I(ccPacketPool)._refCounts [_index] : 0; }
+
+	CCPACKET * get						() const				{ return isValid () ? &I(ccPacketPool)._packets [_index] : nullptr; }
+	CCPACKET & operator*				() const				{ return *get (); }
+	CCPACKET * operator->				() const				{ return get (); }
+};
+
+
+/**
+ * Class: ccPacketQueue
+ *
+ * Description:
+ * Bounded FIFO of pool packets (ring of handles). A push on a full queue is refused and counted as dropped.
+ */
+template <uint8_t N>
+class ccPacketQueue
+{
+private:
+
+	ccPacketHandle	_items [N];
+	uint8_t			_head			= 0;							// Oldest packet
+	uint8_t			_count			= 0;
+	uint8_t			_highWater		= 0;
+	uint32_t		_nbDropped		= 0;
+
+public:
+
+	bool push							(const ccPacketHandle & packet)
+	{
+		if (!packet.isValid ()) return false;
+		if (_count == N) {
+			_nbDropped++;
+			return false;
+		}
+		_items [(_head + _count) % N] = packet;
+		if (++_count > _highWater) _highWater = _count;
+		return true;
+	}
+
+	ccPacketHandle pop					()
+	{
+		if (_count == 0) return ccPacketHandle ();
+		ccPacketHandle packet = std::move (_items [_head]);
+		_head = (_head + 1) % N;
+		_count--;
+		return packet;
+	}
+
+	void clear							()						{ while (_count > 0) pop (); }
+
+	uint8_t size						() const				{ return _count;			}
+	bool isEmpty						() const				{ return _count == 0;		}
+	bool isFull							() const				{ return _count == N;		}
+	static constexpr uint8_t capacity	()						{ return N;					}
+	uint8_t getHighWater				() const				{ return _highWater;		}
+	uint32_t getNbDropped				() const				{ return _nbDropped;		}
+};
+
+}
@@ -16,15 +16,69 @@ SINGLETON_IMPL (ccPacketStorage)
 
 
 //========================================================================================================================
-//
+// Id of a packet file with the ext extension (a committed packet by default), 0 for the other files
 //========================================================================================================================
-bool ccPacketStorage :: read (uint8_t fileId, CCPACKET & ccPacket)
+static int getFileId (const String & filename, const __FlashStringHelper * ext = F(RF_EXT_NAMEFILE))
 {
-//	spiffsInfos ();
+	if (filename.indexOf (F(RF_HEADER_NAMEFILE)) != 0) return 0;
 
+	int lasti = filename.indexOf (ext);
+	if (lasti <= 0) return 0;
+
+	int fileId = filename.substring (strlen(RF_HEADER_NAMEFILE), lasti).toInt ();
+	return ((fileId <= 0) || (255 < fileId)) ? 0 : fileId;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+String ccPacketStorage :: getFilename (uint8_t fileId, const __FlashStringHelper * ext)
+{
 	String filename = F(RF_HEADER_NAMEFILE);
 	filename += fileId;
-	filename += F(RF_EXT_NAMEFILE);
+	filename += ext;
+	return filename;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool ccPacketStorage :: writeFile (const String & filename, const CCPACKET & ccPacket, const CCPACKET_META * meta)
+{
+	if (ccPacket.length < 1) {
+		Logln(F("No Rf Signal!"));
+		return false;
+	}
+
+	File f = LittleFS.open(filename, "w");
+	if (!f) {
+		Logln(F("ERROR : Can't open the file : ") << filename);
+		return false;
+	}
+
+	uint8_t record [CCCODEC_MAX_RECORD_LEN];
+	size_t len = ccPacketCodec::encode (ccPacket, meta, record, sizeof (record));
+
+	// size_t write(const uint8_t *buffer, size_t size);
+	bool isWrote = (len > 0) && (f.write (record, len) == len);
+	f.close ();
+
+	if (isWrote)
+		Logln(ccPacket.length << F(" bytes wrote"));
+	else
+		Logln(F("ERROR : Can't write in the file : ") << filename);
+
+	return isWrote;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool ccPacketStorage :: read (uint8_t fileId, CCPACKET & ccPacket, CCPACKET_META * meta /*= nullptr*/)
+{
+//	spiffsInfos ();
+
+	String filename = getFilename (fileId, F(RF_EXT_NAMEFILE));
 
 	File f = LittleFS.open(filename, "r");
 	if (!f) {
@@ -38,15 +92,23 @@ bool ccPacketStorage :: read (uint8_t fileId, CCPACKET & ccPacket)
 
 	// returns the number of characters placed in the buffer (0 means no valid data found)
 	// size_t readBytes( uint8_t *buffer, size_t length)
-	if (f.readBytes ((char *) &ccPacket.length, 1) == 1) {
-		if (f.readBytes ((char *) &ccPacket.address, 1) == 1) {
-			if (f.readBytes ((char *) &(ccPacket.data[0]), ccPacket.length) == ccPacket.length) {
-				isRead = true;
-			}
-		}
-	}
+	uint8_t record [CCCODEC_MAX_RECORD_LEN];
+	size_t len = f.readBytes ((char *) record, sizeof (record));
 	f.close ();
 
+	if (ccPacketCodec::isRecord (record, len)) {
+		isRead = (ccPacketCodec::decode (record, len, ccPacket, meta) > 0);
+	}
+	else if ((len >= 2) && (record [0] <= CCPACKET_DATA_LEN) && (len == 2 + (size_t) record [0])) {
+		// Legacy file: [length] [address] [data]
+		ccPacket.reset ();
+		ccPacket.length		= record [0];
+		ccPacket.address	= record [1];
+		memcpy (ccPacket.data, record + 2, ccPacket.length);
+		if (meta != nullptr) *meta = CCPACKET_META ();
+		isRead = true;
+	}
+
 	if (isRead)
 		Logln(ccPacket.length << F(" bytes Read"));
 	else {
@@ -60,40 +122,23 @@ bool ccPacketStorage :: read (uint8_t fileId, CCPACKET & ccPacket)
 //========================================================================================================================
 //
 //========================================================================================================================
-bool ccPacketStorage :: write (uint8_t fileId, CCPACKET & ccPacket)
+ccPacketHandle ccPacketStorage :: load (uint8_t fileId, CCPACKET_META * meta /*= nullptr*/)
 {
-	if (!FileStorage::spiffsCheckRemainingBytes ()) return false;
-	if (ccPacket.length < 1) {
-		Logln(F("No Rf Signal!"));
-		return false;
-	}
-
-	String filename = F(RF_HEADER_NAMEFILE);
-	filename += fileId;
-	filename += F(RF_EXT_NAMEFILE);
-
-	File f = LittleFS.open(filename, "w");
-	if (!f) {
-		Logln(F("ERROR : Can't open the file : ") << filename);
-		return false;
+	ccPacketHandle packet = I(ccPacketPool).acquire ();
+	if (packet && !read (fileId, *packet, meta)) {
+		packet.release ();
 	}
+	return packet;
+}
 
-	bool isWrote = false;
-
-	// size_t write(const uint8_t *buffer, size_t size);
-	if (f.write ((const uint8_t *) &ccPacket.length, 1) == 1) {
-		if (f.write ((const uint8_t *) &ccPacket.address, 1) == 1) {
-			if (f.write ((const uint8_t *) &(ccPacket.data[0]), ccPacket.length) == ccPacket.length) {
-				isWrote = true;
-			}
-		}
-	}
-	f.close ();
+//========================================================================================================================
+//
+//========================================================================================================================
+bool ccPacketStorage :: write (uint8_t fileId, const CCPACKET & ccPacket, const CCPACKET_META * meta /*= nullptr*/)
+{
+	if (!FileStorage::spiffsCheckRemainingBytes ()) return false;
 
-	if (isWrote)
-		Logln(ccPacket.length << F(" bytes wrote"));
-	else
-		Logln(F("ERROR : Can't write in the file : ") << filename);
+	bool isWrote = writeFile (getFilename (fileId, F(RF_EXT_NAMEFILE)), ccPacket, meta);
 
 	FileStorage::spiffsInfos ();
 
@@ -105,13 +150,69 @@ bool ccPacketStorage :: write (uint8_t fileId, CCPACKET & ccPacket)
 //========================================================================================================================
 bool ccPacketStorage :: remove (uint8_t fileId)
 {
-	String filename = F(RF_HEADER_NAMEFILE);
-	filename += fileId;
-	filename += F(RF_EXT_NAMEFILE);
+	String filename = getFilename (fileId, F(RF_EXT_NAMEFILE));
 
 	return LittleFS.remove (filename);
 }
 
+//========================================================================================================================
+// A complete journal => the commit had started: the renames are completed. Otherwise the transaction is cancelled.
+// The .tmp files (transactions never committed) and the .bak files (replaced packets) left are removed.
+//========================================================================================================================
+void ccPacketStorage :: recover ()
+{
+	uint8_t journal [3 + 255];
+	size_t len = 0;
+
+	File f = LittleFS.open (F(RF_JOURNAL_NAMEFILE), "r");
+	if (f) {
+		len = f.readBytes ((char *) journal, sizeof (journal));
+		f.close ();
+	}
+
+	bool isComplete = (len >= 3) && (journal [0] == RF_JOURNAL_MAGIC) && (len == 3 + (size_t) journal [1]) && (journal [len - 1] == RF_JOURNAL_MAGIC);
+
+	if (isComplete) {
+		for (uint8_t i = 0; i < journal [1]; i++) {
+
+			String tmpFilename	= getFilename (journal [2 + i], F(RF_EXT_TMP_NAMEFILE));
+			if (!LittleFS.exists (tmpFilename)) continue;				// Already renamed
+
+			String filename		= getFilename (journal [2 + i], F(RF_EXT_NAMEFILE));
+			String bakFilename	= getFilename (journal [2 + i], F(RF_EXT_BAK_NAMEFILE));
+			if (LittleFS.exists (filename)) {
+				LittleFS.remove (bakFilename);
+				LittleFS.rename (filename, bakFilename);
+			}
+			if (!LittleFS.rename (tmpFilename, filename)) {
+				Logln(F("ERROR : Can't recover the packet : ") << journal [2 + i]);
+			}
+		}
+		Logln(F("Interrupted commit of ") << journal [1] << F(" packets completed"));
+	}
+	else if (len > 0) {
+		Logln(F("Incomplete commit journal, transaction cancelled"));
+	}
+	LittleFS.remove (F(RF_JOURNAL_NAMEFILE));
+
+	// The directory is not modified while it is listed
+	uint8_t stale [256 / 8];
+	memset (stale, 0, sizeof (stale));
+
+	Dir dir = LittleFS.openDir("/");
+	while (dir.next()) {
+		int fileId = getFileId (dir.fileName(), F(RF_EXT_TMP_NAMEFILE));
+		if (fileId <= 0) fileId = getFileId (dir.fileName(), F(RF_EXT_BAK_NAMEFILE));
+		if (fileId > 0) stale [fileId >> 3] |= (1 << (fileId & 7));
+	}
+	for (uint16_t fileId = 1; fileId <= 255; fileId++) {
+		if (stale [fileId >> 3] & (1 << (fileId & 7))) {
+			LittleFS.remove (getFilename (fileId, F(RF_EXT_TMP_NAMEFILE)));
+			LittleFS.remove (getFilename (fileId, F(RF_EXT_BAK_NAMEFILE)));
+		}
+	}
+}
+
 //========================================================================================================================
 //
 //========================================================================================================================
@@ -138,4 +239,226 @@ String ccPacketStorage :: getList ()
 	return result;
 }
 
+//========================================================================================================================
+// Writes a batch header then one record per stored packet (with its id), returns the number of packets
+//========================================================================================================================
+uint16_t ccPacketStorage :: exportAll (Print & out)
+{
+	ccPacketStorageExporter exporter;
+
+	uint8_t buffer [CCCODEC_MAX_RECORD_LEN];
+	size_t len;
+	while ((len = exporter.read (buffer, sizeof (buffer))) > 0) {
+		out.write (buffer, len);
+	}
+
+	Logln(exporter.count () << F(" packets exported"));
+
+	return exporter.count ();
+}
+
+//========================================================================================================================
+// Same lines as accepted by ccPacketBatchParser, returns the number of packets
+//========================================================================================================================
+uint16_t ccPacketStorage :: printAll (Print & out)
+{
+	uint16_t count = 0;
+	Dir dir = LittleFS.openDir("/");
+	while (dir.next()) {
+
+		int fileId = getFileId (dir.fileName());
+		if (fileId <= 0) continue;
+
+		CCPACKET packet;
+		if (!read (fileId, packet)) continue;
+
+		out << fileId << F(" ") << packet << LN;
+		count++;
+	}
+
+	Logln(count << F(" packets printed"));
+
+	return count;
+}
+
+//========================================================================================================================
+// Encodes the next stored packet (with its id), false when there is no more
+//========================================================================================================================
+bool ccPacketStorageExporter :: next ()
+{
+	while (_dir.next ()) {
+
+		int fileId = getFileId (_dir.fileName ());
+		if (fileId <= 0) continue;
+
+		CCPACKET packet;
+		CCPACKET_META meta;
+		if (!I(ccPacketStorage).read (fileId, packet, &meta)) continue;
+		meta.id = fileId;
+
+		_len = ccPacketCodec::encode (packet, &meta, _record, sizeof (_record));
+		_pos = 0;
+		if (_len > 0) {
+			_count++;
+			return true;
+		}
+	}
+	return false;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+size_t ccPacketStorageExporter :: read (uint8_t * buffer, size_t size)
+{
+	if (!_isStarted) {
+		_isStarted	= true;
+		_record [0]	= CCCODEC_BATCH_MAGIC;
+		_record [1]	= CCCODEC_VERSION;
+		_len		= CCCODEC_BATCH_HEADER_LEN;
+		_pos		= 0;
+	}
+
+	if ((_pos >= _len) && !next ()) return 0;
+
+	size_t len = _len - _pos;
+	if (len > size) len = size;
+	memcpy (buffer, _record + _pos, len);
+	_pos += len;
+	return len;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool ccPacketStorageTransaction :: write (uint8_t fileId, const CCPACKET & ccPacket, const CCPACKET_META * meta /*= nullptr*/)
+{
+	if (_isFailed) return false;
+
+	if ((fileId == 0) || !FileStorage::spiffsCheckRemainingBytes ()) {
+		_isFailed = true;											// Nothing will be committed
+		return false;
+	}
+
+	String tmpFilename = ccPacketStorage::getFilename (fileId, F(RF_EXT_TMP_NAMEFILE));
+	if (!ccPacketStorage::writeFile (tmpFilename, ccPacket, meta)) {
+		LittleFS.remove (tmpFilename);								// No partial file left
+		_isFailed = true;
+		return false;
+	}
+
+	if (!isStaged (fileId)) {
+		_staged [fileId >> 3] |= (1 << (fileId & 7));
+		_nbStaged++;
+	}
+	return true;
+}
+
+//========================================================================================================================
+// [RF_JOURNAL_MAGIC] [count] [ids x count] [RF_JOURNAL_MAGIC]: the last byte tells that the journal is complete
+//========================================================================================================================
+bool ccPacketStorageTransaction :: writeJournal ()
+{
+	uint8_t journal [3 + 255];
+	uint16_t len = 2;
+
+	for (uint16_t fileId = 1; fileId <= 255; fileId++) {
+		if (isStaged (fileId)) journal [len++] = fileId;
+	}
+	journal [0]		= RF_JOURNAL_MAGIC;
+	journal [1]		= len - 2;
+	journal [len++]	= RF_JOURNAL_MAGIC;
+
+	File f = LittleFS.open (F(RF_JOURNAL_NAMEFILE), "w");
+	if (!f) return false;
+
+	bool isWrote = (f.write (journal, len) == len);
+	f.close ();
+
+	if (!isWrote) LittleFS.remove (F(RF_JOURNAL_NAMEFILE));
+	return isWrote;
+}
+
+//========================================================================================================================
+// The staged packets up to lastFileId are committed: the new files are removed and the .bak files renamed back
+//========================================================================================================================
+void ccPacketStorageTransaction :: restore (uint8_t lastFileId)
+{
+	for (uint16_t fileId = 1; fileId <= lastFileId; fileId++) {
+
+		if (!isStaged (fileId)) continue;
+
+		String filename		= ccPacketStorage::getFilename (fileId, F(RF_EXT_NAMEFILE));
+		String bakFilename	= ccPacketStorage::getFilename (fileId, F(RF_EXT_BAK_NAMEFILE));
+
+		LittleFS.remove (filename);
+		if (LittleFS.exists (bakFilename) && !LittleFS.rename (bakFilename, filename)) {
+			Logln(F("ERROR : Can't restore the packet : ") << fileId);
+		}
+	}
+}
+
+//========================================================================================================================
+// Journal, replaced files => .bak, temporary files => final names, then the journal and the .bak files are removed
+//========================================================================================================================
+bool ccPacketStorageTransaction :: commit ()
+{
+	if (_isFailed || (_nbStaged == 0) || !writeJournal ()) {
+		rollback ();
+		return false;
+	}
+
+	uint16_t fileId;
+	for (fileId = 1; fileId <= 255; fileId++) {
+
+		if (!isStaged (fileId)) continue;
+
+		String tmpFilename	= ccPacketStorage::getFilename (fileId, F(RF_EXT_TMP_NAMEFILE));
+		String filename		= ccPacketStorage::getFilename (fileId, F(RF_EXT_NAMEFILE));
+		String bakFilename	= ccPacketStorage::getFilename (fileId, F(RF_EXT_BAK_NAMEFILE));
+
+		LittleFS.remove (bakFilename);
+		if (LittleFS.exists (filename) && !LittleFS.rename (filename, bakFilename)) break;
+
+		if (!LittleFS.rename (tmpFilename, filename)) {
+			if (LittleFS.exists (bakFilename)) LittleFS.rename (bakFilename, filename);
+			break;
+		}
+	}
+
+	bool isCommitted = (fileId > 255);
+	if (!isCommitted) {
+		Logln(F("ERROR : Can't commit the packet : ") << fileId);
+		restore (fileId - 1);
+	}
+	LittleFS.remove (F(RF_JOURNAL_NAMEFILE));
+
+	for (fileId = 1; fileId <= 255; fileId++) {
+		if (isStaged (fileId)) LittleFS.remove (ccPacketStorage::getFilename (fileId, F(RF_EXT_BAK_NAMEFILE)));
+	}
+
+	if (isCommitted)
+		Logln(_nbStaged << F(" packets committed"));
+	FileStorage::spiffsInfos ();
+
+	rollback ();													// Removes the temporary files left
+	return isCommitted;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccPacketStorageTransaction :: rollback ()
+{
+	if (_nbStaged == 0) return;
+
+	for (uint16_t fileId = 1; fileId <= 255; fileId++) {
+		if (isStaged (fileId)) {
+			LittleFS.remove (ccPacketStorage::getFilename (fileId, F(RF_EXT_TMP_NAMEFILE)));
+		}
+	}
+	memset (_staged, 0, sizeof (_staged));
+	_nbStaged = 0;
+}
+
 }
@@ -8,12 +8,17 @@
 
 #include <Common.h>
 
-#include "ccPacket.h"
+#include "ccPacketCodec.h"
+#include "ccPacketPool.h"
 
 namespace cc1101 {
 
 #define RF_HEADER_NAMEFILE					"/Rf"
 #define RF_EXT_NAMEFILE						".dat"
+#define RF_EXT_TMP_NAMEFILE					".tmp"						// Written by a transaction, not committed yet
+#define RF_EXT_BAK_NAMEFILE					".bak"						// Replaced by a transaction being committed
+#define RF_JOURNAL_NAMEFILE					"/Rf.jnl"					// Ids of the transaction being committed
+#define RF_JOURNAL_MAGIC					0x4A
 
 //------------------------------------------------------------------------------
 // WARNING : SINGLETON !!!!
@@ -22,10 +27,88 @@ class ccPacketStorage
 	SINGLETON_CLASS (ccPacketStorage)
 
 public:
-	bool 	read		(uint8_t fileId, CCPACKET & ccPacket);
-	bool	write		(uint8_t fileId, CCPACKET & ccPacket);
+	bool 	read		(uint8_t fileId, CCPACKET & ccPacket, CCPACKET_META * meta = nullptr);
+	bool	write		(uint8_t fileId, const CCPACKET & ccPacket, const CCPACKET_META * meta = nullptr);
+	ccPacketHandle load	(uint8_t fileId, CCPACKET_META * meta = nullptr);	// Read in a pool packet, empty handle on error
 	bool	remove		(uint8_t fileId);
 	String	getList		();
+	uint16_t exportAll	(Print & out);								// Binary batch (ccPacketCodec) of all the stored packets
+	uint16_t printAll	(Print & out);								// Text batch of all the stored packets: one "$id $packet" line each
+
+	void	recover		();											// At boot: completes or cancels an interrupted commit
+
+	static String getFilename	(uint8_t fileId, const __FlashStringHelper * ext);
+	static bool writeFile		(const String & filename, const CCPACKET & ccPacket, const CCPACKET_META * meta);
+};
+
+
+/**
+ * Class: ccPacketStorageExporter
+ *
+ * Description:
+ * Same binary batch as ccPacketStorage::exportAll, produced piece by piece: each read () call returns the batch header
+ * or (the rest of) one record, the next file is read only when the current record is fully consumed. A chunked
+ * response never holds more than one record.
+ */
+class ccPacketStorageExporter
+{
+private:
+
+	Dir			_dir;
+	bool		_isStarted		= false;
+	uint8_t		_record [CCCODEC_MAX_RECORD_LEN];
+	uint16_t	_len			= 0;
+	uint16_t	_pos			= 0;
+	uint16_t	_count			= 0;
+
+	bool next			();
+
+public:
+
+	ccPacketStorageExporter		()					: _dir (LittleFS.openDir ("/")) {}
+
+	size_t read			(uint8_t * buffer, size_t size);			// 0 at the end of the batch
+
+	uint16_t count		() const					{ return _count; }
+};
+
+
+/**
+ * Class: ccPacketStorageTransaction
+ *
+ * Description:
+ * Stores many packets as a whole. Each packet is written to a temporary file as soon as it is known (nothing is held in
+ * RAM), rollback removes them. The transaction is rolled back when it is destroyed without commit.
+ *
+ * Commit: the journal (ids of the transaction) is written first, then the replaced files are renamed .bak, the
+ * temporary files are renamed to their final names, and the journal and the .bak files are removed. A failed rename
+ * restores the .bak files. After a reset, ccPacketStorage::recover completes the renames of a complete journal and
+ * removes the stale .tmp / .bak files, so the stored packets are either all replaced or all kept.
+ */
+class ccPacketStorageTransaction
+{
+private:
+
+	uint8_t		_staged [256 / 8];									// Bit set of the file ids written
+	uint8_t		_nbStaged		= 0;
+	bool		_isFailed		= false;
+
+	bool isStaged		(uint8_t fileId) const		{ return _staged [fileId >> 3] & (1 << (fileId & 7)); }
+
+	bool writeJournal	();
+	void restore		(uint8_t lastFileId);						// Puts back the files replaced up to lastFileId
+
+public:
+
+	ccPacketStorageTransaction	()					{ memset (_staged, 0, sizeof (_staged)); }
+	~ccPacketStorageTransaction	()					{ rollback (); }
+
+	bool write			(uint8_t fileId, const CCPACKET & ccPacket, const CCPACKET_META * meta = nullptr);
+	bool commit			();
+	void rollback		();
+
+	uint8_t count		() const					{ return _nbStaged; }
+	bool isFailed		() const					{ return _isFailed; }
 };
 
 }
\ No newline at end of file
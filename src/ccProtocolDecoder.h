@@ -0,0 +1,63 @@
+//************************************************************************************************************************
+// ccProtocolDecoder.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include "ccPacket.h"
+#include "ccBitBuffer.h"
+
+
+namespace cc1101 {
+
+/**
+ * Types of the decoded events
+ */
+enum CCEVENT_TYPE : uint8_t
+{
+	CCEVENT_X2D = 0,
+	CCEVENT_OOK_ROW,
+	CCEVENT_FRAME,
+	CCEVENT_USER													// First type free for the application decoders
+};
+
+
+/**
+ * Base of the typed events (ccDecoderRegistry::subscribe <EVENT> casts to the EVENT type)
+ */
+struct ccDecodedEvent : public Printable
+{
+	const uint8_t	type;
+
+	ccDecodedEvent						(uint8_t eventType) : type (eventType) {}
+};
+
+
+/**
+ * Class: ccProtocolDecoder
+ *
+ * Description:
+ * Protocol module of the ccDecoderRegistry. The accepts* predicates are evaluated once for each first byte and length
+ * value when the decoder is registered (precomputed dispatch index), matches is evaluated for each candidate packet.
+ * The decoded event is owned by the decoder and is valid until its next decode.
+ */
+class ccProtocolDecoder
+{
+public:
+
+	virtual ~ccProtocolDecoder			() {}
+
+	virtual const char * getName		() const = 0;
+
+	virtual bool acceptsFirstByte		(uint8_t /* firstByte */) const	{ return true;	}
+	virtual bool acceptsLength			(uint8_t /* length */) const	{ return true;	}
+	virtual bool acceptsBits			() const					{ return false;	}	// Decodes demodulated pulse trains
+	virtual bool matches				(const CCPACKET &) const	{ return true;	}
+
+	virtual const ccDecodedEvent * decode	(const CCPACKET & packet) = 0;				// nullptr if not decoded
+	virtual const ccDecodedEvent * decode	(const ccBitBuffer &)	{ return nullptr; }
+};
+
+}
@@ -0,0 +1,96 @@
+//************************************************************************************************************************
+// ccPulse.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include "ccPulse.h"
+
+
+namespace cc1101 {
+
+//========================================================================================================================
+// Called from the capture edge interrupt => must be in IRAM
+//========================================================================================================================
+#if defined (ESP8266) || defined (ESP32)
+bool IRAM_ATTR ccPulseRing :: push (uint16_t pulse)
+#else
+bool ccPulseRing :: push (uint16_t pulse)
+#endif
+{
+	uint16_t next = (_head + 1) & (CCPULSE_RING_LEN - 1);
+
+	if (next == _tail) {
+		_nbOverflows = _nbOverflows + 1;
+		return false;
+	}
+
+	_pulses [_head] = pulse;
+	_head = next;
+	return true;
+}
+
+//========================================================================================================================
+// Called from the transmit timer interrupt => must be in IRAM
+//========================================================================================================================
+#if defined (ESP8266) || defined (ESP32)
+bool IRAM_ATTR ccPulseRing :: pop (uint16_t & pulse)
+#else
+bool ccPulseRing :: pop (uint16_t & pulse)
+#endif
+{
+	if (_tail == _head) return false;
+
+	pulse = _pulses [_tail];
+	_tail = (_tail + 1) & (CCPULSE_RING_LEN - 1);
+	return true;
+}
+
+//========================================================================================================================
+// Returns the number of bytes written in out (CCPULSE_DELTA_MAX_BYTES max)
+//========================================================================================================================
+uint8_t ccPulseDeltaEncoder :: encode (uint16_t pulse, uint8_t * out)
+{
+	bool level		= pulseLevel (pulse);
+	int32_t delta	= (int32_t) pulseWidth (pulse) - _previous [level];
+
+	_previous [level] = pulseWidth (pulse);
+
+	uint32_t value = ((delta < 0) ? ((uint32_t) (-delta) << 1) - 1 : (uint32_t) delta << 1);	// Zigzag
+	value = (value << 1) | level;
+
+	uint8_t n = 0;
+	while (value >= 0x80) {
+		out [n++] = (value & 0x7F) | 0x80;
+		value >>= 7;
+	}
+	out [n++] = value;
+
+	return n;
+}
+
+//========================================================================================================================
+// Returns the number of bytes read from in (0 if the varint is truncated)
+//========================================================================================================================
+uint8_t ccPulseDeltaDecoder :: decode (const uint8_t * in, size_t len, uint16_t & pulse)
+{
+	uint32_t value = 0;
+	uint8_t n = 0;
+
+	do {
+		if ((n >= len) || (n >= CCPULSE_DELTA_MAX_BYTES)) return 0;
+		value |= (uint32_t) (in [n] & 0x7F) << (7 * n);
+	}
+	while (in [n++] & 0x80);
+
+	bool level		= value & 1;
+	value >>= 1;
+	int32_t delta	= (value & 1) ? -(int32_t) ((value + 1) >> 1) : (int32_t) (value >> 1);
+
+	_previous [level] += delta;
+	pulse = makePulse (level, _previous [level]);
+
+	return n;
+}
+
+}
@@ -0,0 +1,142 @@
+//************************************************************************************************************************
+// ccPulse.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include <stdio.h>
+#if defined (ESP8266) || defined (ESP32)
+#	include <Arduino.h>
+#endif
+
+
+namespace cc1101 {
+
+/**
+ * A pulse is the duration of one level of the demodulated OOK signal: 15 bits of duration in µs plus the level in
+ * the most significant bit (1 = carrier on / pulse, 0 = carrier off / gap)
+ */
+#define CCPULSE_LEVEL_BIT				0x8000
+#define CCPULSE_MAX_US					0x7FFF						// Longer durations are saturated
+#define CCPULSE_RING_LEN				1024						// Capture ring buffer size (must be a power of 2)
+#define CCPULSE_DELTA_MAX_BYTES			3							// Max size of one delta encoded pulse
+
+inline uint16_t	makePulse				(bool level, uint32_t us)	{ return (level ? CCPULSE_LEVEL_BIT : 0) | ((us > CCPULSE_MAX_US) ? CCPULSE_MAX_US : us); }
+inline bool		pulseLevel				(uint16_t pulse)			{ return (pulse & CCPULSE_LEVEL_BIT) != 0; }
+inline uint16_t	pulseWidth				(uint16_t pulse)			{ return pulse & CCPULSE_MAX_US; }
+
+
+/**
+ * Class: ccPulseRing
+ *
+ * Description:
+ * Preallocated single producer (edge interrupt) / single consumer (loop) ring buffer of pulses
+ */
+class ccPulseRing
+{
+private:
+
+	uint16_t			_pulses [CCPULSE_RING_LEN];
+	volatile uint16_t	_head			= 0;						// Written by the producer only
+	volatile uint16_t	_tail			= 0;						// Written by the consumer only
+	volatile uint32_t	_nbOverflows	= 0;						// Pulses lost because the buffer was full
+
+public:
+
+	bool push							(uint16_t pulse);			// ISR safe
+	bool pop							(uint16_t & pulse);			// ISR safe
+
+	uint16_t available					() const					{ return (_head - _tail) & (CCPULSE_RING_LEN - 1);	}
+	uint32_t getOverflows				() const					{ return _nbOverflows;								}
+	void clear							()							{ _tail = _head; _nbOverflows = 0;					}
+};
+
+
+/**
+ * Class: ccPulseSource
+ *
+ * Description:
+ * Stream of pulses to transmit
+ */
+class ccPulseSource
+{
+public:
+	virtual ~ccPulseSource				() {}
+	virtual bool next					(uint16_t & pulse) = 0;		// False at the end of the stream
+};
+
+
+/**
+ * Class: ccPulseArraySource
+ *
+ * Description:
+ * Pulses array in RAM or in flash (PROGMEM), repeated nbRepeats times
+ */
+class ccPulseArraySource : public ccPulseSource
+{
+private:
+
+	const uint16_t *	_pulses;
+	size_t				_nbPulses;
+	uint8_t				_nbRepeats;
+	size_t				_index			= 0;
+
+public:
+
+	ccPulseArraySource					(const uint16_t * pulses, size_t nbPulses, uint8_t nbRepeats = 1)
+		: _pulses (pulses), _nbPulses (nbPulses), _nbRepeats (nbRepeats) {}
+
+	virtual bool next					(uint16_t & pulse) override
+	{
+		if (_index >= _nbPulses) {
+			if ((_nbRepeats <= 1) || (_nbPulses == 0)) return false;
+			_nbRepeats--;
+			_index = 0;
+		}
+		pulse = pgm_read_word (&_pulses [_index++]);
+		return true;
+	}
+};
+
+
+/**
+ * Class: ccPulseDeltaEncoder
+ *
+ * Description:
+ * Compact export of pulses: each pulse is the difference with the previous pulse of the same level, zigzag encoded
+ * with the level in the lowest bit then written as a varint (1 byte for steady signals)
+ */
+class ccPulseDeltaEncoder
+{
+private:
+
+	uint16_t _previous [2]				= {0, 0};
+
+public:
+
+	uint8_t encode						(uint16_t pulse, uint8_t * out);
+	void reset							()							{ _previous [0] = _previous [1] = 0; }
+};
+
+
+/**
+ * Class: ccPulseDeltaDecoder
+ *
+ * Description:
+ * Decoder of the ccPulseDeltaEncoder format
+ */
+class ccPulseDeltaDecoder
+{
+private:
+
+	uint16_t _previous [2]				= {0, 0};
+
+public:
+
+	uint8_t decode						(const uint8_t * in, size_t len, uint16_t & pulse);
+	void reset							()							{ _previous [0] = _previous [1] = 0; }
+};
+
+}
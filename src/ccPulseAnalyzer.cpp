@@ -0,0 +1,248 @@
+//************************************************************************************************************************
+// ccPulseAnalyzer.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include "ccFlexDecoder.h"
+
+#include "ccPulseAnalyzer.h"
+
+
+namespace cc1101 {
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccHistogram :: add (uint16_t us)
+{
+	uint8_t i = 0;
+	while ((i < _nbBins) && !isClose (us, _bins [i].getMean ())) i++;
+
+	if (i == _nbBins) {
+		if (_nbBins >= CCHISTOGRAM_MAX_BINS) {
+			_nbDropped++;
+			return;
+		}
+		_bins [_nbBins++] = HISTOGRAM_BIN ();
+		_bins [i].min = us;
+		_bins [i].max = us;
+	}
+
+	HISTOGRAM_BIN & bin = _bins [i];
+	if (bin.sum > UINT32_MAX - us) {								// Saturated bin: the mean is already known
+		_nbDropped++;
+		return;
+	}
+	bin.sum += us;
+	bin.count++;
+	if (us < bin.min) bin.min = us;
+	if (us > bin.max) bin.max = us;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccHistogram :: fuse ()
+{
+	for (uint8_t i = 0; i < _nbBins; i++) {
+		for (uint8_t j = i + 1; j < _nbBins; ) {
+			if (isClose (_bins [i].getMean (), _bins [j].getMean ()) && (_bins [i].sum <= UINT32_MAX - _bins [j].sum)) {
+				_bins [i].sum	+= _bins [j].sum;
+				_bins [i].count	+= _bins [j].count;
+				if (_bins [j].min < _bins [i].min) _bins [i].min = _bins [j].min;
+				if (_bins [j].max > _bins [i].max) _bins [i].max = _bins [j].max;
+				_bins [j] = _bins [--_nbBins];
+			}
+			else {
+				j++;
+			}
+		}
+	}
+
+	// Insertion sort by mean
+	for (uint8_t i = 1; i < _nbBins; i++) {
+		HISTOGRAM_BIN bin = _bins [i];
+		uint8_t j = i;
+		for (; (j > 0) && (_bins [j - 1].getMean () > bin.getMean ()); j--) {
+			_bins [j] = _bins [j - 1];
+		}
+		_bins [j] = bin;
+	}
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+size_t ccHistogram :: printTo (Print & p) const
+{
+	size_t n = 0;
+	for (uint8_t i = 0; i < _nbBins; i++) {
+		n += p.print (F(" ["));
+		if (i < 10) n += p.print (' ');
+		n += p.print ((int) i);
+		n += p.print (F("] count: "));
+		n += p.print ((unsigned) _bins [i].count);
+		n += p.print (F(", width: "));
+		n += p.print ((unsigned) _bins [i].getMean ());
+		n += p.print (F(" us ["));
+		n += p.print ((unsigned) _bins [i].min);
+		n += p.print (';');
+		n += p.print ((unsigned) _bins [i].max);
+		n += p.print (F("]\n"));
+	}
+	return n;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ccPulseAnalyzer :: clear ()
+{
+	_pulses.clear ();
+	_gaps.clear ();
+	_periods.clear ();
+
+	_nbPulses		= 0;
+	_nbPackages		= 0;
+	_inPackage		= false;
+	_isGuessed		= false;
+	_guess			= nullptr;
+}
+
+//========================================================================================================================
+// The gaps between the packages and the silence before the first pulse are not analyzed
+//========================================================================================================================
+void ccPulseAnalyzer :: feed (uint16_t pulse)
+{
+	uint16_t us = pulseWidth (pulse);
+
+	if (pulseLevel (pulse)) {
+		if (!_inPackage) _nbPackages++;
+		_inPackage		= true;
+		_lastPulseUs	= us;
+		_nbPulses++;
+		_pulses.add (us);
+		return;
+	}
+
+	if (!_inPackage) return;
+
+	if (us > CCANALYZER_PACKAGE_GAP_US) {
+		_inPackage = false;
+		return;
+	}
+
+	_gaps.add (us);
+	_periods.add (_lastPulseUs + us);
+}
+
+//========================================================================================================================
+// Same rules as the rtl_433 pulse analyzer, the reset limit is set just above the longest analyzed gap
+//========================================================================================================================
+bool ccPulseAnalyzer :: analyze ()
+{
+	_pulses.fuse ();
+	_gaps.fuse ();
+	_periods.fuse ();
+
+	_params		= CCDEMOD_PARAMS ();
+	_isGuessed	= false;
+	_guess		= "No clue";
+
+	uint8_t nbPulses	= _pulses.size ();
+	uint8_t nbGaps		= _gaps.size ();
+	uint8_t nbPeriods	= _periods.size ();
+
+	if ((nbPulses == 0) || (nbGaps == 0)) {
+		_guess = "Not enough pulses";
+		return false;
+	}
+
+	_params.resetUs = _gaps [nbGaps - 1].max + 1;
+
+	auto isDouble = [] (uint32_t shortUs, uint32_t longUs) {
+		uint32_t twice = 2 * shortUs;
+		return ((twice > longUs) ? twice - longUs : longUs - twice) <= longUs / CCHISTOGRAM_TOLERANCE_DIV;
+	};
+
+	if ((nbPulses == 1) && (nbGaps == 1)) {
+		_guess = "Un-modulated signal, maybe a preamble only";
+	}
+	else if ((nbPulses == 1) && (nbGaps > 1)) {
+		_guess				= "Pulse Position Modulation with fixed pulse width";
+		_params.modulation	= OOK_PPM;
+		_params.shortUs		= _gaps [0].getMean ();
+		_params.longUs		= _gaps [1].getMean ();
+		_params.gapUs		= (nbGaps > 2) ? _gaps [1].max + 1 : 0;
+		_isGuessed			= true;
+	}
+	else if ((nbPulses == 2) && (nbGaps == 2) && (nbPeriods == 1)) {
+		_guess				= "Pulse Width Modulation with fixed period";
+		_params.modulation	= OOK_PWM;
+		_params.shortUs		= _pulses [0].getMean ();
+		_params.longUs		= _pulses [1].getMean ();
+		_isGuessed			= true;
+	}
+	else if ((nbPulses == 2) && (nbGaps == 2) && (nbPeriods == 3)
+												&& isDouble (_pulses [0].getMean (), _pulses [1].getMean ())
+												&& isDouble (_gaps [0].getMean (), _gaps [1].getMean ())) {
+		_guess				= "Manchester coding";
+		_params.modulation	= OOK_MC_ZEROBIT;
+		_params.shortUs		= (_pulses [0].getMean () < _gaps [0].getMean ()) ? _pulses [0].getMean () : _gaps [0].getMean ();
+		_isGuessed			= true;
+	}
+	else if ((nbPulses == 2) && (nbGaps == 1)) {
+		_guess				= "Pulse Width Modulation with fixed gap";
+		_params.modulation	= OOK_PWM;
+		_params.shortUs		= _pulses [0].getMean ();
+		_params.longUs		= _pulses [1].getMean ();
+		_isGuessed			= true;
+	}
+	else if ((nbPulses == 3) && (_pulses [0].getMean () < _pulses [1].getMean () / 2)) {
+		_guess				= "Pulse Width Modulation with sync/delimiter";
+		_params.modulation	= OOK_PWM;
+		_params.syncUs		= _pulses [0].getMean ();
+		_params.shortUs		= _pulses [1].getMean ();
+		_params.longUs		= _pulses [2].getMean ();
+		_isGuessed			= true;
+	}
+	else if ((nbPulses == 2) && (nbGaps > 2)) {
+		_guess				= "Pulse Width Modulation with multiple packets";
+		_params.modulation	= OOK_PWM;
+		_params.shortUs		= _pulses [0].getMean ();
+		_params.longUs		= _pulses [1].getMean ();
+		_params.gapUs		= _gaps [1].max + 1;
+		_isGuessed			= true;
+	}
+
+	return _isGuessed;
+}
+
+//========================================================================================================================
+// rtl_433 -A like report
+//========================================================================================================================
+size_t ccPulseAnalyzer :: printTo (Print & p) const
+{
+	size_t n = 0;
+
+	n += p.print (F("Analyzing "));				n += p.print (_nbPulses);
+	n += p.print (F(" pulses in "));			n += p.print (_nbPackages);
+	n += p.print (F(" packages\nPulse width distribution:\n"));		n += p.print (_pulses);
+	n += p.print (F("Gap width distribution:\n"));					n += p.print (_gaps);
+	n += p.print (F("Pulse period distribution:\n"));				n += p.print (_periods);
+
+	if (_guess != nullptr) {
+		n += p.print (F("Guessing modulation: "));
+		n += p.print (_guess);
+		n += p.print ('\n');
+	}
+	if (_isGuessed) {
+		n += p.print (F("Use a flex decoder with -X '"));
+		n += ccFlexDecoder::printSpec (p, "name", _params);
+		n += p.print (F("'\n"));
+	}
+	return n;
+}
+
+}
@@ -0,0 +1,107 @@
+//************************************************************************************************************************
+// ccPulseAnalyzer.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include "ccPulse.h"
+#include "ccDemodulator.h"
+
+
+namespace cc1101 {
+
+#define CCHISTOGRAM_MAX_BINS			16
+#define CCHISTOGRAM_TOLERANCE_DIV		5							// Same bin if |width - mean| <= mean / 5 (20%)
+#define CCANALYZER_PACKAGE_GAP_US		10000						// Longer gaps separate the packages (not analyzed)
+
+
+/**
+ * Cluster of widths
+ */
+struct HISTOGRAM_BIN
+{
+	uint32_t	sum				= 0;
+	uint32_t	count			= 0;
+	uint16_t	min				= 0;
+	uint16_t	max				= 0;
+
+	uint16_t getMean			() const	{ return count ? sum / count : 0; }
+};
+
+
+/**
+ * Class: ccHistogram
+ *
+ * Description:
+ * Bounded integer clustering of widths (rtl_433 analyzer histogram): a width joins the bin whose mean is within 20%,
+ * else opens a new bin; the widths are dropped when all the bins are used (or when the sum of a bin would overflow).
+ */
+class ccHistogram : public Printable
+{
+private:
+
+	HISTOGRAM_BIN	_bins [CCHISTOGRAM_MAX_BINS];
+	uint8_t			_nbBins			= 0;
+	uint32_t		_nbDropped		= 0;
+
+private:
+
+	static bool isClose				(uint16_t a, uint16_t b)	{ return ((a > b) ? a - b : b - a) <= ((a > b) ? a : b) / CCHISTOGRAM_TOLERANCE_DIV; }
+
+public:
+
+	void add						(uint16_t us);
+	void fuse						();							// Merges the close bins and sorts them by mean
+	void clear						()							{ _nbBins = 0; _nbDropped = 0; }
+
+	uint8_t size					() const					{ return _nbBins;		}
+	const HISTOGRAM_BIN & operator[] (uint8_t i) const			{ return _bins [i];		}
+
+	virtual size_t printTo			(Print & p) const override;	// " [ i] count: n, width: mean us [min;max]" lines
+};
+
+
+/**
+ * Class: ccPulseAnalyzer
+ *
+ * Description:
+ * Analysis of a raw OOK capture (rtl_433 -A): histograms of the pulse, gap and period widths, guess of the coding
+ * (Manchester, PWM, PWM with sync, PPM) and of the matching demodulation parameters, printed as a flex decoder spec.
+ * Integer only and fixed memory so that it runs on captures of any length.
+ */
+class ccPulseAnalyzer : public Printable
+{
+private:
+
+	ccHistogram		_pulses;
+	ccHistogram		_gaps;
+	ccHistogram		_periods;
+
+	uint16_t		_lastPulseUs	= 0;
+	uint32_t		_nbPulses		= 0;
+	uint32_t		_nbPackages		= 0;
+	bool			_inPackage		= false;
+
+	CCDEMOD_PARAMS	_params;
+	bool			_isGuessed		= false;
+	const char *	_guess			= nullptr;
+
+public:
+
+	void feed						(uint16_t pulse);
+	void clear						();
+
+	bool analyze					();							// Fuses the histograms and guesses the coding
+
+	bool isGuessed					() const					{ return _isGuessed;	}
+	const CCDEMOD_PARAMS & getParams () const					{ return _params;		}
+	const ccHistogram & getPulses	() const					{ return _pulses;		}
+	const ccHistogram & getGaps		() const					{ return _gaps;			}
+	const ccHistogram & getPeriods	() const					{ return _periods;		}
+
+	virtual size_t printTo			(Print & p) const override;
+};
+
+}
@@ -15,76 +15,122 @@ namespace cc1101 {
 SINGLETON_IMPL (ccReplayer)
 
 
+//========================================================================================================================
+// The memorized signal is replaced only if the packet can be copied in a pool packet
+//========================================================================================================================
+bool ccReplayer :: setSignal (const CCPACKET & packet, const CCPACKET_META & meta /*= CCPACKET_META ()*/) {
+
+	ccPacketHandle radio = I(ccPacketPool).acquire ();
+	if (!radio) return false;
+
+	*radio			= packet;
+	_currentSignal	= std::move (radio);
+	_currentMeta	= meta;
+
+	return true;
+}
+
 //========================================================================================================================
 //
 //========================================================================================================================
-bool ccReplayer :: recordSignal (CC1101Transceiver * transceiver, Print & out, CCPACKET & radio) {
+bool ccReplayer :: recordSignal (CC1101Transceiver * transceiver, Print & out) {
 
-	if (transceiver->getLastPacketReceived ().length < 1) {
+	// Snapshot: the driver buffer is reused by the next reception
+	ccRxPacketView view	= transceiver->getLastPacketView ();
+	CCPACKET received;
+	if (!view.copyTo (received)) {
 		out << F("No captured radio signal memorized, please try again later") << LN;
 		return false;
 	}
+	if (!setSignal (received, transceiver->getLastPacketMeta ())) {
+		out << F("No free packet to memorize the captured radio signal !") << LN;
+		return false;
+	}
 
-	radio = transceiver->getLastPacketReceived ();
-	out << F("SUCCESS! Memorized captured radio signal found (") << radio.length << " bytes)" << LN;
+	out << F("SUCCESS! Memorized captured radio signal found (") << _currentSignal->length << " bytes)" << LN;
 
-	EspBoard::blinks (radio.length / 10);
+	EspBoard::blinks (_currentSignal->length / 10);
 
 	// Reset packet
-	transceiver->getLastPacketReceived ().reset ();
+	transceiver->releaseLastPacket ();
 
 	return true;
 }
 
 //========================================================================================================================
-//
+// Other packets may be queued: only the result of this one counts
 //========================================================================================================================
-bool ccReplayer :: emmitSignal (CC1101Transceiver * transceiver, Print & out, CCPACKET & radio) {
-
-	bool result = false;
+bool ccReplayer :: sendSignal (CC1101Transceiver * transceiver, Print & out, const ccPacketHandle & radio) {
 
-	// **************************************************
-	// TEST PACKET (radio signal was not recorded before)
-	// **************************************************
-	bool test = false;
-	// randomSeed (analogRead(0));
-
-	if (radio.length <= 0) {
-		test = true;
-		uint8_t address	= transceiver->getAddress();
-		uint8_t length	= transceiver->getLength();
-		if (length == 0) {
-			length = random (40, CCPACKET_RXTXFIFO_DATA_LEN);	// Generate a random number between 40 and 61
-		}
-		radio = CCPACKET::getTestPacket (address, length);
+	bool isSent = false;
+	if (transceiver->queuePacket (radio)) {
+		transceiver->sendQueuedPackets (radio.get (), &isSent);
+	}
+	if (!isSent) {
+		out << F("Fail to send radio signal !") << LN;
+		return false;
 	}
-	// **************************************************
 
+	// Visual indicator that signal sent
+	EspBoard::blinks (radio->length / 10);
+	out << F("Radio signal sent (") << radio->length << " bytes)" << LN;
 
-	if (radio.length > 0) {
+	return true;
+}
 
-		result = transceiver->sendPacket (radio);
+//========================================================================================================================
+// A test packet is sent if no radio signal was recorded before (it is not memorized)
+//========================================================================================================================
+bool ccReplayer :: emmitSignal (CC1101Transceiver * transceiver, Print & out) {
 
-		if (result) {
-			// Visual indicator that signal sent
-			EspBoard::blinks (radio.length / 10);
+	if (_currentSignal && (_currentSignal->length > 0)) {
+		return sendSignal (transceiver, out, _currentSignal);
+	}
 
-			out << F("Radio signal sent (") << radio.length << " bytes)" << LN;
-		}
-		else {
-			out << F("Fail to send radio signal !") << LN;
-		}
+	ccPacketHandle radio = I(ccPacketPool).acquire ();
+	if (!radio) {
+		out << F("No free packet to send a test radio signal !") << LN;
+		return false;
 	}
-	else
-	{
-		out << F("No radio signal found, record one first") << LN;
+
+	// randomSeed (analogRead(0));
+	uint8_t address	= transceiver->getAddress();
+	uint8_t length	= transceiver->getLength();
+	if (length == 0) {
+		length = random (40, CCPACKET_RXTXFIFO_DATA_LEN);		// Generate a random number between 40 and 61
 	}
+	*radio = CCPACKET::getTestPacket (address, length);
+
+	return sendSignal (transceiver, out, radio);
+}
+
+//========================================================================================================================
+// The memorized signal is replaced only if the stored one is read
+//========================================================================================================================
+bool ccReplayer :: loadSignal (uint8_t id) {
+
+	CCPACKET_META meta;
+	ccPacketHandle radio = I(ccPacketStorage).load (id, &meta);
+	if (!radio) return false;
 
-	// **************************************************
-	if (test) radio.length = 0;
-	// **************************************************
+	_currentSignal	= std::move (radio);
+	_currentMeta	= meta;
 
-	return result;
+	return true;
+}
+
+//========================================================================================================================
+// The memorized signal is left untouched
+//========================================================================================================================
+bool ccReplayer :: replaySignal (CC1101Transceiver * transceiver, Print & out, uint8_t id) {
+
+	ccPacketHandle radio = I(ccPacketStorage).load (id);
+	if (!radio) {
+		out << F("No stored radio signal ") << id << LN;
+		return false;
+	}
+
+	return sendSignal (transceiver, out, radio);
 }
 
-}
\ No newline at end of file
+}
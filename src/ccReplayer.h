@@ -23,20 +23,24 @@ class ccReplayer
 	SINGLETON_CLASS (ccReplayer)
 
 private:
-	CCPACKET 					_currentRadioSignal;	// Memorized Radio Signal
+	ccPacketHandle				_currentSignal;			// Memorized Radio Signal (pool packet, empty if none)
+	CCPACKET_META				_currentMeta;			// Reception time, frequency and profile of the memorized signal
 
 private:
-	bool recordSignal			(CC1101Transceiver * transceiver, Print & out, CCPACKET & radio);
-	bool emmitSignal			(CC1101Transceiver * transceiver, Print & out, CCPACKET & radio);
+	bool sendSignal				(CC1101Transceiver * transceiver, Print & out, const ccPacketHandle & radio);
 
 public:
-	CCPACKET & currentSignal	()												{ return _currentRadioSignal;									}
+	const ccPacketHandle & currentSignal () const								{ return _currentSignal;												}
+	CCPACKET_META & currentMeta	()												{ return _currentMeta;													}
+	bool setSignal				(const CCPACKET & packet, const CCPACKET_META & meta = CCPACKET_META ());	// False if the pool is exhausted
 
-	bool recordSignal			(CC1101Transceiver * transceiver, Print & out)	{ return recordSignal (transceiver, out, _currentRadioSignal);	}
-	bool emmitSignal			(CC1101Transceiver * transceiver, Print & out)	{ return emmitSignal  (transceiver, out, _currentRadioSignal);	}
+	bool recordSignal			(CC1101Transceiver * transceiver, Print & out);
+	bool emmitSignal			(CC1101Transceiver * transceiver, Print & out);
 
-	bool saveSignal 			(uint8_t id)									{ return I(ccPacketStorage).write	(id, _currentRadioSignal);	}
-	bool loadSignal 			(uint8_t id)									{ return I(ccPacketStorage).read 	(id, _currentRadioSignal);	}
+	bool saveSignal 			(uint8_t id)									{ return _currentSignal && I(ccPacketStorage).write (id, *_currentSignal, &_currentMeta);	}
+	bool loadSignal 			(uint8_t id);
+
+	bool replaySignal			(CC1101Transceiver * transceiver, Print & out, uint8_t id);	// Stored signal sent from a pool packet
 };
 
 }
@@ -0,0 +1,111 @@
+//************************************************************************************************************************
+// ccSpectrumScanner.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <Common.h>
+
+#include "ccSpectrumScanner.h"
+
+using namespace corex;
+
+
+namespace cc1101 {
+
+//========================================================================================================================
+// Select the channels to sweep and fill the calibration cache (about 1ms per channel)
+//========================================================================================================================
+bool ccSpectrumScanner :: setRange (uint8_t firstChannel, uint8_t nbChannels)
+{
+	if ((nbChannels == 0) || (CCSCANNER_MAX_CHANNELS < nbChannels) || (firstChannel + nbChannels > 256)) {
+		Logln (F("Invalid scan range"));
+		return false;
+	}
+
+	_radio.stopReceivePacket ();
+
+	uint8_t channel = _radio.getChannel ();
+
+	bool isCalibrated = true;
+	for (uint8_t i = 0; isCalibrated && (i < nbChannels); i++) {
+		isCalibrated = _radio.calibrateChannel (firstChannel + i, _fscal [i]);
+	}
+
+	_radio.setChannelFast (channel);
+	_radio.startReceivePacket (0);							// Calibrates again on the working channel
+
+	if (!isCalibrated) {
+		_nbChannels = 0;									// No sweep without the calibration cache
+		return false;
+	}
+
+	_firstChannel	= firstChannel;
+	_nbChannels		= nbChannels;
+
+	Logln (F("Scan range: ") << nbChannels << F(" channels from ") << firstChannel);
+
+	return true;
+}
+
+//========================================================================================================================
+// RSSI sweep of the channels range, the reception is suspended during the sweep
+//========================================================================================================================
+void ccSpectrumScanner :: sweep (uint16_t settleUs /*= CCSCANNER_DEFAULT_SETTLE_US*/)
+{
+	if (_nbChannels == 0) return;
+
+	_radio.stopReceivePacket ();
+
+	uint8_t channel	= _radio.getChannel ();
+	uint8_t mcsm0	= _radio.setManualCalibration ();
+
+	uint32_t startUs = micros ();
+
+	for (uint8_t i = 0; i < _nbChannels; i++) {
+
+		_radio.retuneChannel (_firstChannel + i, _fscal [i]);
+		delayMicroseconds (CC1101_SETTLE_US + settleUs);
+
+		int16_t dbm = _radio.getRssiDbm (_radio.readStatusRegFast (CC1101_RSSI));
+		_rssiDbm [i] = (dbm < INT8_MIN) ? INT8_MIN : dbm;
+	}
+
+	_sweepUs = micros () - startUs;
+
+	_radio.cmdStrobeFast (CC1101_SIDLE);
+	_radio.writeRegFast (CC1101_MCSM0,	mcsm0);
+	_radio.setChannelFast (channel);
+	_radio.startReceivePacket (0);							// Calibrates again on the working channel
+
+	Logln (F("Sweep of ") << _nbChannels << F(" channels in ") << _sweepUs << F("us"));
+}
+
+//========================================================================================================================
+// Channel with the lowest RSSI of the last sweep
+//========================================================================================================================
+uint8_t ccSpectrumScanner :: getCleanestChannel () const
+{
+	uint8_t best = 0;
+	for (uint8_t i = 1; i < _nbChannels; i++) {
+		if (_rssiDbm [i] < _rssiDbm [best]) best = i;
+	}
+	return _firstChannel + best;
+}
+
+//========================================================================================================================
+// One "channel dBm" line per channel
+//========================================================================================================================
+size_t ccSpectrumScanner :: printTo (Print & p) const
+{
+	size_t n = 0;
+	for (uint8_t i = 0; i < _nbChannels; i++) {
+		n += p.print ((int) (_firstChannel + i));
+		n += p.print (' ');
+		n += p.print ((int) _rssiDbm [i]);
+		n += p.print ('\n');
+	}
+	return n;
+}
+
+}
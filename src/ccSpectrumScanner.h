@@ -0,0 +1,55 @@
+//************************************************************************************************************************
+// ccSpectrumScanner.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include "cc1101.h"
+
+
+namespace cc1101 {
+
+#define CCSCANNER_MAX_CHANNELS			128							// Size of the calibration cache and of the result array
+#define CCSCANNER_DEFAULT_SETTLE_US		400							// Time for the RSSI to be valid after entering RX
+
+
+/**
+ * Class: ccSpectrumScanner
+ *
+ * Description:
+ * RSSI sweep over a range of channels (base frequency + CHANNR * channel spacing) to find interferences and clean
+ * channels. Each channel is calibrated once, then the sweeps only write CHANNR and the cached FSCAL values (no
+ * FS_AUTOCAL) so a step only costs the settling time plus a few SPI accesses.
+ */
+class ccSpectrumScanner : public Printable
+{
+private:
+
+	CC1101 &	_radio;
+
+	uint8_t		_firstChannel		= 0;
+	uint8_t		_nbChannels			= 0;
+	uint8_t		_fscal [CCSCANNER_MAX_CHANNELS][CC1101_FSCAL_LEN];	// Calibration cache
+	int8_t		_rssiDbm [CCSCANNER_MAX_CHANNELS];					// Last sweep result
+	uint32_t	_sweepUs			= 0;							// Duration of the last sweep
+
+public:
+
+	ccSpectrumScanner				(CC1101 & radio) : _radio (radio) {}
+
+	bool setRange					(uint8_t firstChannel, uint8_t nbChannels);
+	void sweep						(uint16_t settleUs = CCSCANNER_DEFAULT_SETTLE_US);
+
+	uint8_t getFirstChannel			() const				{ return _firstChannel;		}
+	uint8_t size					() const				{ return _nbChannels;		}
+	const int8_t * getRssiDbm		() const				{ return _rssiDbm;			}
+	uint32_t getSweepDurationUs		() const				{ return _sweepUs;			}
+
+	uint8_t getCleanestChannel		() const;
+
+	virtual size_t printTo			(Print & p) const override;
+};
+
+}
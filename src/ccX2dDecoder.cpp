@@ -0,0 +1,126 @@
+//************************************************************************************************************************
+// ccX2dDecoder.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <Common.h>
+
+#include "ccX2dDecoder.h"
+
+using namespace corex;
+
+
+namespace cc1101 {
+
+//========================================================================================================================
+//
+//========================================================================================================================
+size_t X2D_EVENT :: printTo (Print & p) const
+{
+	static const char hex [] = "0123456789abcdef";
+
+	size_t n = 0;
+	n += p.print (F("X2D house-"));
+	for (int8_t shift = 12; shift >= 0; shift -= 4) {
+		n += p.print (hex [(fields.houseCode >> shift) & 0x0F]);
+	}
+	n += p.print (F(" cmd-"));
+	n += p.print (hex [getCommand () >> 4]);
+	n += p.print (hex [getCommand () & 0x0F]);
+	n += p.print (F(" frame-"));
+	n += p.print ((int) getFrameIndex () + 1);
+	n += p.print ('/');
+	n += p.print ((int) X2D_BURST_LEN);
+	return n;
+}
+
+//========================================================================================================================
+// The NRZI decoding makes the frame independent of the line polarity and of the bits before the preamble
+//========================================================================================================================
+bool ccX2dDecoder :: decode (const uint8_t * data, uint16_t nbBits, X2D_EVENT & event)
+{
+	uint8_t bytes [X2D_PAYLOAD_LEN + 2]	= {0};
+	uint8_t nbFrameBits					= 0;
+	uint8_t lastBits					= 0;						// Flag hunting
+	uint8_t nbOnes						= 0;
+	bool inFrame						= false;
+	bool previous						= (nbBits > 0) && (data [0] & 0x80);
+
+	for (uint16_t i = 1; i < nbBits; i++) {
+
+		bool level	= (data [i >> 3] >> (7 - (i & 7))) & 1;
+		bool bit	= (level == previous);							// NRZI: no level change => 1
+		previous	= level;
+
+		if (!inFrame) {
+			lastBits = (lastBits << 1) | bit;
+			inFrame = (lastBits == X2D_FLAG);
+			continue;
+		}
+
+		if (nbOnes == X2D_STUFFING_ONES) {
+			nbOnes = 0;
+			if (!bit) continue;										// Stuffed 0
+			break;													// Six 1: flag or abort
+		}
+		nbOnes = bit ? nbOnes + 1 : 0;
+
+		if (bit) bytes [nbFrameBits >> 3] |= 1 << (nbFrameBits & 7);	// LSB first
+		if (++nbFrameBits == sizeof (bytes) * 8) break;
+	}
+
+	if (nbFrameBits < sizeof (bytes) * 8) {
+		_nbFramingErrors++;
+		return false;
+	}
+
+	X2D_FIELDS & fields = event.fields;
+	fields.houseCode	= (bytes [0] << 8) | bytes [1];
+	fields.source		= bytes [2];
+	fields.recipient	= bytes [3];
+	fields.reserved		= bytes [4];
+	fields.sequence		= bytes [5];
+	fields.command		= bytes [6];
+	fields.argument		= bytes [7];
+
+	uint16_t checksum = (bytes [X2D_PAYLOAD_LEN] << 8) | bytes [X2D_PAYLOAD_LEN + 1];
+	if (X2D_PAYLOAD (fields).getChecksum () != checksum) {
+		_nbChecksumErrors++;
+		return false;
+	}
+
+	_nbFrames++;
+	return true;
+}
+
+//========================================================================================================================
+// The capture may start in the middle of a symbol => second try with a one chip offset
+//========================================================================================================================
+bool ccX2dDecoder :: decodeManchester (const ccBitPacket & chips, X2D_EVENT & event)
+{
+	ccBitPacket bits;
+
+	chips.manchesterDecode (bits);
+	if (decode (bits, event)) return true;
+
+	ccBitPacket shifted = chips;
+	shifted.shiftLeft (1);
+	shifted.manchesterDecode (bits);
+	return decode (bits, event);
+}
+
+//========================================================================================================================
+// First row holding a valid frame
+//========================================================================================================================
+const ccDecodedEvent * ccX2dDecoder :: decode (const ccBitBuffer & bits)
+{
+	for (uint8_t row = 0; row < bits.getNbRows (); row++) {
+		if ((bits.getNbBits (row) >= X2D_MIN_LEN * 8) && decode (bits.getRow (row), bits.getNbBits (row), _event)) {
+			return &_event;
+		}
+	}
+	return nullptr;
+}
+
+}
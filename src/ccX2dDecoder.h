@@ -0,0 +1,79 @@
+//************************************************************************************************************************
+// ccX2dDecoder.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include "ccX2dFrame.h"
+#include "ccBitPacket.h"
+#include "ccProtocolDecoder.h"
+
+
+namespace cc1101 {
+
+#define X2D_MIN_LEN						11							// Flag + payload + checksum without preamble
+
+/**
+ * Decoded X2D frame
+ */
+struct X2D_EVENT : public ccDecodedEvent
+{
+	static constexpr uint8_t TYPE = CCEVENT_X2D;
+
+	X2D_FIELDS	fields;
+
+	X2D_EVENT							() : ccDecodedEvent (TYPE) {}
+
+	uint16_t getHouseCode				() const					{ return fields.houseCode;							}
+	uint8_t getCommand					() const					{ return fields.command & ~X2D_MORE_FRAMES;			}
+	uint8_t getFrameIndex				() const					{ return fields.sequence;							}
+	bool isLastFrame					() const					{ return (fields.command & X2D_MORE_FRAMES) == 0;	}
+	bool isHeatingOn					() const					{ return getCommand () == X2D_CMD_HEATING_ON;		}
+	bool isHeatingOff					() const					{ return getCommand () == X2D_CMD_HEATING_OFF;		}
+
+	virtual size_t printTo				(Print & p) const override;	// "X2D house-xxxx cmd-xx frame-n/3"
+};
+
+
+/**
+ * Class: ccX2dDecoder
+ *
+ * Description:
+ * X2D frames decoder (see ccX2dFrame.h): single pass over the bits, NRZI decoding, flag hunting, bit destuffing and
+ * checksum check, no allocation. The input is the Manchester decoded bit stream: a packet received by the CC1101
+ * with Manchester enabled, a demodulated OOK_MC_ZEROBIT row or the Manchester chips of a raw capture.
+ * Also the X2D module of the ccDecoderRegistry.
+ */
+class ccX2dDecoder : public ccProtocolDecoder
+{
+private:
+
+	X2D_EVENT	_event;												// Last decoded frame (registry)
+
+	uint32_t	_nbFrames			= 0;
+	uint32_t	_nbChecksumErrors	= 0;
+	uint32_t	_nbFramingErrors	= 0;							// No flag or truncated frame
+
+public:
+
+	bool decode							(const uint8_t * data, uint16_t nbBits, X2D_EVENT & event);
+	bool decode							(const CCPACKET & packet, X2D_EVENT & event)	{ return decode (packet.data, packet.length * 8, event);			}
+	bool decode							(const ccBitPacket & bits, X2D_EVENT & event)	{ return decode (bits.getData (), bits.getNbBits (), event);		}
+	bool decodeManchester				(const ccBitPacket & chips, X2D_EVENT & event);
+
+	// ccProtocolDecoder
+	virtual const char * getName		() const override			{ return "x2d";						}
+	virtual bool acceptsLength			(uint8_t length) const override	{ return length >= X2D_MIN_LEN;	}
+	virtual bool acceptsBits			() const override			{ return true;						}
+
+	virtual const ccDecodedEvent * decode	(const CCPACKET & packet) override	{ return decode (packet, _event) ? &_event : nullptr; }
+	virtual const ccDecodedEvent * decode	(const ccBitBuffer & bits) override;
+
+	uint32_t getNbFrames				() const					{ return _nbFrames;			}
+	uint32_t getNbChecksumErrors		() const					{ return _nbChecksumErrors;	}
+	uint32_t getNbFramingErrors			() const					{ return _nbFramingErrors;	}
+};
+
+}
@@ -0,0 +1,97 @@
+//************************************************************************************************************************
+// ccX2dEncoder.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include "ccX2dFrame.h"
+
+
+namespace cc1101 {
+
+/**
+ * Class: ccX2dEncoder
+ *
+ * Description:
+ * X2D frames encoder, constexpr so that the frames of a known house code are computed at compile time and stored in
+ * flash, ex: constexpr X2D_FRAME frame = ccX2dEncoder::encode (fields);
+ * The same functions build the frames of a house code known at runtime.
+ */
+class ccX2dEncoder
+{
+private:
+
+	X2D_FRAME	_frame;
+	bool		_level		= true;									// Line level before the preamble
+	uint8_t		_nbOnes		= 0;									// Consecutive 1 (bit stuffing)
+
+private:
+
+	constexpr void writeLevel (bool level)
+	{
+		if (_frame.nbBits >= X2D_FRAME_MAX_LEN * 8) return;
+		if (level) _frame.data [_frame.nbBits >> 3] |= 0x80 >> (_frame.nbBits & 7);
+		_frame.nbBits++;
+	}
+
+	constexpr void writeNrzi (bool bit)
+	{
+		if (!bit) _level = !_level;
+		writeLevel (_level);
+	}
+
+	constexpr void writeStuffed (bool bit)
+	{
+		writeNrzi (bit);
+		_nbOnes = bit ? _nbOnes + 1 : 0;
+		if (_nbOnes == X2D_STUFFING_ONES) {
+			writeNrzi (0);
+			_nbOnes = 0;
+		}
+	}
+
+	constexpr void writeByte (uint8_t value)
+	{
+		for (uint8_t i = 0; i < 8; i++) writeStuffed ((value >> i) & 1);	// LSB first
+	}
+
+	constexpr ccX2dEncoder (const X2D_FIELDS & fields)
+	{
+		X2D_PAYLOAD payload (fields);
+		uint16_t checksum = payload.getChecksum ();
+
+		for (uint8_t i = 0; i < X2D_PREAMBLE_BITS; i++)	writeNrzi (0);
+		for (uint8_t i = 0; i < 8; i++)					writeNrzi ((X2D_FLAG << i) & 0x80);
+		for (uint8_t i = 0; i < X2D_PAYLOAD_LEN; i++)	writeByte (payload.bytes [i]);
+		writeByte (checksum >> 8);
+		writeByte (checksum & 0xFF);
+		for (uint8_t i = 0; i < X2D_END_ONES; i++)		writeNrzi (1);
+		for (uint8_t i = 0; i < X2D_END_ZEROS; i++)		writeNrzi (0);
+	}
+
+public:
+
+	static constexpr X2D_FRAME encode (const X2D_FIELDS & fields)
+	{
+		return ccX2dEncoder (fields)._frame;
+	}
+
+	// Frame i of the burst of a command: sequence number and X2D_MORE_FRAMES flag set
+	static constexpr X2D_FRAME encode (X2D_FIELDS fields, uint8_t command, uint8_t i)
+	{
+		fields.sequence	= i;
+		fields.command	= (i + 1 < X2D_BURST_LEN) ? (command | X2D_MORE_FRAMES) : command;
+		return encode (fields);
+	}
+
+	static void encode (const X2D_FIELDS & fields, uint8_t command, CCPACKET (&packets) [X2D_BURST_LEN])
+	{
+		for (uint8_t i = 0; i < X2D_BURST_LEN; i++) {
+			encode (fields, command, i).toCCPacket (packets [i]);
+		}
+	}
+};
+
+}
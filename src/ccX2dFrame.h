@@ -0,0 +1,103 @@
+//************************************************************************************************************************
+// ccX2dFrame.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include "ccBasicPacket.h"
+
+
+namespace cc1101 {
+
+/**
+ * X2D frame (Delta Dore), as sent by the CC1101 packet engine with Manchester enabled:
+ * - preamble of 17 NRZI 0 bits ("55 55" then the first bit of "7f")
+ * - HDLC flag 01111110
+ * - 8 bytes payload + 16 bits checksum (two's complement of the bytes sum, MSB first), each byte LSB first with a 0
+ *   stuffed after five consecutive 1
+ * - end: eight 1 then seven 0
+ * The whole bit stream is NRZI coded (0 => level change) then padded with 0 to X2D_FRAME_LEN bytes.
+ */
+#define X2D_FRAME_LEN					16							// Packet length of the captured frames
+#define X2D_FRAME_MAX_LEN				17							// Worst case bit stuffing
+#define X2D_PAYLOAD_LEN					8
+#define X2D_PREAMBLE_BITS				17
+#define X2D_FLAG						0x7E
+#define X2D_END_ONES					8
+#define X2D_END_ZEROS					7
+#define X2D_STUFFING_ONES				5
+
+#define X2D_BURST_LEN					3							// Frames of one command
+#define X2D_MORE_FRAMES					0x80						// Command flag: another frame of the burst follows
+
+#define X2D_CMD_HEATING_OFF				0x00
+#define X2D_CMD_HEATING_ON				0x03
+
+
+typedef BasicPacket <X2D_FRAME_MAX_LEN>				X2dPacket;		// One X2D frame, worst case bit stuffing
+
+/**
+ * X2D payload fields (default values of the captured Tybox frames)
+ */
+struct X2D_FIELDS
+{
+	uint16_t	houseCode		= 0;								// Pairing address of the emitter
+	uint8_t		source			= 0x00;
+	uint8_t		recipient		= 0x20;
+	uint8_t		reserved		= 0x00;
+	uint8_t		sequence		= 0;								// Index of the frame in the burst
+	uint8_t		command			= X2D_CMD_HEATING_OFF;				// With X2D_MORE_FRAMES
+	uint8_t		argument		= 0x64;
+};
+
+
+/**
+ * Encoded X2D frame
+ */
+struct X2D_FRAME
+{
+	uint8_t		data [X2D_FRAME_MAX_LEN]	= {};
+	uint8_t		nbBits						= 0;
+
+	constexpr uint8_t getLength () const					{ return ((nbBits + 7) / 8 < X2D_FRAME_LEN) ? X2D_FRAME_LEN : (nbBits + 7) / 8; }
+
+	constexpr bool operator== (const uint8_t (&other) [X2D_FRAME_LEN]) const
+	{
+		for (uint8_t i = 0; i < X2D_FRAME_MAX_LEN; i++) {
+			if (data [i] != ((i < X2D_FRAME_LEN) ? other [i] : 0)) return false;
+		}
+		return true;
+	}
+
+	constexpr ccPacketView view () const					{ return ccPacketView (data, getLength ()); }
+
+	void toCCPacket (CCPACKET & packet) const
+	{
+		packet.length = getLength ();
+		std::copy (data, data + packet.length, packet.data);
+	}
+};
+
+
+//========================================================================================================================
+// Serialized payload: house code (MSB first), source, recipient, reserved, sequence, command, argument
+//========================================================================================================================
+struct X2D_PAYLOAD
+{
+	uint8_t		bytes [X2D_PAYLOAD_LEN]		= {};
+
+	constexpr X2D_PAYLOAD (const X2D_FIELDS & fields)
+		: bytes { (uint8_t) (fields.houseCode >> 8), (uint8_t) fields.houseCode, fields.source, fields.recipient,
+				  fields.reserved, fields.sequence, fields.command, fields.argument } {}
+
+	constexpr uint16_t getChecksum () const
+	{
+		uint16_t sum = 0;
+		for (uint8_t i = 0; i < X2D_PAYLOAD_LEN; i++) sum += bytes [i];
+		return (uint16_t) (0 - sum);
+	}
+};
+
+}